@@ -1,8 +1,74 @@
+// strnlen, O_CLOEXEC and MAP_ANONYMOUS are POSIX or BSD extensions, declare them under the strict ISO C modes as well
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE
+#endif
+
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
 #include <ctype.h>
+#include <locale.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "JSON2C.h"
 
+// the systems which only have the BSD name of the anonymous mapping, or no close-on-exec flag
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+#ifndef O_CLOEXEC
+#define O_CLOEXEC 0
+#endif
+
+#if defined(__AVX2__) || defined(__PCLMUL__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// the length of a NUL-terminated input string is unknown, so it is bounded by the terminator only
+#define JSON_LENGTH_UNBOUNDED ((size_t) -1)
+
+// the string characters are validated as UTF-8, compile with -DJSON_VALIDATE_UTF8=0 to accept any byte above 0x7F
+#ifndef JSON_VALIDATE_UTF8
+#define JSON_VALIDATE_UTF8 1
+#endif
+
+// the JSON Lines records are read by the worker threads, compile with -DJSON_THREADS=0 to read them in the calling thread
+#ifndef JSON_THREADS
+#define JSON_THREADS 1
+#endif
+
+#if JSON_THREADS
+#include <pthread.h>
+#endif
+
+// the diagnostic messages are printed only if it's compiled with -DJSON_DEBUG, the failure is reported by json_getLastError
+#ifdef JSON_DEBUG
+#define JSON_LOG(...) printf(__VA_ARGS__)
+#else
+#define JSON_LOG(...) ((void) 0)
+#endif
+
+// the failure paths are moved away from the hot paths
+#if defined(__GNUC__)
+#define JSON_HOT  __attribute__((hot))
+#define JSON_COLD __attribute__((cold, noinline))
+#else
+#define JSON_HOT
+#define JSON_COLD
+#endif
+
+// the last error of the thread
+static _Thread_local JSON_Error json_error_last = { JSON_ERROR_NONE, JSON_INDEX_NONE };
+
 // 1. JSON API
 const char * json_type_toString(int type);
 int          json_number_toDouble(const char * input_string, const int input_string_startIndex, double * output_double);
@@ -13,12 +79,131 @@ int json_array_getValueByPosition(const char * input_string, const int input_str
 int      json_getKeyValuePairList(const char * input_string, const int input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, int * output_keyValuePairList_size);
 int json_keyValuePair_free(JSON_Key_Value_Pair * keyValuePair);
 
+// 1. JSON API (length-bounded)
+int            json_number_toDouble_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, double * output_double);
+int            json_string_toString_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, char ** output_string);
+int               json_getValueByJS_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, const char * input_keys, const size_t input_keys_length, const size_t input_keys_startIndex, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType);
+int       json_object_getValueByKey_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, const char * input_key, const size_t input_key_startIndex, const size_t input_key_endIndex, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType);
+int   json_array_getValueByPosition_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, const size_t input_array_position, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType);
+int        json_getKeyValuePairList_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size);
+
+// 1. JSON API (structural index)
+int                    json_index_build(const char * input_string, const size_t input_string_length, JSON_Index ** output_index);
+int                     json_index_free(JSON_Index * index);
+int             json_index_getValueByJS(const JSON_Index * index, const size_t input_string_startIndex, const char * input_keys, const size_t input_keys_length, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType);
+int     json_index_object_getValueByKey(const JSON_Index * index, const size_t input_string_startIndex, const char * input_key, const size_t input_key_startIndex, const size_t input_key_endIndex, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType);
+int json_index_array_getValueByPosition(const JSON_Index * index, const size_t input_string_startIndex, const size_t input_array_position, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType);
+
+// 1. JSON API (tape)
+int                json_parse_document(const char * input_string, const size_t input_string_length, JSON_Tape ** output_tape);
+int                     json_tape_free(JSON_Tape * tape);
+int             json_tape_getValueByJS(const JSON_Tape * tape, const size_t input_tapeIndex, const char * input_keys, const size_t input_keys_length, size_t * output_tapeIndex);
+int     json_tape_object_getValueByKey(const JSON_Tape * tape, const size_t input_tapeIndex, const char * input_key, const size_t input_key_startIndex, const size_t input_key_endIndex, size_t * output_tapeIndex);
+int json_tape_array_getValueByPosition(const JSON_Tape * tape, const size_t input_tapeIndex, const size_t input_array_position, size_t * output_tapeIndex);
+int                 json_tape_getValue(const JSON_Tape * tape, const size_t input_tapeIndex, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType);
+int          json_tape_number_toDouble(const JSON_Tape * tape, const size_t input_tapeIndex, double * output_double);
+
+// 1. JSON API (lookup context)
+int                 json_lookup_create(const char * input_string, const size_t input_string_length, const size_t input_threshold, JSON_Lookup ** output_lookup);
+int                   json_lookup_free(JSON_Lookup * lookup);
+int           json_lookup_getValueByJS(JSON_Lookup * lookup, const size_t input_string_startIndex, const char * input_keys, const size_t input_keys_length, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType);
+int   json_lookup_object_getValueByKey(JSON_Lookup * lookup, const size_t input_string_startIndex, const char * input_key, const size_t input_key_startIndex, const size_t input_key_endIndex, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType);
+
+// 1. JSON API (compiled path)
+int                  json_path_compile(const char * input_keys, const size_t input_keys_length, JSON_Path ** output_path);
+int                     json_path_free(JSON_Path * path);
+int                     json_path_eval(const JSON_Path * path, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType);
+int                 json_path_evalTape(const JSON_Path * path, const JSON_Tape * tape, const size_t input_tapeIndex, size_t * output_tapeIndex);
+int               json_path_compileSet(const char ** input_keys_list, const size_t input_keys_count, JSON_Path_Set ** output_set);
+int                  json_path_freeSet(JSON_Path_Set * set);
+int                  json_path_evalSet(const JSON_Path_Set * set, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Value_Range * output_values);
+
+// 1. JSON API (arena)
+int                                 json_arena_create(const size_t input_chunk_size, JSON_Arena ** output_arena);
+int                                  json_arena_alloc(JSON_Arena * arena, const size_t input_size, void ** output_pointer);
+int                                  json_arena_reset(JSON_Arena * arena);
+int                                   json_arena_free(JSON_Arena * arena);
+int             json_object_getKeyValuePairList_arena(JSON_Arena * arena, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size);
+int              json_array_getKeyValuePairList_arena(JSON_Arena * arena, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size);
+int                    json_getKeyValuePairList_arena(JSON_Arena * arena, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size);
+
+// 1. JSON API (view)
+int                          json_getKeyValueViewList(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_View * output_views, const size_t output_views_capacity, size_t * output_views_size);
+
+// 1. JSON API (iterator)
+int              json_array_iter_init(JSON_Iter * iter, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex);
+int              json_array_iter_next(JSON_Iter * iter, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType);
+int             json_object_iter_init(JSON_Iter * iter, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex);
+int             json_object_iter_next(JSON_Iter * iter, size_t * output_key_startIndex, size_t * output_key_endIndex, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType);
+
+// 1. JSON API (array position index)
+int                 json_array_index_create(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, const size_t input_interval, JSON_Array_Index ** output_index);
+int                   json_array_index_free(JSON_Array_Index * index);
+int     json_array_index_getValueByPosition(JSON_Array_Index * index, const size_t input_array_position, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType);
+
+// 1. JSON API (integer)
+int                     json_number_toInt64(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, int64_t * output_int64, int * output_error);
+int                    json_number_toUInt64(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, uint64_t * output_uint64, int * output_error);
+int                       json_getInt64ByJS(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, const char * input_keys, const size_t input_keys_length, int64_t * output_int64, int * output_error);
+
+// 1. JSON API (unescape)
+int                    json_string_unescape(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, char * output_buffer, const size_t output_buffer_size, size_t * output_length);
+int                    json_string_getSlice(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, const char ** output_slice, size_t * output_slice_length);
+
+// 1. JSON API (error)
+int                       json_getLastError(JSON_Error * output_error);
+const char *            json_error_toString(int code);
+
+// 1. JSON API (push parser)
+int                        json_feed_create(JSON_Feed_Callback input_callback, void * input_user_data, JSON_Feed ** output_feed);
+int                               json_feed(JSON_Feed * feed, const char * input_chunk, const size_t input_length);
+int                           json_feed_end(JSON_Feed * feed);
+int                          json_feed_free(JSON_Feed * feed);
+
+// 1. JSON API (JSON Lines)
+int                         json_lines_read(const char * input_string, const size_t input_string_length, const size_t input_threads, const int input_ordered, JSON_Record_Callback input_process, JSON_Result_Callback input_deliver, void * input_user_data);
+
+// 1. JSON API (document)
+int                      json_document_open(const char * input_path, JSON_Document ** output_document);
+int                     json_document_close(JSON_Document * document);
+
+// 1. JSON API (parallel)
+int json_array_getKeyValuePairList_parallel(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, const size_t input_threads, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size);
+int                     json_path_evalBatch(const JSON_Path_Set * set, const char * const * input_strings, const size_t * input_lengths, const size_t input_count, const size_t input_threads, JSON_Value_Range * output_values);
+
+// 1. JSON API (path cache)
+int                       json_cache_create(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, const size_t input_capacity, JSON_Cache ** output_cache);
+int                         json_cache_free(JSON_Cache * cache);
+int                 json_cache_getValueByJS(JSON_Cache * cache, const char * input_keys, const size_t input_keys_length, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType);
+
+// 1. JSON API (intern table)
+int                      json_intern_create(const size_t input_value_length, JSON_Intern ** output_intern);
+int                        json_intern_free(JSON_Intern * intern);
+int                      json_intern_string(JSON_Intern * intern, const char * input_string, const size_t input_string_length, const char ** output_string);
+int  json_object_getKeyValuePairList_intern(JSON_Arena * arena, JSON_Intern * intern, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size);
+int   json_array_getKeyValuePairList_intern(JSON_Arena * arena, JSON_Intern * intern, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size);
+int         json_getKeyValuePairList_intern(JSON_Arena * arena, JSON_Intern * intern, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size);
+
 // 2. Internal Function
 int json_object_getKeyValuePairList(const char * input_string, const int input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, int * output_keyValuePairList_size);
 int  json_array_getKeyValuePairList(const char * input_string, const int input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, int * output_keyValuePairList_size);
 int            json_getKeyValuePair(const char * input_string, const int input_string_startIndex, int * output_key_startIndex, int * output_key_endIndex, int * output_value_startIndex, int * output_value_endIndex, int * output_value_jsonType);
 int                     json_getKey(const char * input_string, const int input_string_startIndex, int * output_key_startIndex, int * output_key_endIndex, int * output_key_jsonType);
 
+// 2. Internal Function (length-bounded)
+int json_object_getKeyValuePairList_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size);
+int  json_array_getKeyValuePairList_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size);
+int            json_getKeyValuePair_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, size_t * output_key_startIndex, size_t * output_key_endIndex, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType);
+int                     json_getKey_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, size_t * output_key_startIndex, size_t * output_key_endIndex, int * output_key_jsonType);
+
+// 2. Internal Function (heap or arena)
+int json_object_getKeyValuePairList_alloc(JSON_Arena * arena, JSON_Intern * intern, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size);
+int  json_array_getKeyValuePairList_alloc(JSON_Arena * arena, JSON_Intern * intern, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size);
+
+// 2. Internal Function (view)
+int json_object_getKeyValueViewList_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_View * output_views, const size_t output_views_capacity, size_t * output_views_size);
+int  json_array_getKeyValueViewList_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_View * output_views, const size_t output_views_capacity, size_t * output_views_size);
+
 // 3. Get Value Function
 int           json_getValue(const char * input_string, const int input_string_startIndex, int * output_endIndex, int * output_jsonType);
 int json_getObjectInShallow(const char * input_string, const int input_string_startIndex, int * output_endIndex);
@@ -28,6 +213,15 @@ int          json_getString(const char * input_string, const int input_string_st
 int         json_getBoolean(const char * input_string, const int input_string_startIndex, int * output_endIndex);
 int            json_getNull(const char * input_string, const int input_string_startIndex, int * output_endIndex);
 
+// 3. Get Value Function (length-bounded)
+int           json_getValue_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, size_t * output_endIndex, int * output_jsonType);
+int json_getObjectInShallow_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, size_t * output_endIndex);
+int  json_getArrayInShallow_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, size_t * output_endIndex);
+int          json_getNumber_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, size_t * output_endIndex);
+int          json_getString_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, size_t * output_endIndex);
+int         json_getBoolean_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, size_t * output_endIndex);
+int            json_getNull_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, size_t * output_endIndex);
+
 // 4. Utility Function
 int json_util_getNextCharacter(const char * string, int * index);
 int json_util_printSubstring(const char * string, const int startIndex, const int endIndex);
@@ -35,6 +229,379 @@ int json_util_allocSubstring(const char * string, const int startIndex, const in
 int json_util_allocStringByInteger(const int number, char ** string);
 int json_util_stringCompare(const char * s1, const int s1_startIndex, const int s1_endIndex, const char * s2, const int s2_startIndex, const int s2_endIndex);
 
+// 4. Utility Function (length-bounded)
+int json_util_getNextCharacter_n(const char * string, const size_t length, size_t * index);
+int json_util_printSubstring_n(const char * string, const size_t startIndex, const size_t endIndex);
+int json_util_allocSubstring_n(const char * string, const size_t startIndex, const size_t endIndex, char ** substring);
+int json_util_allocStringBySize_n(const size_t number, char ** string);
+int json_util_stringCompare_n(const char * s1, const size_t s1_startIndex, const size_t s1_endIndex, const char * s2, const size_t s2_startIndex, const size_t s2_endIndex);
+static inline char json_util_charAt(const char * string, const size_t length, const size_t index);
+static inline int json_util_indexToInt(const size_t index);
+static inline char json_util_skipWhitespace(const char * string, const size_t length, size_t * index);
+static const unsigned char json_util_whitespace[256];
+static inline int json_util_matchWord(const char * string, const size_t length, const size_t index, const char * word);
+
+// 5. Structural Index Function
+
+// masks of the characters in 64-byte block
+typedef struct json_block_masks_t {
+    uint64_t quote;
+    uint64_t backslash;
+    uint64_t left_curly;
+    uint64_t right_curly;
+    uint64_t left_square;
+    uint64_t right_square;
+    uint64_t colon;
+    uint64_t comma;
+    uint64_t whitespace;
+} JSON_Block_Masks;
+
+// 64-byte block in vector registers
+typedef struct json_block_vectors_t {
+#if defined(__AVX2__)
+    __m256i chunk[2];
+#elif defined(__SSE2__)
+    __m128i chunk[4];
+#else
+    const char * bytes;
+#endif
+} JSON_Block_Vectors;
+
+static inline void json_simd_loadVectors(const char * block, JSON_Block_Vectors * vectors);
+static inline uint64_t json_simd_matchMask(const JSON_Block_Vectors * vectors, const char c);
+static inline void json_simd_classifyBlock(const char * block, JSON_Block_Masks * masks);
+static inline uint64_t json_simd_escapedMask(const uint64_t backslash, uint64_t * carry);
+static inline uint64_t json_simd_prefixXor(uint64_t bitmask);
+static inline const char * json_simd_loadBlock(const char * string, const size_t length, const size_t index, char * padding, size_t * output_size);
+int          json_index_findStructurals(JSON_Index * index);
+int            json_index_checkBrackets(const JSON_Index * index);
+int                 json_index_findSlot(const JSON_Index * index, const size_t input_string_startIndex, size_t * output_slot);
+int                 json_index_getValue(const JSON_Index * index, const size_t slot, size_t * output_endIndex, int * output_jsonType, size_t * output_nextSlot);
+int      json_index_object_getSlotByKey(const JSON_Index * index, const size_t slot, const char * input_key, const size_t input_key_startIndex, const size_t input_key_endIndex, size_t * output_slot);
+int  json_index_array_getSlotByPosition(const JSON_Index * index, const size_t slot, const size_t input_array_position, size_t * output_slot);
+int                json_index_getResult(const JSON_Index * index, const size_t slot, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType);
+int             json_simd_skipContainer(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, const char left, const char right, size_t * output_endIndex);
+
+// 6. Tape Function
+//
+// The tape is an array of 64-bit words, the first word of each entry is the tag (8 bits) and the string offset (56 bits).
+//
+//  '{' '['  - 2 words, the string offset of left bracket, the tape index of the matched end entry
+//  '}' ']'  - 2 words, the string offset of right bracket, the tape index of the matched open entry
+//  'k'      - 3 words, the string offset of the key, the end offset of the key, the hash of the key characters
+//  '"'      - 2 words, the string offset of the string, the end offset of the string
+//  'l' 'd'  - 3 words, the string offset of the number, the end offset of the number, the int64 or double value
+//  't' 'f' 'n' - 1 word, the string offset of true, false or null
+#define JSON_TAPE_PAYLOAD_MASK  ((((uint64_t) 1) << 56) - 1)
+#define JSON_TAPE_ENTRY(tag, offset) (((uint64_t) (unsigned char) (tag) << 56) | ((uint64_t) (offset) & JSON_TAPE_PAYLOAD_MASK))
+#define JSON_TAPE_TAG(entry)     ((char) ((entry) >> 56))
+#define JSON_TAPE_PAYLOAD(entry) ((size_t) ((entry) & JSON_TAPE_PAYLOAD_MASK))
+
+int                json_tape_append(JSON_Tape * tape, const uint64_t word_0, const uint64_t word_1, const uint64_t word_2, const size_t size);
+int          json_tape_appendNumber(JSON_Tape * tape, const size_t startIndex, const size_t endIndex);
+int                 json_tape_parse(JSON_Tape * tape);
+static inline size_t json_tape_nextIndex(const JSON_Tape * tape, const size_t tapeIndex);
+size_t         json_tape_object_findKey(const JSON_Tape * tape, const size_t tapeIndex, const char * key, const size_t key_length, const uint64_t key_hash);
+uint64_t             json_util_hash(const char * string, const size_t length);
+
+// 7. Lookup Function
+typedef struct json_lookup_slot_t {
+    uint64_t hash;          // the hash of the key characters (including the quotes)
+    size_t   key_startIndex;    // JSON_INDEX_NONE when the slot is empty
+    size_t   key_endIndex;
+    size_t   value_startIndex;
+    size_t   value_endIndex;
+    int      value_jsonType;
+} JSON_Lookup_Slot;
+
+struct json_lookup_object_t {
+    size_t startIndex;      // the start index of the object, JSON_INDEX_NONE when the record is empty
+    size_t count;           // the lookup count on the object
+    int    failed;          // the hash table can't be built, keep the linear scan
+    size_t endIndex;        // the end index of the object, set when the hash table is built
+
+    JSON_Lookup_Slot * slots;   // the open addressing hash table, NULL until it's built
+    size_t             capacity;
+};
+
+JSON_Lookup_Object * json_lookup_findObject(JSON_Lookup * lookup, const size_t startIndex);
+int                  json_lookup_buildTable(const JSON_Lookup * lookup, JSON_Lookup_Object * object);
+JSON_Lookup_Slot *     json_lookup_findSlot(const JSON_Lookup * lookup, const JSON_Lookup_Object * object, const char * key, const size_t key_length);
+static inline size_t    json_util_hashIndex(const size_t index);
+
+// 8. Path Set Function
+#define JSON_PATH_SET_SCRATCH_SIZE  256     // the matched flags of json_path_evalSet on the stack, the larger set allocates them
+
+size_t     json_pathSet_addNode(JSON_Path_Set * set, const JSON_Path_Step * step, const char * keys);
+int         json_pathSet_insert(JSON_Path_Set * set, const size_t pathIndex);
+void          json_pathSet_eval(const JSON_Path_Set * set, const char * string, const size_t length, const size_t startIndex, unsigned char * scratch, JSON_Value_Range * outputs);
+void         json_pathSet_match(const JSON_Path_Set * set, const size_t node, const char * string, const size_t length, const size_t value_startIndex, const size_t value_endIndex, const int value_jsonType, unsigned char * scratch, JSON_Value_Range * outputs);
+void    json_pathSet_walkObject(const JSON_Path_Set * set, const size_t node, const char * string, const size_t length, const size_t startIndex, unsigned char * scratch, JSON_Value_Range * outputs);
+void     json_pathSet_walkArray(const JSON_Path_Set * set, const size_t node, const char * string, const size_t length, const size_t startIndex, unsigned char * scratch, JSON_Value_Range * outputs);
+
+// 9. Arena Function
+#define JSON_ARENA_CHUNK_SIZE        (64 * 1024)
+#define JSON_ARENA_ALIGNMENT         16
+#define JSON_ARENA_CHUNK_HEADER_SIZE ((sizeof(JSON_Arena_Chunk) + JSON_ARENA_ALIGNMENT - 1) & ~(size_t) (JSON_ARENA_ALIGNMENT - 1))
+#define JSON_ARENA_CHUNK_DATA(chunk) ((char *) (chunk) + JSON_ARENA_CHUNK_HEADER_SIZE)
+
+int             json_arena_allocZero(JSON_Arena * arena, const size_t size, void ** pointer);
+int        json_arena_allocSubstring(JSON_Arena * arena, const char * string, const size_t startIndex, const size_t endIndex, char ** substring);
+int     json_arena_allocStringBySize(JSON_Arena * arena, const size_t number, char ** string);
+
+// 10. Iterator Function
+#define JSON_ITER_STATE_ERROR      0    // the iterator is not initialized or the container is invalid
+#define JSON_ITER_STATE_VALUE      1    // the next value (or key) is at the index
+#define JSON_ITER_STATE_SEPARATOR  2    // the comma or the right bracket is behind the index
+#define JSON_ITER_STATE_END        3
+
+int        json_iter_init(JSON_Iter * iter, const char * string, const size_t length, const size_t startIndex, const char left, const char right);
+int     json_iter_advance(JSON_Iter * iter, const char right);
+
+#define JSON_ARRAY_INDEX_INTERVAL  64
+
+// 11. Number Function
+#define JSON_NUMBER_IS_DIGIT(c)            ((c) >= '0' && (c) <= '9')
+#define JSON_NUMBER_SMALLEST_POWER_OF_TEN  (-342)
+#define JSON_NUMBER_LARGEST_POWER_OF_TEN   308
+
+int                    json_number_parse_n(const char * string, const size_t length, const size_t startIndex, size_t * endIndex, double * number);
+void               json_number_eiselLemire(uint64_t mantissa, const int64_t exponent, uint64_t * bits);
+static inline void    json_number_multiply(const uint64_t a, const uint64_t b, uint64_t * high, uint64_t * low);
+int                  json_number_parseSlow(const char * string, const size_t startIndex, const size_t endIndex, double * number);
+static const uint64_t json_number_powerOfFive[2 * (JSON_NUMBER_LARGEST_POWER_OF_TEN - JSON_NUMBER_SMALLEST_POWER_OF_TEN + 1)];
+
+// 12. Integer Function
+int                      json_number_parseInteger_n(const char * string, const size_t length, const size_t startIndex, uint64_t * magnitude, int * negative);
+static inline int        json_number_loadEightBytes(const char * string, const size_t length, const size_t index, uint64_t * word);
+static inline int          json_number_isEightDigits(const uint64_t word);
+static inline uint32_t json_number_parseEightDigits(uint64_t word);
+
+// 13. String Function
+int                json_string_unescape_n(const char * string, const size_t length, const size_t startIndex, char * buffer, const size_t buffer_size, size_t * output_length, size_t * endIndex);
+static inline size_t json_string_skipPlain(const char * string, const size_t length, size_t index);
+static inline int       json_string_parseHex(const char * string, const size_t length, const size_t index, uint32_t * code);
+static inline size_t   json_string_encodeUTF8(const uint32_t code, char * utf8);
+static inline void          json_string_write(char * buffer, const size_t buffer_size, size_t * index, const char * source, const size_t size);
+static inline int  json_string_skipCharacters(const char * string, const size_t length, const size_t index, size_t * output_index);
+static inline int     json_string_validateUTF8(const char * string, const size_t length, const size_t index, size_t * output_size);
+
+// 14. Error and Value Kernel Function
+JSON_COLD int                 json_error_set(const int code, const size_t offset);
+static inline JSON_HOT int    json_value_scan(const char * string, const size_t length, const size_t startIndex, size_t * endIndex, int * jsonType);
+static inline JSON_HOT int   json_number_scan(const char * string, const size_t length, const size_t startIndex, size_t * endIndex);
+static inline JSON_HOT int   json_string_scan(const char * string, const size_t length, const size_t startIndex, size_t * endIndex);
+static inline JSON_HOT int  json_boolean_scan(const char * string, const size_t length, const size_t startIndex, size_t * endIndex);
+static inline JSON_HOT int     json_null_scan(const char * string, const size_t length, const size_t startIndex, size_t * endIndex);
+static inline JSON_HOT int json_keyValuePair_scan(const char * string, const size_t length, size_t * index, size_t * key_startIndex, size_t * key_endIndex, size_t * value_startIndex, size_t * value_endIndex, int * value_jsonType);
+
+// 15. Push Parser Function
+#define JSON_FEED_STATE_VALUE        0  // the value is expected
+#define JSON_FEED_STATE_FIRST_VALUE  1  // the value or right square bracket is expected behind the left square bracket
+#define JSON_FEED_STATE_FIRST_KEY    2  // the key or right curly bracket is expected behind the left curly bracket
+#define JSON_FEED_STATE_KEY          3  // the key is expected behind the comma
+#define JSON_FEED_STATE_COLON        4
+#define JSON_FEED_STATE_SEPARATOR    5  // the comma or right bracket is expected behind the value
+#define JSON_FEED_STATE_DONE         6  // the root value is complete, only the whitespace is accepted
+#define JSON_FEED_STATE_STOPPED      7  // the parsing is stopped by the callback
+#define JSON_FEED_STATE_ERROR        8
+
+#define JSON_FEED_TOKEN_NONE     0
+#define JSON_FEED_TOKEN_STRING   1
+#define JSON_FEED_TOKEN_KEY      2
+#define JSON_FEED_TOKEN_NUMBER   3
+#define JSON_FEED_TOKEN_LITERAL  4
+
+struct json_feed_frame_t {
+    int    jsonType;        // JSON_TYPE_OBJECT or JSON_TYPE_ARRAY
+    size_t path_size;       // the path size of the object or array
+    size_t position;        // the count of the values in the array
+};
+
+int            json_feed_reserve(char ** buffer, size_t * capacity, const size_t size);
+int         json_feed_appendPath(JSON_Feed * feed, const char * string, const size_t length);
+int         json_feed_beginValue(JSON_Feed * feed);
+int           json_feed_endValue(JSON_Feed * feed);
+int          json_feed_openFrame(JSON_Feed * feed, const int jsonType, const char * bracket);
+int         json_feed_closeFrame(JSON_Feed * feed, const char * bracket);
+int        json_feed_finishToken(JSON_Feed * feed, const char * chunk, const size_t startIndex, const size_t endIndex);
+static inline size_t json_feed_scanToken(JSON_Feed * feed, const char * chunk, const size_t length, size_t index);
+
+// 16. JSON Lines Function
+#define JSON_LINES_BATCH_SIZE  (64 * 1024)  // the bytes of the records handed to a worker at a time
+
+typedef struct json_lines_reader_t {
+    const char * string;
+    size_t       length;
+    int          ordered;
+
+    JSON_Record_Callback process;
+    JSON_Result_Callback deliver;
+    void *               user_data;
+
+#if JSON_THREADS
+    pthread_mutex_t mutex;      // guards the fields below and the result callback
+    pthread_cond_t  turn;       // signaled when a batch is delivered in the ordered mode
+#endif
+
+    size_t cursor;          // the start index of the next batch
+    size_t line;            // the line index at the cursor
+    size_t batches;         // the count of the batches handed out
+    size_t delivered;       // the count of the batches delivered in the ordered mode
+    int    result;          // 0 while reading, 1 if it's stopped by the callback, -1 on failure
+
+} JSON_Lines_Reader;
+
+typedef struct json_lines_record_t {
+    size_t     index;
+    void *     result;
+    JSON_Error error;       // JSON_ERROR_NONE unless the record is malformed
+
+} JSON_Lines_Record;
+
+typedef struct json_lines_worker_t {
+    JSON_Lines_Reader * reader;
+    JSON_Tape           tape;       // reused by the records, only the entries are allocated
+    JSON_Arena *        scratch;
+
+    JSON_Lines_Record * records;    // the records of the batch waiting for the turn in the ordered mode
+    size_t              size;
+    size_t              capacity;
+
+} JSON_Lines_Worker;
+
+void *                       json_lines_work(void * worker);
+int                  json_lines_processBatch(JSON_Lines_Worker * worker, const size_t startIndex, const size_t endIndex, size_t line);
+int                 json_lines_deliverRecord(JSON_Lines_Reader * reader, const JSON_Lines_Record * record);
+static inline void           json_lines_lock(JSON_Lines_Reader * reader);
+static inline void         json_lines_unlock(JSON_Lines_Reader * reader);
+static inline size_t  json_lines_findNewline(const char * string, const size_t length, size_t index);
+static inline size_t json_lines_countNewlines(const char * string, size_t index, const size_t endIndex);
+
+// 17. Document Function
+#define JSON_DOCUMENT_ALIGNMENT   64            // the alignment of the read buffer
+#define JSON_DOCUMENT_READ_SIZE   (64 * 1024)   // the first buffer size of the file with unknown size
+
+int  json_document_map(JSON_Document * document, const int fd, const size_t length);
+int json_document_read(JSON_Document * document, const int fd, const size_t length);
+
+// 18. Parallel Array Function
+// the array smaller than two chunks is got in the calling thread
+#ifndef JSON_PARALLEL_CHUNK_SIZE
+#define JSON_PARALLEL_CHUNK_SIZE  (1024 * 1024)
+#endif
+
+typedef struct json_parallel_chunk_t {
+    const char * string;
+    size_t       length;
+    size_t       startIndex;    // the chunk is [startIndex, endIndex), the character before it is not a reverse solidus
+    size_t       endIndex;
+
+    int64_t depth_delta[2];     // the depth change if the chunk starts outside [0] or inside [1] a string
+    int     inString_end[2];    // the chunk ends inside a string if it starts outside [0] or inside [1] a string
+    int     inString;           // the resolved state at the start of the chunk
+    int64_t depth;              // the resolved depth at the start of the chunk, the array itself is depth 1
+
+    size_t first;               // the left square bracket or comma before the first element of the chunk, JSON_INDEX_NONE if there is none
+    size_t next;                // the comma where the slice stops, JSON_INDEX_NONE if the slice reaches the right square bracket
+    int    failed;
+
+    JSON_Key_Value_Pair * head;     // the pairs of the elements behind the commas in the chunk
+    JSON_Key_Value_Pair * tail;
+    size_t                size;
+    size_t                base;     // the position of the first element of the slice
+
+} JSON_Parallel_Chunk;
+
+void       json_parallel_run(void * (* task)(void *), JSON_Parallel_Chunk * chunks, const size_t count);
+void *   json_parallel_scanChunk(void * chunk);
+void *  json_parallel_sliceChunk(void * chunk);
+void * json_parallel_assignKeys(void * chunk);
+size_t json_parallel_findFirst(const JSON_Parallel_Chunk * chunk);
+
+// 19. Batch Function
+#define JSON_BATCH_GRAIN  4     // the count of the documents taken from the own queue at a time
+
+typedef struct json_batch_t JSON_Batch;
+
+typedef struct json_batch_queue_t {
+#if JSON_THREADS
+    pthread_mutex_t mutex;
+#endif
+    size_t top;             // the next document taken by the owner
+    size_t bottom;          // behind the last document, the thieves take the documents in front of it
+
+} JSON_Batch_Queue;
+
+typedef struct json_batch_worker_t {
+    JSON_Batch *     batch;
+    size_t           id;
+    JSON_Batch_Queue queue;
+    unsigned char *  scratch;   // the matched flags of the set walk, reused for every document of the worker
+
+} JSON_Batch_Worker;
+
+struct json_batch_t {
+    const JSON_Path_Set * set;
+    const char * const *  strings;
+    const size_t *        lengths;
+    JSON_Value_Range *    values;
+
+    JSON_Batch_Worker * workers;
+    size_t              size;
+};
+
+void *            json_batch_work(void * worker);
+int              json_batch_steal(JSON_Batch_Worker * worker);
+static inline void json_batch_eval(const JSON_Batch * batch, const size_t document, unsigned char * scratch);
+
+// 20. Cache Function
+#define JSON_CACHE_CAPACITY  256    // the count of the cached prefixes when the capacity is 0
+
+struct json_cache_step_t {
+    int      type;              // JSON_TYPE_STRING for the key, JSON_TYPE_NUMBER for the array position
+    size_t   key_startIndex;    // the quoted key in the keys
+    size_t   key_endIndex;
+    size_t   position;
+    size_t   prefix_length;     // the length of the canonical prefix ending at the step
+    uint64_t prefix_hash;
+};
+
+struct json_cache_entry_t {
+    uint64_t hash;              // the hash of the canonical prefix
+    char *   prefix;            // the canonical prefix, e.g. ["contents"][3]
+    size_t   prefix_length;
+    size_t   prefix_capacity;
+
+    size_t value_startIndex;
+    size_t value_endIndex;
+    int    value_jsonType;
+
+    size_t chain;               // the next entry in the hash chain
+    size_t newer;               // the neighbours in the LRU list
+    size_t older;
+};
+
+int               json_cache_parseKeys(JSON_Cache * cache, const char * keys, const size_t keys_length, size_t * output_size);
+size_t                 json_cache_find(const JSON_Cache * cache, const JSON_Cache_Step * step);
+void                 json_cache_insert(JSON_Cache * cache, const JSON_Cache_Step * step, const size_t value_startIndex, const size_t value_endIndex, const int value_jsonType);
+static inline void   json_cache_unlink(JSON_Cache * cache, const size_t entry);
+static inline void json_cache_pushNewest(JSON_Cache * cache, const size_t entry);
+
+// 21. Intern Function
+#define JSON_INTERN_VALUE_LENGTH  32    // the maximum length of the interned values when the length is 0
+
+struct json_intern_slot_t {
+    uint64_t     hash;
+    const char * string;    // NULL when the slot is empty
+    size_t       length;
+};
+
+int                          json_intern_find(JSON_Intern * intern, const char * string, const size_t length, char ** output_string);
+int                json_intern_allocSubstring(JSON_Arena * arena, JSON_Intern * intern, const char * string, const size_t startIndex, const size_t endIndex, char ** substring);
+int             json_intern_allocStringBySize(JSON_Arena * arena, JSON_Intern * intern, const size_t number, char ** string);
+static inline JSON_Intern * json_intern_forValue(JSON_Intern * intern, const int jsonType, const size_t length);
+
 
 // 1-1. JSON type description
 const char * json_type_toString(int type) {
@@ -46,242 +613,334 @@ const char * json_type_toString(int type) {
         case JSON_TYPE_BOOLEAN: return "boolean";
         case JSON_TYPE_NULL:    return "null";
         default:
-            printf("error: unknown type (%d)\n", type);
+            JSON_LOG("error: unknown type (%d)\n", type);
             return "unknown";
     }
 }
 
 // 1-2. Convert JSON number to double
 int json_number_toDouble(const char * input_string, const int input_string_startIndex, double * output_double) {
-    int endIndex;
-    if (json_getNumber(input_string, input_string_startIndex, &endIndex) != 0) {
-        return -1;
-    }
-
-    char * string;
-    if (json_util_allocSubstring(input_string, input_string_startIndex, endIndex, &string) != 0) {
-        return -1;
+    if (input_string_startIndex < 0) {
+        JSON_LOG("%s: input_string_startIndex (%d) should not be negative\n", __func__, input_string_startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
     }
 
-    *output_double = atof(string);
-
-    free(string);
-    return 0;
+    return json_number_toDouble_n(input_string, JSON_LENGTH_UNBOUNDED, input_string_startIndex, output_double);
 }
 
 // 1-3. Convert JSON string to character array
 int json_string_toString(const char * input_string, const int input_string_startIndex, char ** output_string) {
-    const char DEBUG = 0;
+    if (input_string_startIndex < 0) {
+        JSON_LOG("%s: input_string_startIndex (%d) should not be negative\n", __func__, input_string_startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
 
-    int endIndex;
-    if (json_getString(input_string, input_string_startIndex, &endIndex) != 0) {
-        return -1;
+    return json_string_toString_n(input_string, JSON_LENGTH_UNBOUNDED, input_string_startIndex, output_string);
+}
+
+// 1-4. Get the value with start & end index and JSON type.
+int json_getValueByJS(const char * input_string, const int input_string_startIndex, const char * input_keys, const int input_keys_startIndex, int * output_value_startIndex, int * output_value_endIndex, int * output_value_jsonType) {
+    // check arguments
+    if (input_string_startIndex < 0) {
+        JSON_LOG("%s: input_string_startIndex (%d) should not be negative\n", __func__, input_string_startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
     }
 
-    // check empty string
-    if (input_string_startIndex + 1 == endIndex) {
-        *output_string = malloc(sizeof(char));
-        if (*output_string == NULL) {
-            printf("%s: out of memory\n", __func__);
-            return -1;
-        }
+    if (input_keys_startIndex < 0) {
+        JSON_LOG("%s: input_keys_startIndex (%d) should not be negative\n", __func__, input_keys_startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
 
-        **output_string = '\0';
-        return 0;
+    if (output_value_startIndex == NULL) {
+        JSON_LOG("%s: output_value_startIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
     }
 
-    char * string;
-    if (json_util_allocSubstring(input_string, input_string_startIndex + 1, endIndex - 1, &string) != 0) {
-        return -1;
+    if (output_value_endIndex == NULL) {
+        JSON_LOG("%s: output_value_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
     }
 
-    int i = 0, j = 0;
-    while (string[i] != '\0') {
+    size_t value_startIndex = JSON_INDEX_NONE, value_endIndex = JSON_INDEX_NONE;
+    int result = json_getValueByJS_n(input_string, JSON_LENGTH_UNBOUNDED, input_string_startIndex, input_keys, JSON_LENGTH_UNBOUNDED, input_keys_startIndex, &value_startIndex, &value_endIndex, output_value_jsonType);
 
-        // 1. check reverse solidus
-        if (string[i] != '\\') {
-            goto copy_character;
-        }
+    *output_value_startIndex = json_util_indexToInt(value_startIndex);
+    *output_value_endIndex   = json_util_indexToInt(value_endIndex);
+    return result;
+}
 
-        // 2. check the next character
-        if (string[i + 1] == 'u') {
-            if (DEBUG) {
-                printf("%s: This library is not support unicode converting.\n", __func__);
-            }
-            goto copy_character;
-        }
-        i++;
+// 1-5. Get value by key with value start & end index and JSON type.
+int json_object_getValueByKey(const char * input_string, const int input_string_startIndex, const char * input_key, const int input_key_startIndex, const int input_key_endIndex, int * output_value_startIndex, int * output_value_endIndex, int * output_value_jsonType) {
+    // check input arguments
+    if (input_string_startIndex < 0) {
+        JSON_LOG("%s: input_string_startIndex (%d) should not be negative\n", __func__, input_string_startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
 
-        if (DEBUG) {
-            printf("\\%c = ", string[i]);
-        }
+    if (input_key_startIndex < 0) {
+        JSON_LOG("%s: input_key_startIndex (%d) should not be negative\n", __func__, input_key_startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
 
-        switch (string[i]) {
-            case 'b':
-                string[i] = '\b';
-                break;
+    if (input_key_endIndex < input_key_startIndex) {
+        JSON_LOG("%s: input_key_endIndex (%d) should greater than input_key_startIndex (%d)\n", __func__, input_key_endIndex, input_key_startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
 
-            case 'f':
-                string[i] = '\f';
-                break;
+    if (output_value_startIndex == NULL) {
+        JSON_LOG("%s: output_value_startIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
 
-            case 'n':
-                string[i] = '\n';
-                break;
+    if (output_value_endIndex == NULL) {
+        JSON_LOG("%s: output_value_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
 
-            case 'r':
-                string[i] = '\r';
-                break;
+    size_t value_startIndex = JSON_INDEX_NONE, value_endIndex = JSON_INDEX_NONE;
+    int result = json_object_getValueByKey_n(input_string, JSON_LENGTH_UNBOUNDED, input_string_startIndex, input_key, input_key_startIndex, input_key_endIndex, &value_startIndex, &value_endIndex, output_value_jsonType);
 
-            case 't':
-                string[i] = '\t';
-                break;
+    *output_value_startIndex = json_util_indexToInt(value_startIndex);
+    *output_value_endIndex   = json_util_indexToInt(value_endIndex);
+    return result;
+}
 
-            // case '\"':
-            // case '\\':
-            // case '/':
-            default:
-                break;
-        }
+// 1-6. Get array value by position with value start & end index and JSON type.
+int json_array_getValueByPosition(const char * input_string, const int input_string_startIndex, const int input_array_position, int * output_value_startIndex, int * output_value_endIndex, int * output_value_jsonType) {
+    // check input arguments
+    if (input_string_startIndex < 0) {
+        JSON_LOG("%s: input_string_startIndex (%d) should not be negative\n", __func__, input_string_startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
 
-        if (DEBUG) {
-            printf("0x%02x\n", string[i]);
-        }
+    if (input_array_position < 0) {
+        JSON_LOG("%s: input_array_position (%d) should not be negative\n", __func__, input_array_position);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
 
-copy_character:
-        string[j++] = string[i++];
+    if (output_value_startIndex == NULL) {
+        JSON_LOG("%s: output_value_startIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
     }
 
-    // allocate output string
-    if (json_util_allocSubstring(string, 0, j - 1, output_string) != 0) {
-        return -1;
+    if (output_value_endIndex == NULL) {
+        JSON_LOG("%s: output_value_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    size_t value_startIndex = JSON_INDEX_NONE, value_endIndex = JSON_INDEX_NONE;
+    int result = json_array_getValueByPosition_n(input_string, JSON_LENGTH_UNBOUNDED, input_string_startIndex, input_array_position, &value_startIndex, &value_endIndex, output_value_jsonType);
+
+    *output_value_startIndex = json_util_indexToInt(value_startIndex);
+    *output_value_endIndex   = json_util_indexToInt(value_endIndex);
+    return result;
+}
+
+// 1-7. object or array get key value pair list
+int json_getKeyValuePairList(const char * input_string, const int input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, int * output_keyValuePairList_size) {
+    if (json_object_getKeyValuePairList(input_string, input_string_startIndex, output_keyValuePairList, output_keyValuePairList_size) == 0) {
+        return 0;
+    }
+
+    if (json_array_getKeyValuePairList(input_string, input_string_startIndex, output_keyValuePairList, output_keyValuePairList_size) == 0) {
+        return 0;
     }
 
-    free(string);
+    return -1;
+}
+
+// 1-8. Free JSON Key Value Pair in recursive
+int json_keyValuePair_free(JSON_Key_Value_Pair * keyValuePair) {
+
+    // free the list in a loop, the list of a huge array is too long to be freed by recursion
+    while (keyValuePair != NULL) {
+        JSON_Key_Value_Pair * next = keyValuePair->next;
+        free(keyValuePair->key);
+        free(keyValuePair->value);
+        free(keyValuePair);
+        keyValuePair = next;
+    }
     return 0;
 }
 
-// 1-4. Get the value with start & end index and JSON type.
-int json_getValueByJS(const char * input_string, const int input_string_startIndex, const char * input_keys, const int input_keys_startIndex, int * output_value_startIndex, int * output_value_endIndex, int * output_value_jsonType) {
-    const char DEBUG = 0;
+// 1-9. Convert JSON number to double (length-bounded)
+int json_number_toDouble_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, double * output_double) {
+    // check arguments
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_double == NULL) {
+        JSON_LOG("%s: output_double should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    // parse in place without allocation
+    size_t endIndex;
+    if (json_number_parse_n(input_string, input_string_length, input_string_startIndex, &endIndex, output_double) != 0) {
+        return json_error_set(JSON_ERROR_SYNTAX, input_string_startIndex);
+    }
+    return 0;
+}
 
+// 1-10. Convert JSON string to character array (length-bounded)
+int json_string_toString_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, char ** output_string) {
     // check arguments
+    if (output_string == NULL) {
+        JSON_LOG("%s: output_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_string = NULL;
+
     if (input_string == NULL) {
-        printf("%s: input_string should not be NULL\n", __func__);
-        return -1;
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
     }
 
-    if (input_string_startIndex < 0) {
-        printf("%s: input_string_startIndex (%d) should not be negative\n", __func__, input_string_startIndex);
-        return -1;
+    size_t endIndex;
+    if (json_string_scan(input_string, input_string_length, input_string_startIndex, &endIndex) != 0) {
+        return json_error_set(JSON_ERROR_SYNTAX, input_string_startIndex);
     }
 
-    if (input_keys == NULL) {
-        printf("%s: input_keys should not be NULL\n", __func__);
-        return -1;
+    // the unescaped string is never longer than the raw string
+    const size_t size = endIndex - input_string_startIndex - 1;
+    char * string = malloc(size + 1);
+    if (string == NULL) {
+        JSON_LOG("%s: out of memory\n", __func__);
+        return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
     }
 
-    if (input_keys_startIndex < 0) {
-        printf("%s: input_keys_startIndex (%d) should not be negative\n", __func__, input_keys_startIndex);
+    size_t length = 0;
+    if (json_string_unescape_n(input_string, input_string_length, input_string_startIndex, string, size, &length, &endIndex) != 0) {
+        free(string);
         return -1;
     }
 
+    string[length] = '\0';
+    *output_string = string;
+    return 0;
+}
+
+// 1-11. Get the value with start & end index and JSON type (length-bounded)
+int json_getValueByJS_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, const char * input_keys, const size_t input_keys_length, const size_t input_keys_startIndex, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType) {
+    const char DEBUG = 0;
+
+    // check arguments
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (input_keys == NULL) {
+        JSON_LOG("%s: input_keys should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
     if (output_value_startIndex == NULL) {
-        printf("%s: output_value_startIndex should not be NULL\n", __func__);
-        return -1;
+        JSON_LOG("%s: output_value_startIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
     }
 
     if (output_value_endIndex == NULL) {
-        printf("%s: output_value_endIndex should not be NULL\n", __func__);
-        return -1;
+        JSON_LOG("%s: output_value_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
     }
 
     if (output_value_jsonType == NULL) {
-        printf("%s: output_value_jsonType should not be NULL\n", __func__);
-        return -1;
+        JSON_LOG("%s: output_value_jsonType should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
     }
 
     // set output to default
-    *output_value_startIndex = -1;
-    *output_value_endIndex   = -1;
+    *output_value_startIndex = JSON_INDEX_NONE;
+    *output_value_endIndex   = JSON_INDEX_NONE;
     *output_value_jsonType   = -1;
 
-    int i = input_string_startIndex;
-    int key_i = input_keys_startIndex;
+    size_t i = input_string_startIndex;
+    size_t key_i = input_keys_startIndex;
 
-    int key_startIndex, key_endIndex, key_jsonType;
-    int value_startIndex, value_endIndex, value_jsonType;
+    size_t key_startIndex, key_endIndex;
+    int key_jsonType;
+    size_t value_startIndex, value_endIndex;
+    int value_jsonType;
 
 get_value_by_js_loop:
 
     // 1. get key
-    if (json_getKey(input_keys, key_i, &key_startIndex, &key_endIndex, &key_jsonType) != 0) {
+    if (json_getKey_n(input_keys, input_keys_length, key_i, &key_startIndex, &key_endIndex, &key_jsonType) != 0) {
         if (DEBUG) {
-            printf("%s: get key at %d failure\n", __func__, key_i);
+            JSON_LOG("%s: get key at %zu failure\n", __func__, key_i);
         }
-        return -1;
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
     }
 
     // 2-1. json object get value by key
     if (key_jsonType == JSON_TYPE_STRING) {
-        if (json_object_getValueByKey(input_string, i, input_keys, key_startIndex, key_endIndex, &value_startIndex, &value_endIndex, &value_jsonType) != 0) {
+        if (json_object_getValueByKey_n(input_string, input_string_length, i, input_keys, key_startIndex, key_endIndex, &value_startIndex, &value_endIndex, &value_jsonType) != 0) {
             if (DEBUG) {
-                printf("%s: ", __func__);
-                json_util_printSubstring(input_keys, key_startIndex, key_endIndex);
-                printf(" is not found\n");
+                JSON_LOG("%s: ", __func__);
+                json_util_printSubstring_n(input_keys, key_startIndex, key_endIndex);
+                JSON_LOG(" is not found\n");
             }
             return -1;
         }
 
         // key is found
         if (DEBUG) {
-            printf("%s: ", __func__);
-            json_util_printSubstring(input_keys, key_startIndex, key_endIndex);
-            printf(" = ");
-            json_util_printSubstring(input_string, value_startIndex, value_endIndex);
-            printf(" (%s)\n", json_type_toString(value_jsonType));
+            JSON_LOG("%s: ", __func__);
+            json_util_printSubstring_n(input_keys, key_startIndex, key_endIndex);
+            JSON_LOG(" = ");
+            json_util_printSubstring_n(input_string, value_startIndex, value_endIndex);
+            JSON_LOG(" (%s)\n", json_type_toString(value_jsonType));
         }
     }
 
     // 2-2. json array get value by position
     else if (key_jsonType == JSON_TYPE_NUMBER) {
         // convert key string to integer position
-        int j, position = 0;
+        size_t j, position = 0;
         for (j = key_startIndex; j <= key_endIndex; j++) {
+            if (position > (SIZE_MAX - 9) / 10) {
+                JSON_LOG("%s: the position at %zu is too large\n", __func__, key_startIndex);
+                return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+            }
             position = position * 10 + (input_keys[j] - 48);
         }
 
-        if (json_array_getValueByPosition(input_string, i, position, &value_startIndex, &value_endIndex, &value_jsonType) != 0) {
+        if (json_array_getValueByPosition_n(input_string, input_string_length, i, position, &value_startIndex, &value_endIndex, &value_jsonType) != 0) {
             if (DEBUG) {
-                printf("%s: ", __func__);
-                json_util_printSubstring(input_keys, key_startIndex, key_endIndex);
-                printf(" is not found\n");
+                JSON_LOG("%s: ", __func__);
+                json_util_printSubstring_n(input_keys, key_startIndex, key_endIndex);
+                JSON_LOG(" is not found\n");
             }
             return -1;
         }
 
         // key is found
         if (DEBUG) {
-            printf("%s: ", __func__);
-            json_util_printSubstring(input_keys, key_startIndex, key_endIndex);
-            printf(" = ");
-            json_util_printSubstring(input_string, value_startIndex, value_endIndex);
-            printf(" (%s)\n", json_type_toString(value_jsonType));
+            JSON_LOG("%s: ", __func__);
+            json_util_printSubstring_n(input_keys, key_startIndex, key_endIndex);
+            JSON_LOG(" = ");
+            json_util_printSubstring_n(input_string, value_startIndex, value_endIndex);
+            JSON_LOG(" (%s)\n", json_type_toString(value_jsonType));
         }
     }
 
     // 2-3. others, this might be BUG
     else {
-        printf("%s: [BUG] key type (%s) shoud be a string or integer\n", __func__, json_type_toString(value_jsonType));
+        JSON_LOG("%s: [BUG] key type (%s) shoud be a string or integer\n", __func__, json_type_toString(key_jsonType));
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
     }
 
     // 3. move to next key, and next value
     i = value_startIndex;
     key_i = key_endIndex + 2;
 
-    if (input_keys[key_i] == '\0') {
+    if (json_util_charAt(input_keys, input_keys_length, key_i) == '\0') {
         if (DEBUG) {
-            printf("%s: it's the end of the keys (%d)\n", __func__, key_i);
+            JSON_LOG("%s: it's the end of the keys (%zu)\n", __func__, key_i);
         }
 
         *output_value_startIndex = value_startIndex;
@@ -293,69 +952,59 @@ get_value_by_js_loop:
     goto get_value_by_js_loop;
 }
 
-// 1-5. Get value by key with value start & end index and JSON type.
-int json_object_getValueByKey(const char * input_string, const int input_string_startIndex, const char * input_key, const int input_key_startIndex, const int input_key_endIndex, int * output_value_startIndex, int * output_value_endIndex, int * output_value_jsonType) {
+// 1-12. Get value by key with value start & end index and JSON type (length-bounded)
+int json_object_getValueByKey_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, const char * input_key, const size_t input_key_startIndex, const size_t input_key_endIndex, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType) {
     const char DEBUG = 0;
 
     // check input arguments
     if (input_string == NULL) {
-        printf("%s: input_string should not be NULL\n", __func__);
-        return -1;
-    }
-
-    if (input_string_startIndex < 0) {
-        printf("%s: input_string_startIndex (%d) should not be negative\n", __func__, input_string_startIndex);
-        return -1;
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
     }
 
     if (input_key == NULL) {
-        printf("%s: input_key should not be NULL\n", __func__);
-        return -1;
-    }
-
-    if (input_key_startIndex < 0) {
-        printf("%s: input_key_startIndex (%d) should not be negative\n", __func__, input_key_startIndex);
-        return -1;
+        JSON_LOG("%s: input_key should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
     }
 
     if (input_key_endIndex < input_key_startIndex) {
-        printf("%s: input_key_endIndex (%d) should greater than input_key_startIndex (%d)\n", __func__, input_key_endIndex, input_key_startIndex);
-        return -1;
+        JSON_LOG("%s: input_key_endIndex (%zu) should greater than input_key_startIndex (%zu)\n", __func__, input_key_endIndex, input_key_startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
     }
 
     if (output_value_startIndex == NULL) {
-        printf("%s: output_value_startIndex should not be NULL\n", __func__);
-        return -1;
+        JSON_LOG("%s: output_value_startIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
     }
 
     if (output_value_endIndex == NULL) {
-        printf("%s: output_value_endIndex should not be NULL\n", __func__);
-        return -1;
+        JSON_LOG("%s: output_value_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
     }
 
     if (output_value_jsonType == NULL) {
-        printf("%s: output_value_jsonType should not be NULL\n", __func__);
-        return -1;
+        JSON_LOG("%s: output_value_jsonType should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
     }
 
     // set to default
-    *output_value_startIndex = -1;
-    *output_value_endIndex   = -1;
+    *output_value_startIndex = JSON_INDEX_NONE;
+    *output_value_endIndex   = JSON_INDEX_NONE;
     *output_value_jsonType   = -1;
 
-    int i = input_string_startIndex;
+    size_t i = input_string_startIndex;
 
     // check the first character
-    if (input_string[i] != '{') {
+    if (json_util_charAt(input_string, input_string_length, i) != '{') {
         if (DEBUG) {
-            printf("%s: invalid character at %d (%c, 0x%02x), it should be left curly bracket\n", __func__, i, input_string[i], input_string[i]);
+            JSON_LOG("%s: invalid character at %zu, it should be left curly bracket\n", __func__, i);
         }
-        return -1;
+        return json_error_set(JSON_ERROR_NOT_FOUND, i);
     }
     i++;
 
     // filter the blank, util find the next character
-    if (json_util_getNextCharacter(input_string, &i) != 0) {
+    if (json_util_getNextCharacter_n(input_string, input_string_length, &i) != 0) {
         goto invalid_character;
     }
 
@@ -364,20 +1013,21 @@ int json_object_getValueByKey(const char * input_string, const int input_string_
         goto end_of_object;
     }
 
-    int key_startIndex, key_endIndex;
-    int value_startIndex, value_endIndex, value_jsonType;
+    size_t key_startIndex, key_endIndex;
+    size_t value_startIndex, value_endIndex;
+    int value_jsonType;
 
 get_key_value_pair_loop:
-    // 1-1. get the key value pair
-    if (json_getKeyValuePair(input_string, i, &key_startIndex, &key_endIndex, &value_startIndex, &value_endIndex, &value_jsonType) != 0) {
+    // 1-1. get the key value pair, i is moved to the invalid character on failure
+    if (json_keyValuePair_scan(input_string, input_string_length, &i, &key_startIndex, &key_endIndex, &value_startIndex, &value_endIndex, &value_jsonType) != 0) {
         if (DEBUG) {
-            printf("%s: invalid JSON Key Value Pair at %d (%c)\n", __func__, i, input_string[i]);
+            JSON_LOG("%s: invalid JSON Key Value Pair at %zu\n", __func__, i);
         }
-        return -1;
+        return json_error_set(JSON_ERROR_SYNTAX, i);
     }
 
     // 1-2. check the key (string compare)
-    if (json_util_stringCompare(input_key, input_key_startIndex, input_key_endIndex, input_string, key_startIndex, key_endIndex) == 0) {
+    if (json_util_stringCompare_n(input_key, input_key_startIndex, input_key_endIndex, input_string, key_startIndex, key_endIndex) == 0) {
         // the key is found, return the value
         *output_value_startIndex = value_startIndex;
         *output_value_endIndex   = value_endIndex;
@@ -389,7 +1039,7 @@ get_key_value_pair_loop:
     i = value_endIndex + 1;
 
     // filter the blank, util find the next character
-    if (json_util_getNextCharacter(input_string, &i) != 0) {
+    if (json_util_getNextCharacter_n(input_string, input_string_length, &i) != 0) {
         goto invalid_character;
     }
 
@@ -410,7 +1060,7 @@ get_key_value_pair_loop:
     }
 
     // filter the blank, util find the next character
-    if (json_util_getNextCharacter(input_string, &i) != 0) {
+    if (json_util_getNextCharacter_n(input_string, input_string_length, &i) != 0) {
         goto invalid_character;
     }
 
@@ -418,72 +1068,62 @@ get_key_value_pair_loop:
 
 invalid_character:
     if (DEBUG) {
-        printf("%s: invalid character at %d (%c 0x%02x)\n", __func__, i, input_string[i], input_string[i]);
+        JSON_LOG("%s: invalid character at %zu\n", __func__, i);
     }
-    return -1;
+    return json_error_set(JSON_ERROR_SYNTAX, i);
 
 end_of_object:
     if (DEBUG) {
-        printf("%s: it's the end of the object (%d), ", __func__, i);
-        json_util_printSubstring(input_key, input_key_startIndex, input_key_endIndex);
-        printf(" is not found\n");
+        JSON_LOG("%s: it's the end of the object (%zu), ", __func__, i);
+        json_util_printSubstring_n(input_key, input_key_startIndex, input_key_endIndex);
+        JSON_LOG(" is not found\n");
     }
-    return -1;
+    return json_error_set(JSON_ERROR_NOT_FOUND, i);
 }
 
-// 1-6. Get array value by position with value start & end index and JSON type.
-int json_array_getValueByPosition(const char * input_string, const int input_string_startIndex, const int input_array_position, int * output_value_startIndex, int * output_value_endIndex, int * output_value_jsonType) {
+// 1-13. Get array value by position with value start & end index and JSON type (length-bounded)
+int json_array_getValueByPosition_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, const size_t input_array_position, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType) {
     const char DEBUG = 0;
 
     // check input arguments
     if (input_string == NULL) {
-        printf("%s: input_string should not be NULL\n", __func__);
-        return -1;
-    }
-
-    if (input_string_startIndex < 0) {
-        printf("%s: input_string_startIndex (%d) should not be negative\n", __func__, input_string_startIndex);
-        return -1;
-    }
-
-    if (input_array_position < 0) {
-        printf("%s: input_array_position (%d) should not be negative\n", __func__, input_array_position);
-        return -1;
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
     }
 
     if (output_value_startIndex == NULL) {
-        printf("%s: output_value_startIndex should not be NULL\n", __func__);
-        return -1;
+        JSON_LOG("%s: output_value_startIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
     }
 
     if (output_value_endIndex == NULL) {
-        printf("%s: output_value_endIndex should not be NULL\n", __func__);
-        return -1;
+        JSON_LOG("%s: output_value_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
     }
 
     if (output_value_jsonType == NULL) {
-        printf("%s: output_value_jsonType should not be NULL\n", __func__);
-        return -1;
+        JSON_LOG("%s: output_value_jsonType should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
     }
 
     // set to default
-    *output_value_startIndex = -1;
-    *output_value_endIndex = -1;
-    *output_value_jsonType = -1;
+    *output_value_startIndex = JSON_INDEX_NONE;
+    *output_value_endIndex   = JSON_INDEX_NONE;
+    *output_value_jsonType   = -1;
 
-    int i = input_string_startIndex;
+    size_t i = input_string_startIndex;
 
     // check the first character
-    if (input_string[i] != '[') {
+    if (json_util_charAt(input_string, input_string_length, i) != '[') {
         if (DEBUG) {
-            printf("%s: invalid character at %d (%c, 0x%02x), it should be left square bracket\n", __func__, i, input_string[i], input_string[i]);
+            JSON_LOG("%s: invalid character at %zu, it should be left square bracket\n", __func__, i);
         }
-        return -1;
+        return json_error_set(JSON_ERROR_NOT_FOUND, i);
     }
     i++;
 
     // filter the blank, util find the next character
-    if (json_util_getNextCharacter(input_string, &i) != 0) {
+    if (json_util_getNextCharacter_n(input_string, input_string_length, &i) != 0) {
         goto invalid_character;
     }
 
@@ -492,20 +1132,21 @@ int json_array_getValueByPosition(const char * input_string, const int input_str
         goto end_of_array;
     }
 
-    int position = -1;
-    int endIndex, jsonType;
+    size_t position = 0;
+    size_t endIndex;
+    int jsonType;
 
 get_value_by_position_loop:
         // 1-1. check the value
-        if (json_getValue(input_string, i, &endIndex, &jsonType) != 0) {
+        if (json_value_scan(input_string, input_string_length, i, &endIndex, &jsonType) != 0) {
             if (DEBUG) {
-                printf("%s: invalid JSON Value at %d (%c)\n", __func__, i, input_string[i]);
+                JSON_LOG("%s: invalid JSON Value at %zu (%c)\n", __func__, i, input_string[i]);
             }
-            return -1;
+            return json_error_set(JSON_ERROR_SYNTAX, i);
         }
 
         // 1-2. check the position
-        if (input_array_position == ++position) {
+        if (input_array_position == position++) {
             // the value is found
             *output_value_startIndex = i;
             *output_value_endIndex = endIndex;
@@ -518,7 +1159,7 @@ get_value_by_position_loop:
 
 
         // filter the blank, util find the next character
-        if (json_util_getNextCharacter(input_string, &i) != 0) {
+        if (json_util_getNextCharacter_n(input_string, input_string_length, &i) != 0) {
             goto invalid_character;
         }
 
@@ -539,7 +1180,7 @@ get_value_by_position_loop:
         }
 
         // filter the blank, util find the next character
-        if (json_util_getNextCharacter(input_string, &i) != 0) {
+        if (json_util_getNextCharacter_n(input_string, input_string_length, &i) != 0) {
             goto invalid_character;
         }
 
@@ -547,1102 +1188,8111 @@ get_value_by_position_loop:
 
 invalid_character:
     if (DEBUG) {
-        printf("%s: invalid character at %d (%c 0x%02x)\n", __func__, i, input_string[i], input_string[i]);
+        JSON_LOG("%s: invalid character at %zu\n", __func__, i);
     }
-    return -1;
+    return json_error_set(JSON_ERROR_SYNTAX, i);
 
 end_of_array:
     if (DEBUG) {
-        printf("%s: it's the end of the array (%d), the Value Array[%d] is not found\n", __func__, i, input_array_position);
+        JSON_LOG("%s: it's the end of the array (%zu), the Value Array[%zu] is not found\n", __func__, i, input_array_position);
     }
-    return -1;
+    return json_error_set(JSON_ERROR_NOT_FOUND, i);
 }
 
-// 1-7. object or array get key value pair list
-int json_getKeyValuePairList(const char * input_string, const int input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, int * output_keyValuePairList_size) {
-    if (json_object_getKeyValuePairList(input_string, input_string_startIndex, output_keyValuePairList, output_keyValuePairList_size) == 0) {
+// 1-14. object or array get key value pair list (length-bounded)
+int json_getKeyValuePairList_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size) {
+    if (json_object_getKeyValuePairList_n(input_string, input_string_length, input_string_startIndex, output_keyValuePairList, output_keyValuePairList_size) == 0) {
         return 0;
     }
 
-    if (json_array_getKeyValuePairList(input_string, input_string_startIndex, output_keyValuePairList, output_keyValuePairList_size) == 0) {
+    if (json_array_getKeyValuePairList_n(input_string, input_string_length, input_string_startIndex, output_keyValuePairList, output_keyValuePairList_size) == 0) {
         return 0;
     }
 
     return -1;
 }
 
-// 1-8. Free JSON Key Value Pair in recursive
-int json_keyValuePair_free(JSON_Key_Value_Pair * keyValuePair) {
+// 1-15. Build the structural index of JSON string
+int json_index_build(const char * input_string, const size_t input_string_length, JSON_Index ** output_index) {
+    // check arguments
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
 
-    if (keyValuePair == NULL) {
-        return 0;
+    if (output_index == NULL) {
+        JSON_LOG("%s: output_index should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
     }
 
-    json_keyValuePair_free(keyValuePair->next);
-    free(keyValuePair->key);
-    free(keyValuePair->value);
-    free(keyValuePair);
-    return 0;
-}
+    *output_index = NULL;
 
-// 2-1. Object Get Key Value Pair List
-int json_object_getKeyValuePairList(const char * input_string, const int input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, int * output_keyValuePairList_size) {
-    const char DEBUG = 0;
+    JSON_Index * index = calloc(1, sizeof(JSON_Index));
+    if (index == NULL) {
+        JSON_LOG("%s: out of memory\n", __func__);
+        return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+    }
 
-    // check arguments
-    if (input_string == NULL) {
-        printf("%s: input_string should not be NULL\n", __func__);
+    index->string = input_string;
+    index->length = input_string_length;
+
+    // 1. classify the blocks and flatten the structural bits to positions
+    if (json_index_findStructurals(index) != 0) {
+        json_index_free(index);
         return -1;
     }
 
-    if (input_string_startIndex < 0) {
-        printf("%s: input_string_startIndex (%d) should not be negative\n", __func__, input_string_startIndex);
+    // 2. check the brackets are balanced
+    if (json_index_checkBrackets(index) != 0) {
+        json_index_free(index);
         return -1;
     }
 
-    if (output_keyValuePairList == NULL) {
-        printf("%s: output_keyValuePairList should not be NULL\n", __func__);
-        return -1;
+    *output_index = index;
+    return 0;
+}
+
+// 1-16. Free the structural index
+int json_index_free(JSON_Index * index) {
+
+    if (index == NULL) {
+        return 0;
     }
 
-    if (output_keyValuePairList_size == NULL) {
-        printf("%s: output_keyValuePairList_size should not be NULL\n", __func__);
-        return -1;
+    free(index->positions);
+    free(index);
+    return 0;
+}
+
+// 1-17. Get the value with start & end index and JSON type by structural index
+int json_index_getValueByJS(const JSON_Index * index, const size_t input_string_startIndex, const char * input_keys, const size_t input_keys_length, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType) {
+    // check arguments
+    if (index == NULL) {
+        JSON_LOG("%s: index should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
     }
 
-    int i = input_string_startIndex;
+    if (input_keys == NULL) {
+        JSON_LOG("%s: input_keys should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
 
-    *output_keyValuePairList = NULL;
-    *output_keyValuePairList_size = 0;
+    if (output_value_startIndex == NULL) {
+        JSON_LOG("%s: output_value_startIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
 
-    // check the first character
-    if (input_string[i] != '{') {
-        if (DEBUG) {
-            printf("%s: invalid character at %d (%c, 0x%02x), it should be left curly bracket\n", __func__, i, input_string[i], input_string[i]);
-        }
-        return -1;
+    if (output_value_endIndex == NULL) {
+        JSON_LOG("%s: output_value_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
     }
-    i++;
 
-    // filter the blank, util find the next character
-    if (json_util_getNextCharacter(input_string, &i) != 0) {
-        goto invalid_character;
+    if (output_value_jsonType == NULL) {
+        JSON_LOG("%s: output_value_jsonType should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
     }
 
-    // check right curly bracket
-    if (input_string[i] == '}') {
-        return 0;
+    // set output to default
+    *output_value_startIndex = JSON_INDEX_NONE;
+    *output_value_endIndex   = JSON_INDEX_NONE;
+    *output_value_jsonType   = -1;
+
+    size_t slot = JSON_INDEX_NONE;
+    if (json_index_findSlot(index, input_string_startIndex, &slot) != 0) {
+        return -1;
     }
 
-    JSON_Key_Value_Pair * last = *output_keyValuePairList;
+    size_t key_i = 0;
+    size_t key_startIndex, key_endIndex;
+    int key_jsonType;
 
-    for (;;) {
-        // 1. get the key value pair
-        int key_startIndex, key_endIndex;
-        int value_startIndex, value_endIndex, value_jsonType;
-        if (json_getKeyValuePair(input_string, i, &key_startIndex, &key_endIndex, &value_startIndex, &value_endIndex, &value_jsonType) != 0) {
-            if (DEBUG) {
-                printf("%s: invalid JSON Key Value Pair at %d (%c)\n", __func__, i, input_string[i]);
-            }
-            return -1;
+    do {
+        // 1. get key
+        if (json_getKey_n(input_keys, input_keys_length, key_i, &key_startIndex, &key_endIndex, &key_jsonType) != 0) {
+            return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
         }
 
-        // 2. create JSON_Key_Value_Pair
-        JSON_Key_Value_Pair * pair = malloc(sizeof(JSON_Key_Value_Pair));
-        if (pair == NULL) {
-            printf("%s: out of memory\n", __func__);
-            json_keyValuePair_free(*output_keyValuePairList);
-            return -1;
+        // 2-1. json object get value by key
+        if (key_jsonType == JSON_TYPE_STRING) {
+            if (json_index_object_getSlotByKey(index, slot, input_keys, key_startIndex, key_endIndex, &slot) != 0) {
+                return -1;
+            }
         }
 
-        // key & key_type
-        pair->key_type = JSON_TYPE_STRING;
-        if (json_util_allocSubstring(input_string, key_startIndex, key_endIndex, &(pair->key)) != 0) {
-            json_keyValuePair_free(*output_keyValuePairList);
-            return -1;
-        }
+        // 2-2. json array get value by position
+        else {
+            size_t j, position = 0;
+            for (j = key_startIndex; j <= key_endIndex; j++) {
+                if (position > (SIZE_MAX - 9) / 10) {
+                    JSON_LOG("%s: the position at %zu is too large\n", __func__, key_startIndex);
+                    return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+                }
+                position = position * 10 + (input_keys[j] - '0');
+            }
 
-        // value & value_type
-        pair->value_type = value_jsonType;
-        if (json_util_allocSubstring(input_string, value_startIndex, value_endIndex, &(pair->value)) != 0) {
-            json_keyValuePair_free(*output_keyValuePairList);
-            return -1;
+            if (json_index_array_getSlotByPosition(index, slot, position, &slot) != 0) {
+                return -1;
+            }
         }
 
-        // next pointer
-        pair->next = NULL;
+        // 3. move to next key
+        key_i = key_endIndex + 2;
+
+    } while (json_util_charAt(input_keys, input_keys_length, key_i) != '\0');
+
+    return json_index_getResult(index, slot, output_value_startIndex, output_value_endIndex, output_value_jsonType);
+}
+
+// 1-18. Get value by key with value start & end index and JSON type by structural index
+int json_index_object_getValueByKey(const JSON_Index * index, const size_t input_string_startIndex, const char * input_key, const size_t input_key_startIndex, const size_t input_key_endIndex, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType) {
+    // check arguments
+    if (index == NULL) {
+        JSON_LOG("%s: index should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (input_key == NULL) {
+        JSON_LOG("%s: input_key should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (input_key_endIndex < input_key_startIndex) {
+        JSON_LOG("%s: input_key_endIndex (%zu) should greater than input_key_startIndex (%zu)\n", __func__, input_key_endIndex, input_key_startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_startIndex == NULL) {
+        JSON_LOG("%s: output_value_startIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_endIndex == NULL) {
+        JSON_LOG("%s: output_value_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_jsonType == NULL) {
+        JSON_LOG("%s: output_value_jsonType should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    // set output to default
+    *output_value_startIndex = JSON_INDEX_NONE;
+    *output_value_endIndex   = JSON_INDEX_NONE;
+    *output_value_jsonType   = -1;
+
+    size_t slot = JSON_INDEX_NONE;
+    if (json_index_findSlot(index, input_string_startIndex, &slot) != 0) {
+        return -1;
+    }
+
+    if (json_index_object_getSlotByKey(index, slot, input_key, input_key_startIndex, input_key_endIndex, &slot) != 0) {
+        return -1;
+    }
+
+    return json_index_getResult(index, slot, output_value_startIndex, output_value_endIndex, output_value_jsonType);
+}
+
+// 1-19. Get array value by position with value start & end index and JSON type by structural index
+int json_index_array_getValueByPosition(const JSON_Index * index, const size_t input_string_startIndex, const size_t input_array_position, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType) {
+    // check arguments
+    if (index == NULL) {
+        JSON_LOG("%s: index should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_startIndex == NULL) {
+        JSON_LOG("%s: output_value_startIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_endIndex == NULL) {
+        JSON_LOG("%s: output_value_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_jsonType == NULL) {
+        JSON_LOG("%s: output_value_jsonType should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    // set output to default
+    *output_value_startIndex = JSON_INDEX_NONE;
+    *output_value_endIndex   = JSON_INDEX_NONE;
+    *output_value_jsonType   = -1;
+
+    size_t slot = JSON_INDEX_NONE;
+    if (json_index_findSlot(index, input_string_startIndex, &slot) != 0) {
+        return -1;
+    }
+
+    if (json_index_array_getSlotByPosition(index, slot, input_array_position, &slot) != 0) {
+        return -1;
+    }
+
+    return json_index_getResult(index, slot, output_value_startIndex, output_value_endIndex, output_value_jsonType);
+}
+
+// 1-20. Parse JSON string to tape in one pass
+int json_parse_document(const char * input_string, const size_t input_string_length, JSON_Tape ** output_tape) {
+    // check arguments
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_tape == NULL) {
+        JSON_LOG("%s: output_tape should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_tape = NULL;
+
+    JSON_Tape * tape = calloc(1, sizeof(JSON_Tape));
+    if (tape == NULL) {
+        JSON_LOG("%s: out of memory\n", __func__);
+        return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+    }
+
+    tape->string = input_string;
+    tape->length = input_string_length;
+
+    if (json_tape_parse(tape) != 0) {
+        json_tape_free(tape);
+        return -1;
+    }
+
+    *output_tape = tape;
+    return 0;
+}
+
+// 1-21. Free the tape
+int json_tape_free(JSON_Tape * tape) {
+
+    if (tape == NULL) {
+        return 0;
+    }
+
+    free(tape->entries);
+    free(tape);
+    return 0;
+}
+
+// 1-22. Get the value tape index by Javascript Syntax
+int json_tape_getValueByJS(const JSON_Tape * tape, const size_t input_tapeIndex, const char * input_keys, const size_t input_keys_length, size_t * output_tapeIndex) {
+    // check arguments
+    if (tape == NULL) {
+        JSON_LOG("%s: tape should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (input_keys == NULL) {
+        JSON_LOG("%s: input_keys should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_tapeIndex == NULL) {
+        JSON_LOG("%s: output_tapeIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_tapeIndex = JSON_INDEX_NONE;
+
+    size_t t = input_tapeIndex;
+    size_t key_i = 0;
+    size_t key_startIndex, key_endIndex;
+    int key_jsonType;
+
+    do {
+        // 1. get key
+        if (json_getKey_n(input_keys, input_keys_length, key_i, &key_startIndex, &key_endIndex, &key_jsonType) != 0) {
+            return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+        }
+
+        // 2-1. json object get value by key
+        if (key_jsonType == JSON_TYPE_STRING) {
+            if (json_tape_object_getValueByKey(tape, t, input_keys, key_startIndex, key_endIndex, &t) != 0) {
+                return -1;
+            }
+        }
+
+        // 2-2. json array get value by position
+        else {
+            size_t j, position = 0;
+            for (j = key_startIndex; j <= key_endIndex; j++) {
+                if (position > (SIZE_MAX - 9) / 10) {
+                    JSON_LOG("%s: the position at %zu is too large\n", __func__, key_startIndex);
+                    return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+                }
+                position = position * 10 + (input_keys[j] - '0');
+            }
+
+            if (json_tape_array_getValueByPosition(tape, t, position, &t) != 0) {
+                return -1;
+            }
+        }
+
+        // 3. move to next key
+        key_i = key_endIndex + 2;
+
+    } while (json_util_charAt(input_keys, input_keys_length, key_i) != '\0');
+
+    *output_tapeIndex = t;
+    return 0;
+}
+
+// 1-23. Get the value tape index by key
+int json_tape_object_getValueByKey(const JSON_Tape * tape, const size_t input_tapeIndex, const char * input_key, const size_t input_key_startIndex, const size_t input_key_endIndex, size_t * output_tapeIndex) {
+    // check arguments
+    if (tape == NULL) {
+        JSON_LOG("%s: tape should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (input_key == NULL) {
+        JSON_LOG("%s: input_key should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (input_key_endIndex < input_key_startIndex) {
+        JSON_LOG("%s: input_key_endIndex (%zu) should greater than input_key_startIndex (%zu)\n", __func__, input_key_endIndex, input_key_startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_tapeIndex == NULL) {
+        JSON_LOG("%s: output_tapeIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_tapeIndex = JSON_INDEX_NONE;
+
+    if (input_tapeIndex >= tape->size) {
+        JSON_LOG("%s: input_tapeIndex (%zu) should be less than the tape size (%zu)\n", __func__, input_tapeIndex, tape->size);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    // the key should be quoted
+    if (input_key_endIndex == input_key_startIndex || input_key[input_key_startIndex] != '\"' || input_key[input_key_endIndex] != '\"') {
+        JSON_LOG("%s: input_key should be quoted\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    // check the object
+    const uint64_t * entries = tape->entries;
+    if (JSON_TAPE_TAG(entries[input_tapeIndex]) != '{') {
+        return json_error_set(JSON_ERROR_NOT_FOUND, JSON_TAPE_PAYLOAD(entries[input_tapeIndex]));
+    }
+
+    const char * key = input_key + input_key_startIndex + 1;
+    const size_t key_length = input_key_endIndex - input_key_startIndex - 1;
+
+    *output_tapeIndex = json_tape_object_findKey(tape, input_tapeIndex, key, key_length, json_util_hash(key, key_length));
+    if (*output_tapeIndex == JSON_INDEX_NONE) {
+        // not found at the end of the object
+        return json_error_set(JSON_ERROR_NOT_FOUND, JSON_TAPE_PAYLOAD(entries[entries[input_tapeIndex + 1]]));
+    }
+    return 0;
+}
+
+// 1-24. Get the array value tape index by position
+int json_tape_array_getValueByPosition(const JSON_Tape * tape, const size_t input_tapeIndex, const size_t input_array_position, size_t * output_tapeIndex) {
+    // check arguments
+    if (tape == NULL) {
+        JSON_LOG("%s: tape should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_tapeIndex == NULL) {
+        JSON_LOG("%s: output_tapeIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_tapeIndex = JSON_INDEX_NONE;
+
+    if (input_tapeIndex >= tape->size) {
+        JSON_LOG("%s: input_tapeIndex (%zu) should be less than the tape size (%zu)\n", __func__, input_tapeIndex, tape->size);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    // check the array
+    const uint64_t * entries = tape->entries;
+    if (JSON_TAPE_TAG(entries[input_tapeIndex]) != '[') {
+        return json_error_set(JSON_ERROR_NOT_FOUND, JSON_TAPE_PAYLOAD(entries[input_tapeIndex]));
+    }
+
+    const size_t closeIndex = entries[input_tapeIndex + 1];
+
+    size_t t = input_tapeIndex + 2;
+    size_t position = 0;
+    while (t < closeIndex) {
+        if (position++ == input_array_position) {
+            *output_tapeIndex = t;
+            return 0;
+        }
+
+        // skip the value, the object and array are skipped in one step
+        t = json_tape_nextIndex(tape, t);
+    }
+
+    // not found at the end of the array
+    return json_error_set(JSON_ERROR_NOT_FOUND, JSON_TAPE_PAYLOAD(entries[closeIndex]));
+}
+
+// 1-25. Get the value start & end index and JSON type of the tape index
+int json_tape_getValue(const JSON_Tape * tape, const size_t input_tapeIndex, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType) {
+    // check arguments
+    if (tape == NULL) {
+        JSON_LOG("%s: tape should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_startIndex == NULL) {
+        JSON_LOG("%s: output_value_startIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_endIndex == NULL) {
+        JSON_LOG("%s: output_value_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_jsonType == NULL) {
+        JSON_LOG("%s: output_value_jsonType should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_value_startIndex = JSON_INDEX_NONE;
+    *output_value_endIndex   = JSON_INDEX_NONE;
+    *output_value_jsonType   = -1;
+
+    if (input_tapeIndex >= tape->size) {
+        JSON_LOG("%s: input_tapeIndex (%zu) should be less than the tape size (%zu)\n", __func__, input_tapeIndex, tape->size);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    const uint64_t * entries = tape->entries;
+    const size_t startIndex = JSON_TAPE_PAYLOAD(entries[input_tapeIndex]);
+
+    switch (JSON_TAPE_TAG(entries[input_tapeIndex])) {
+        case '{':
+            *output_value_endIndex = JSON_TAPE_PAYLOAD(entries[entries[input_tapeIndex + 1]]);
+            *output_value_jsonType = JSON_TYPE_OBJECT;
+            break;
+
+        case '[':
+            *output_value_endIndex = JSON_TAPE_PAYLOAD(entries[entries[input_tapeIndex + 1]]);
+            *output_value_jsonType = JSON_TYPE_ARRAY;
+            break;
+
+        case '\"':
+            *output_value_endIndex = entries[input_tapeIndex + 1];
+            *output_value_jsonType = JSON_TYPE_STRING;
+            break;
+
+        case 'l':
+        case 'd':
+            *output_value_endIndex = entries[input_tapeIndex + 1];
+            *output_value_jsonType = JSON_TYPE_NUMBER;
+            break;
+
+        case 't':
+            *output_value_endIndex = startIndex + 3;
+            *output_value_jsonType = JSON_TYPE_BOOLEAN;
+            break;
+
+        case 'f':
+            *output_value_endIndex = startIndex + 4;
+            *output_value_jsonType = JSON_TYPE_BOOLEAN;
+            break;
+
+        case 'n':
+            *output_value_endIndex = startIndex + 3;
+            *output_value_jsonType = JSON_TYPE_NULL;
+            break;
+
+        // key or the end of container, it's not a value
+        default:
+            JSON_LOG("%s: input_tapeIndex (%zu) should be a value\n", __func__, input_tapeIndex);
+            return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_value_startIndex = startIndex;
+    return 0;
+}
+
+// 1-26. Get the pre-decoded number of the tape index
+int json_tape_number_toDouble(const JSON_Tape * tape, const size_t input_tapeIndex, double * output_double) {
+    // check arguments
+    if (tape == NULL) {
+        JSON_LOG("%s: tape should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_double == NULL) {
+        JSON_LOG("%s: output_double should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (input_tapeIndex >= tape->size) {
+        JSON_LOG("%s: input_tapeIndex (%zu) should be less than the tape size (%zu)\n", __func__, input_tapeIndex, tape->size);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    const uint64_t * entry = tape->entries + input_tapeIndex;
+
+    switch (JSON_TAPE_TAG(entry[0])) {
+        case 'l':
+            *output_double = (double) (int64_t) entry[2];
+            return 0;
+
+        case 'd':
+            memcpy(output_double, entry + 2, sizeof(double));
+            return 0;
+
+        default:
+            JSON_LOG("%s: input_tapeIndex (%zu) should be a number\n", __func__, input_tapeIndex);
+            return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+}
+
+// 1-27. Create the lookup context of the string
+int json_lookup_create(const char * input_string, const size_t input_string_length, const size_t input_threshold, JSON_Lookup ** output_lookup) {
+    // check arguments
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_lookup == NULL) {
+        JSON_LOG("%s: output_lookup should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_lookup = NULL;
+
+    JSON_Lookup * lookup = calloc(1, sizeof(JSON_Lookup));
+    if (lookup == NULL) {
+        JSON_LOG("%s: out of memory\n", __func__);
+        return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+    }
+
+    lookup->string    = input_string;
+    lookup->length    = input_string_length;
+    lookup->threshold = input_threshold;
+
+    *output_lookup = lookup;
+    return 0;
+}
+
+// 1-28. Free the lookup context
+int json_lookup_free(JSON_Lookup * lookup) {
+
+    if (lookup == NULL) {
+        return 0;
+    }
+
+    size_t i;
+    for (i = 0; i < lookup->capacity; i++) {
+        if (lookup->objects[i].startIndex != JSON_INDEX_NONE) {
+            free(lookup->objects[i].slots);
+        }
+    }
+
+    free(lookup->objects);
+    free(lookup);
+    return 0;
+}
+
+// 1-29. Get value by Javascript Syntax, the object lookup goes through the lookup context
+int json_lookup_getValueByJS(JSON_Lookup * lookup, const size_t input_string_startIndex, const char * input_keys, const size_t input_keys_length, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType) {
+    // check arguments
+    if (lookup == NULL) {
+        JSON_LOG("%s: lookup should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (input_keys == NULL) {
+        JSON_LOG("%s: input_keys should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_startIndex == NULL) {
+        JSON_LOG("%s: output_value_startIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_endIndex == NULL) {
+        JSON_LOG("%s: output_value_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_jsonType == NULL) {
+        JSON_LOG("%s: output_value_jsonType should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_value_startIndex = JSON_INDEX_NONE;
+    *output_value_endIndex   = JSON_INDEX_NONE;
+    *output_value_jsonType   = -1;
+
+    size_t value_startIndex = input_string_startIndex;
+    size_t value_endIndex = JSON_INDEX_NONE;
+    int value_jsonType = -1;
+
+    size_t key_i = 0;
+    size_t key_startIndex, key_endIndex;
+    int key_jsonType;
+
+    do {
+        // 1. get key
+        if (json_getKey_n(input_keys, input_keys_length, key_i, &key_startIndex, &key_endIndex, &key_jsonType) != 0) {
+            return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+        }
+
+        // 2-1. json object get value by key
+        if (key_jsonType == JSON_TYPE_STRING) {
+            if (json_lookup_object_getValueByKey(lookup, value_startIndex, input_keys, key_startIndex, key_endIndex, &value_startIndex, &value_endIndex, &value_jsonType) != 0) {
+                return -1;
+            }
+        }
+
+        // 2-2. json array get value by position
+        else {
+            size_t j, position = 0;
+            for (j = key_startIndex; j <= key_endIndex; j++) {
+                if (position > (SIZE_MAX - 9) / 10) {
+                    JSON_LOG("%s: the position at %zu is too large\n", __func__, key_startIndex);
+                    return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+                }
+                position = position * 10 + (input_keys[j] - '0');
+            }
+
+            if (json_array_getValueByPosition_n(lookup->string, lookup->length, value_startIndex, position, &value_startIndex, &value_endIndex, &value_jsonType) != 0) {
+                return -1;
+            }
+        }
+
+        // 3. move to next key
+        key_i = key_endIndex + 2;
+
+    } while (json_util_charAt(input_keys, input_keys_length, key_i) != '\0');
+
+    *output_value_startIndex = value_startIndex;
+    *output_value_endIndex   = value_endIndex;
+    *output_value_jsonType   = value_jsonType;
+    return 0;
+}
+
+// 1-30. Get value by key, the hash table of the object is built after the lookup count reaches the threshold
+int json_lookup_object_getValueByKey(JSON_Lookup * lookup, const size_t input_string_startIndex, const char * input_key, const size_t input_key_startIndex, const size_t input_key_endIndex, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType) {
+    // check arguments
+    if (lookup == NULL) {
+        JSON_LOG("%s: lookup should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (input_key == NULL) {
+        JSON_LOG("%s: input_key should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (input_key_endIndex < input_key_startIndex) {
+        JSON_LOG("%s: input_key_endIndex (%zu) should greater than input_key_startIndex (%zu)\n", __func__, input_key_endIndex, input_key_startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_startIndex == NULL) {
+        JSON_LOG("%s: output_value_startIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_endIndex == NULL) {
+        JSON_LOG("%s: output_value_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_jsonType == NULL) {
+        JSON_LOG("%s: output_value_jsonType should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_value_startIndex = JSON_INDEX_NONE;
+    *output_value_endIndex   = JSON_INDEX_NONE;
+    *output_value_jsonType   = -1;
+
+    // 1. find the object record and count the lookup
+    JSON_Lookup_Object * object = json_lookup_findObject(lookup, input_string_startIndex);
+
+    if (object != NULL && object->slots == NULL && !object->failed && ++object->count > lookup->threshold) {
+        if (json_lookup_buildTable(lookup, object) != 0) {
+            // the object is invalid or out of memory, keep the linear scan
+            object->failed = 1;
+        }
+    }
+
+    // 2. linear scan before the hash table is built
+    if (object == NULL || object->slots == NULL) {
+        return json_object_getValueByKey_n(lookup->string, lookup->length, input_string_startIndex, input_key, input_key_startIndex, input_key_endIndex, output_value_startIndex, output_value_endIndex, output_value_jsonType);
+    }
+
+    // 3. probe the hash table
+    const JSON_Lookup_Slot * slot = json_lookup_findSlot(lookup, object, input_key + input_key_startIndex, input_key_endIndex - input_key_startIndex + 1);
+    if (slot == NULL || slot->key_startIndex == JSON_INDEX_NONE) {
+        // the same error as the linear scan at the end of the object
+        return json_error_set(JSON_ERROR_NOT_FOUND, object->endIndex);
+    }
+
+    *output_value_startIndex = slot->value_startIndex;
+    *output_value_endIndex   = slot->value_endIndex;
+    *output_value_jsonType   = slot->value_jsonType;
+    return 0;
+}
+
+// 1-31. Compile the Javascript Syntax keys to the reusable path
+int json_path_compile(const char * input_keys, const size_t input_keys_length, JSON_Path ** output_path) {
+    const char DEBUG = 0;
+
+    // check arguments
+    if (input_keys == NULL) {
+        JSON_LOG("%s: input_keys should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_path == NULL) {
+        JSON_LOG("%s: output_path should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_path = NULL;
+
+    JSON_Path * path = calloc(1, sizeof(JSON_Path));
+    if (path == NULL) {
+        JSON_LOG("%s: out of memory\n", __func__);
+        return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+    }
+
+    size_t capacity = 0;
+    size_t key_i = 0;
+    size_t key_startIndex, key_endIndex;
+    int key_jsonType;
+
+    do {
+        // 1. get key, the malformed keys are rejected here once
+        if (json_getKey_n(input_keys, input_keys_length, key_i, &key_startIndex, &key_endIndex, &key_jsonType) != 0) {
+            if (DEBUG) {
+                JSON_LOG("%s: get key at %zu failure\n", __func__, key_i);
+            }
+            goto failure;
+        }
+
+        if (path->size == capacity) {
+            capacity = capacity == 0 ? 8 : capacity * 2;
+            JSON_Path_Step * steps = realloc(path->steps, capacity * sizeof(JSON_Path_Step));
+            if (steps == NULL) {
+                JSON_LOG("%s: out of memory\n", __func__);
+                json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+                goto failure;
+            }
+            path->steps = steps;
+        }
+
+        JSON_Path_Step * step = &path->steps[path->size++];
+        step->type = key_jsonType;
+        step->key_startIndex = key_startIndex;
+        step->key_endIndex   = key_endIndex;
+        step->key_hash = 0;
+        step->position = 0;
+
+        // 2-1. hash the key characters without the quotes
+        if (key_jsonType == JSON_TYPE_STRING) {
+            step->key_hash = json_util_hash(input_keys + key_startIndex + 1, key_endIndex - key_startIndex - 1);
+        }
+
+        // 2-2. convert the position to integer
+        else {
+            size_t j;
+            for (j = key_startIndex; j <= key_endIndex; j++) {
+                if (step->position > (SIZE_MAX - 9) / 10) {
+                    if (DEBUG) {
+                        JSON_LOG("%s: the position at %zu is too large\n", __func__, key_startIndex);
+                    }
+                    goto failure;
+                }
+                step->position = step->position * 10 + (input_keys[j] - '0');
+            }
+        }
+
+        // 3. move to next key
+        key_i = key_endIndex + 2;
+
+    } while (json_util_charAt(input_keys, input_keys_length, key_i) != '\0');
+
+    // 4. keep the copy of the keys, the path doesn't refer to the input
+    path->keys = malloc(key_i + 1);
+    if (path->keys == NULL) {
+        JSON_LOG("%s: out of memory\n", __func__);
+        json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+        goto failure;
+    }
+    memcpy(path->keys, input_keys, key_i);
+    path->keys[key_i] = '\0';
+    path->keys_length = key_i;
+
+    *output_path = path;
+    return 0;
+
+failure:
+    json_path_free(path);
+    return -1;
+}
+
+// 1-32. Free the path
+int json_path_free(JSON_Path * path) {
+
+    if (path == NULL) {
+        return 0;
+    }
+
+    free(path->keys);
+    free(path->steps);
+    free(path);
+    return 0;
+}
+
+// 1-33. Get value by the compiled path
+int json_path_eval(const JSON_Path * path, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType) {
+    // check arguments
+    if (path == NULL) {
+        JSON_LOG("%s: path should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_startIndex == NULL) {
+        JSON_LOG("%s: output_value_startIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_endIndex == NULL) {
+        JSON_LOG("%s: output_value_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_jsonType == NULL) {
+        JSON_LOG("%s: output_value_jsonType should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_value_startIndex = JSON_INDEX_NONE;
+    *output_value_endIndex   = JSON_INDEX_NONE;
+    *output_value_jsonType   = -1;
+
+    size_t value_startIndex = input_string_startIndex;
+    size_t value_endIndex = JSON_INDEX_NONE;
+    int value_jsonType = -1;
+
+    size_t i;
+    for (i = 0; i < path->size; i++) {
+        const JSON_Path_Step * step = &path->steps[i];
+
+        if (step->type == JSON_TYPE_STRING) {
+            if (json_object_getValueByKey_n(input_string, input_string_length, value_startIndex, path->keys, step->key_startIndex, step->key_endIndex, &value_startIndex, &value_endIndex, &value_jsonType) != 0) {
+                return -1;
+            }
+        } else {
+            if (json_array_getValueByPosition_n(input_string, input_string_length, value_startIndex, step->position, &value_startIndex, &value_endIndex, &value_jsonType) != 0) {
+                return -1;
+            }
+        }
+    }
+
+    *output_value_startIndex = value_startIndex;
+    *output_value_endIndex   = value_endIndex;
+    *output_value_jsonType   = value_jsonType;
+    return 0;
+}
+
+// 1-34. Get the value tape index by the compiled path
+int json_path_evalTape(const JSON_Path * path, const JSON_Tape * tape, const size_t input_tapeIndex, size_t * output_tapeIndex) {
+    // check arguments
+    if (path == NULL) {
+        JSON_LOG("%s: path should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (tape == NULL) {
+        JSON_LOG("%s: tape should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_tapeIndex == NULL) {
+        JSON_LOG("%s: output_tapeIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_tapeIndex = JSON_INDEX_NONE;
+
+    size_t t = input_tapeIndex;
+    size_t i;
+    for (i = 0; i < path->size; i++) {
+        const JSON_Path_Step * step = &path->steps[i];
+
+        if (step->type == JSON_TYPE_STRING) {
+            // the key hash is compiled, compare it with the hash on the tape directly
+            if (t >= tape->size) {
+                JSON_LOG("%s: input_tapeIndex (%zu) should be less than the tape size (%zu)\n", __func__, t, tape->size);
+                return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+            }
+
+            if (JSON_TAPE_TAG(tape->entries[t]) != '{') {
+                return json_error_set(JSON_ERROR_NOT_FOUND, JSON_TAPE_PAYLOAD(tape->entries[t]));
+            }
+
+            const size_t object = t;
+            t = json_tape_object_findKey(tape, object, path->keys + step->key_startIndex + 1, step->key_endIndex - step->key_startIndex - 1, step->key_hash);
+            if (t == JSON_INDEX_NONE) {
+                // not found at the end of the object
+                return json_error_set(JSON_ERROR_NOT_FOUND, JSON_TAPE_PAYLOAD(tape->entries[tape->entries[object + 1]]));
+            }
+        } else {
+            if (json_tape_array_getValueByPosition(tape, t, step->position, &t) != 0) {
+                return -1;
+            }
+        }
+    }
+
+    *output_tapeIndex = t;
+    return 0;
+}
+
+// 1-35. Compile the Javascript Syntax keys list to the path set (prefix trie)
+int json_path_compileSet(const char ** input_keys_list, const size_t input_keys_count, JSON_Path_Set ** output_set) {
+    // check arguments
+    if (input_keys_list == NULL) {
+        JSON_LOG("%s: input_keys_list should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_set == NULL) {
+        JSON_LOG("%s: output_set should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_set = NULL;
+
+    JSON_Path_Set * set = calloc(1, sizeof(JSON_Path_Set));
+    if (set == NULL) {
+        JSON_LOG("%s: out of memory\n", __func__);
+        return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+    }
+
+    set->paths        = calloc(input_keys_count + 1, sizeof(JSON_Path *));
+    set->outputs_next = calloc(input_keys_count + 1, sizeof(size_t));
+    if (set->paths == NULL || set->outputs_next == NULL) {
+        JSON_LOG("%s: out of memory\n", __func__);
+        json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+        goto failure;
+    }
+
+    // the root node
+    if (json_pathSet_addNode(set, NULL, NULL) == JSON_INDEX_NONE) {
+        goto failure;
+    }
+
+    size_t i;
+    for (i = 0; i < input_keys_count; i++) {
+        if (input_keys_list[i] == NULL) {
+            JSON_LOG("%s: input_keys_list[%zu] should not be NULL\n", __func__, i);
+            json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+            goto failure;
+        }
+
+        if (json_path_compile(input_keys_list[i], strlen(input_keys_list[i]), &set->paths[i]) != 0) {
+            goto failure;
+        }
+        set->size++;
+
+        if (json_pathSet_insert(set, i) != 0) {
+            goto failure;
+        }
+    }
+
+    *output_set = set;
+    return 0;
+
+failure:
+    json_path_freeSet(set);
+    return -1;
+}
+
+// 1-36. Free the path set
+int json_path_freeSet(JSON_Path_Set * set) {
+
+    if (set == NULL) {
+        return 0;
+    }
+
+    size_t i;
+    for (i = 0; i < set->size; i++) {
+        json_path_free(set->paths[i]);
+    }
+
+    free(set->paths);
+    free(set->outputs_next);
+    free(set->nodes);
+    free(set);
+    return 0;
+}
+
+// 1-37. Get the values of all paths in one pass
+int json_path_evalSet(const JSON_Path_Set * set, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Value_Range * output_values) {
+    // check arguments
+    if (set == NULL) {
+        JSON_LOG("%s: set should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_values == NULL) {
+        JSON_LOG("%s: output_values should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    // 1. the matched flags of the walk, one for each node at most
+    unsigned char scratch_local[JSON_PATH_SET_SCRATCH_SIZE];
+    unsigned char * scratch = scratch_local;
+    if (set->nodes_size > sizeof(scratch_local)) {
+        scratch = malloc(set->nodes_size);
+        if (scratch == NULL) {
+            size_t i;
+            for (i = 0; i < set->size; i++) {
+                output_values[i].startIndex = JSON_INDEX_NONE;
+                output_values[i].endIndex   = JSON_INDEX_NONE;
+                output_values[i].jsonType   = -1;
+            }
+            JSON_LOG("%s: out of memory\n", __func__);
+            return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+        }
+    }
+
+    // 2. walk the document from the root node
+    json_pathSet_eval(set, input_string, input_string_length, input_string_startIndex, scratch, output_values);
+
+    if (scratch != scratch_local) {
+        free(scratch);
+    }
+    return 0;
+}
+
+// 1-38. Create the arena
+int json_arena_create(const size_t input_chunk_size, JSON_Arena ** output_arena) {
+    // check arguments
+    if (output_arena == NULL) {
+        JSON_LOG("%s: output_arena should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_arena = NULL;
+
+    JSON_Arena * arena = calloc(1, sizeof(JSON_Arena));
+    if (arena == NULL) {
+        JSON_LOG("%s: out of memory\n", __func__);
+        return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+    }
+
+    arena->chunk_size = input_chunk_size == 0 ? JSON_ARENA_CHUNK_SIZE : input_chunk_size;
+
+    *output_arena = arena;
+    return 0;
+}
+
+// 1-39. Allocate the memory in the arena
+int json_arena_alloc(JSON_Arena * arena, const size_t input_size, void ** output_pointer) {
+    // check arguments
+    if (arena == NULL) {
+        JSON_LOG("%s: arena should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_pointer == NULL) {
+        JSON_LOG("%s: output_pointer should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_pointer = NULL;
+
+    // keep the alignment of the next allocation
+    const size_t size = (input_size + JSON_ARENA_ALIGNMENT - 1) & ~(size_t) (JSON_ARENA_ALIGNMENT - 1);
+    if (size < input_size) {
+        JSON_LOG("%s: out of memory\n", __func__);
+        return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+    }
+
+    // 1. bump the current chunk
+    JSON_Arena_Chunk * chunk = arena->current;
+    if (chunk != NULL && chunk->capacity - chunk->used >= size) {
+        *output_pointer = JSON_ARENA_CHUNK_DATA(chunk) + chunk->used;
+        chunk->used += size;
+        return 0;
+    }
+
+    // 2. reuse the next chunk kept by json_arena_reset
+    if (chunk != NULL && chunk->next != NULL && chunk->next->capacity >= size) {
+        chunk = chunk->next;
+        chunk->used = size;
+        arena->current = chunk;
+        *output_pointer = JSON_ARENA_CHUNK_DATA(chunk);
+        return 0;
+    }
+
+    // 3. insert a new chunk behind the current one, the large allocation gets its own chunk
+    const size_t capacity = size > arena->chunk_size ? size : arena->chunk_size;
+    if (capacity > SIZE_MAX - JSON_ARENA_CHUNK_HEADER_SIZE) {
+        JSON_LOG("%s: out of memory\n", __func__);
+        return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+    }
+
+    JSON_Arena_Chunk * new_chunk = malloc(JSON_ARENA_CHUNK_HEADER_SIZE + capacity);
+    if (new_chunk == NULL) {
+        JSON_LOG("%s: out of memory\n", __func__);
+        return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+    }
+
+    new_chunk->capacity = capacity;
+    new_chunk->used = size;
+
+    if (chunk == NULL) {
+        new_chunk->next = arena->chunks;
+        arena->chunks = new_chunk;
+    } else {
+        new_chunk->next = chunk->next;
+        chunk->next = new_chunk;
+    }
+
+    arena->current = new_chunk;
+    *output_pointer = JSON_ARENA_CHUNK_DATA(new_chunk);
+    return 0;
+}
+
+// 1-40. Release all allocations in the arena, the chunks are kept for reuse
+int json_arena_reset(JSON_Arena * arena) {
+    // check arguments
+    if (arena == NULL) {
+        JSON_LOG("%s: arena should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    arena->current = arena->chunks;
+    if (arena->current != NULL) {
+        arena->current->used = 0;
+    }
+
+    return 0;
+}
+
+// 1-41. Free the arena and its chunks
+int json_arena_free(JSON_Arena * arena) {
+
+    if (arena == NULL) {
+        return 0;
+    }
+
+    JSON_Arena_Chunk * chunk = arena->chunks;
+    while (chunk != NULL) {
+        JSON_Arena_Chunk * next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+
+    free(arena);
+    return 0;
+}
+
+// 1-42. object get key value pair list in the arena
+int json_object_getKeyValuePairList_arena(JSON_Arena * arena, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size) {
+    // check arguments
+    if (arena == NULL) {
+        JSON_LOG("%s: arena should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    return json_object_getKeyValuePairList_alloc(arena, NULL, input_string, input_string_length, input_string_startIndex, output_keyValuePairList, output_keyValuePairList_size);
+}
+
+// 1-43. array get key value pair list in the arena
+int json_array_getKeyValuePairList_arena(JSON_Arena * arena, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size) {
+    // check arguments
+    if (arena == NULL) {
+        JSON_LOG("%s: arena should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    return json_array_getKeyValuePairList_alloc(arena, NULL, input_string, input_string_length, input_string_startIndex, output_keyValuePairList, output_keyValuePairList_size);
+}
+
+// 1-44. object or array get key value pair list in the arena
+int json_getKeyValuePairList_arena(JSON_Arena * arena, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size) {
+    if (json_object_getKeyValuePairList_arena(arena, input_string, input_string_length, input_string_startIndex, output_keyValuePairList, output_keyValuePairList_size) == 0) {
+        return 0;
+    }
+
+    if (json_array_getKeyValuePairList_arena(arena, input_string, input_string_length, input_string_startIndex, output_keyValuePairList, output_keyValuePairList_size) == 0) {
+        return 0;
+    }
+
+    return -1;
+}
+
+// 1-45. object or array get key value view list
+int json_getKeyValueViewList(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_View * output_views, const size_t output_views_capacity, size_t * output_views_size) {
+    if (json_object_getKeyValueViewList_n(input_string, input_string_length, input_string_startIndex, output_views, output_views_capacity, output_views_size) == 0) {
+        return 0;
+    }
+
+    if (json_array_getKeyValueViewList_n(input_string, input_string_length, input_string_startIndex, output_views, output_views_capacity, output_views_size) == 0) {
+        return 0;
+    }
+
+    return -1;
+}
+
+// 1-46. Initialize the array iterator
+int json_array_iter_init(JSON_Iter * iter, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex) {
+    // check arguments
+    if (iter == NULL) {
+        JSON_LOG("%s: iter should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    return json_iter_init(iter, input_string, input_string_length, input_string_startIndex, '[', ']');
+}
+
+// 1-47. Get the next value of the array
+int json_array_iter_next(JSON_Iter * iter, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType) {
+    // check arguments
+    if (iter == NULL) {
+        JSON_LOG("%s: iter should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_startIndex == NULL) {
+        JSON_LOG("%s: output_value_startIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_endIndex == NULL) {
+        JSON_LOG("%s: output_value_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_jsonType == NULL) {
+        JSON_LOG("%s: output_value_jsonType should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_value_startIndex = JSON_INDEX_NONE;
+    *output_value_endIndex   = JSON_INDEX_NONE;
+    *output_value_jsonType   = -1;
+
+    // 1. move to the next value
+    int result = json_iter_advance(iter, ']');
+    if (result != 0) {
+        return result;
+    }
+
+    // 2. check the value
+    size_t endIndex;
+    int jsonType;
+    if (json_value_scan(iter->string, iter->length, iter->index, &endIndex, &jsonType) != 0) {
+        iter->state = JSON_ITER_STATE_ERROR;
+        return json_error_set(JSON_ERROR_SYNTAX, iter->index);
+    }
+
+    *output_value_startIndex = iter->index;
+    *output_value_endIndex   = endIndex;
+    *output_value_jsonType   = jsonType;
+
+    // 3. the separator is behind the value
+    iter->index = endIndex + 1;
+    iter->position++;
+    iter->state = JSON_ITER_STATE_SEPARATOR;
+    return 0;
+}
+
+// 1-48. Initialize the object iterator
+int json_object_iter_init(JSON_Iter * iter, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex) {
+    // check arguments
+    if (iter == NULL) {
+        JSON_LOG("%s: iter should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    return json_iter_init(iter, input_string, input_string_length, input_string_startIndex, '{', '}');
+}
+
+// 1-49. Get the next key value pair of the object
+int json_object_iter_next(JSON_Iter * iter, size_t * output_key_startIndex, size_t * output_key_endIndex, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType) {
+    // check arguments
+    if (iter == NULL) {
+        JSON_LOG("%s: iter should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_key_startIndex == NULL) {
+        JSON_LOG("%s: output_key_startIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_key_endIndex == NULL) {
+        JSON_LOG("%s: output_key_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_startIndex == NULL) {
+        JSON_LOG("%s: output_value_startIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_endIndex == NULL) {
+        JSON_LOG("%s: output_value_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_jsonType == NULL) {
+        JSON_LOG("%s: output_value_jsonType should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_key_startIndex   = JSON_INDEX_NONE;
+    *output_key_endIndex     = JSON_INDEX_NONE;
+    *output_value_startIndex = JSON_INDEX_NONE;
+    *output_value_endIndex   = JSON_INDEX_NONE;
+    *output_value_jsonType   = -1;
+
+    // 1. move to the next key
+    int result = json_iter_advance(iter, '}');
+    if (result != 0) {
+        return result;
+    }
+
+    // 2. get the key value pair
+    size_t i = iter->index;
+    if (json_keyValuePair_scan(iter->string, iter->length, &i, output_key_startIndex, output_key_endIndex, output_value_startIndex, output_value_endIndex, output_value_jsonType) != 0) {
+        iter->state = JSON_ITER_STATE_ERROR;
+        return json_error_set(JSON_ERROR_SYNTAX, i);
+    }
+
+    // 3. the separator is behind the value
+    iter->index = *output_value_endIndex + 1;
+    iter->position++;
+    iter->state = JSON_ITER_STATE_SEPARATOR;
+    return 0;
+}
+
+// 1-50. Create the lazy position index of the array
+int json_array_index_create(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, const size_t input_interval, JSON_Array_Index ** output_index) {
+    // check arguments
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_index == NULL) {
+        JSON_LOG("%s: output_index should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_index = NULL;
+
+    JSON_Array_Index * index = calloc(1, sizeof(JSON_Array_Index));
+    if (index == NULL) {
+        JSON_LOG("%s: out of memory\n", __func__);
+        return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+    }
+
+    index->interval = input_interval == 0 ? JSON_ARRAY_INDEX_INTERVAL : input_interval;
+    index->count    = JSON_INDEX_NONE;
+
+    // the frontier is the iterator behind the deepest scanned value
+    if (json_array_iter_init(&index->frontier, input_string, input_string_length, input_string_startIndex) != 0) {
+        json_array_index_free(index);
+        return -1;
+    }
+
+    *output_index = index;
+    return 0;
+}
+
+// 1-51. Free the position index
+int json_array_index_free(JSON_Array_Index * index) {
+
+    if (index == NULL) {
+        return 0;
+    }
+
+    free(index->checkpoints);
+    free(index);
+    return 0;
+}
+
+// 1-52. Get array value by position, resume from the closest checkpoint
+int json_array_index_getValueByPosition(JSON_Array_Index * index, const size_t input_array_position, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType) {
+    // check arguments
+    if (index == NULL) {
+        JSON_LOG("%s: index should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_startIndex == NULL) {
+        JSON_LOG("%s: output_value_startIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_endIndex == NULL) {
+        JSON_LOG("%s: output_value_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_jsonType == NULL) {
+        JSON_LOG("%s: output_value_jsonType should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_value_startIndex = JSON_INDEX_NONE;
+    *output_value_endIndex   = JSON_INDEX_NONE;
+    *output_value_jsonType   = -1;
+
+    // 1. the position is out of the array, the frontier is at the end of the array
+    if (index->count != JSON_INDEX_NONE && input_array_position >= index->count) {
+        return json_error_set(JSON_ERROR_NOT_FOUND, index->frontier.index);
+    }
+
+    JSON_Iter * iter = &index->frontier;
+
+    // 2. the position is scanned, resume from the closest checkpoint
+    if (input_array_position < iter->position) {
+        const size_t k = input_array_position / index->interval;
+
+        JSON_Iter local = *iter;
+        local.index    = index->checkpoints[k];
+        local.position = k * index->interval;
+        local.state    = JSON_ITER_STATE_VALUE;
+        iter = &local;
+
+        int result;
+        while ((result = json_array_iter_next(iter, output_value_startIndex, output_value_endIndex, output_value_jsonType)) == 0) {
+            if (iter->position > input_array_position) {
+                return 0;
+            }
+        }
+        return result == 1 ? json_error_set(JSON_ERROR_NOT_FOUND, iter->index) : -1;
+    }
+
+    // 3. move the frontier and add the checkpoints on the way
+    int result;
+    size_t value_startIndex, value_endIndex;
+    int value_jsonType;
+    for (;;) {
+        const JSON_Iter previous = *iter;
+        if ((result = json_array_iter_next(iter, &value_startIndex, &value_endIndex, &value_jsonType)) != 0) {
+            break;
+        }
+
+        const size_t position = iter->position - 1;
+
+        if (position % index->interval == 0) {
+            if (index->size == index->capacity) {
+                size_t capacity = index->capacity == 0 ? 64 : index->capacity * 2;
+                size_t * checkpoints = realloc(index->checkpoints, capacity * sizeof(size_t));
+                if (checkpoints == NULL) {
+                    JSON_LOG("%s: out of memory\n", __func__);
+                    // roll the frontier back, every position behind it keeps its checkpoint, the value is scanned again by the next call
+                    *iter = previous;
+                    return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+                }
+                index->checkpoints = checkpoints;
+                index->capacity = capacity;
+            }
+            index->checkpoints[index->size++] = value_startIndex;
+        }
+
+        if (position == input_array_position) {
+            *output_value_startIndex = value_startIndex;
+            *output_value_endIndex   = value_endIndex;
+            *output_value_jsonType   = value_jsonType;
+            return 0;
+        }
+    }
+
+    // 4. it's the end of the array
+    if (result == 1) {
+        index->count = iter->position;
+        return json_error_set(JSON_ERROR_NOT_FOUND, iter->index);
+    }
+
+    return -1;
+}
+
+// 1-53. Convert JSON integer to int64 exactly
+int json_number_toInt64(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, int64_t * output_int64, int * output_error) {
+    // check arguments
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_int64 == NULL) {
+        JSON_LOG("%s: output_int64 should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_int64 = 0;
+
+    uint64_t magnitude;
+    int negative;
+    int error = json_number_parseInteger_n(input_string, input_string_length, input_string_startIndex, &magnitude, &negative);
+
+    // the magnitude of INT64_MIN is INT64_MAX + 1
+    if (error == JSON_NUMBER_ERROR_NONE && magnitude > (uint64_t) INT64_MAX + negative) {
+        error = JSON_NUMBER_ERROR_OVERFLOW;
+    }
+
+    if (output_error != NULL) {
+        *output_error = error;
+    }
+
+    if (error != JSON_NUMBER_ERROR_NONE) {
+        return -1;
+    }
+
+    *output_int64 = negative ? (int64_t) (0 - magnitude) : (int64_t) magnitude;
+    return 0;
+}
+
+// 1-54. Convert JSON integer to uint64 exactly
+int json_number_toUInt64(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, uint64_t * output_uint64, int * output_error) {
+    // check arguments
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_uint64 == NULL) {
+        JSON_LOG("%s: output_uint64 should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_uint64 = 0;
+
+    uint64_t magnitude;
+    int negative;
+    int error = json_number_parseInteger_n(input_string, input_string_length, input_string_startIndex, &magnitude, &negative);
+
+    // -0 is 0
+    if (error == JSON_NUMBER_ERROR_NONE && negative && magnitude != 0) {
+        error = JSON_NUMBER_ERROR_OVERFLOW;
+    }
+
+    if (output_error != NULL) {
+        *output_error = error;
+    }
+
+    if (error != JSON_NUMBER_ERROR_NONE) {
+        return -1;
+    }
+
+    *output_uint64 = magnitude;
+    return 0;
+}
+
+// 1-55. Get int64 by JS
+int json_getInt64ByJS(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, const char * input_keys, const size_t input_keys_length, int64_t * output_int64, int * output_error) {
+    // check arguments
+    if (output_int64 == NULL) {
+        JSON_LOG("%s: output_int64 should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_int64 = 0;
+
+    size_t value_startIndex, value_endIndex;
+    int value_jsonType;
+    if (json_getValueByJS_n(input_string, input_string_length, input_string_startIndex, input_keys, input_keys_length, 0, &value_startIndex, &value_endIndex, &value_jsonType) != 0 || value_jsonType != JSON_TYPE_NUMBER) {
+        if (output_error != NULL) {
+            *output_error = JSON_NUMBER_ERROR_NOT_NUMBER;
+        }
+        return -1;
+    }
+
+    return json_number_toInt64(input_string, input_string_length, value_startIndex, output_int64, output_error);
+}
+
+// 1-56. Unescape JSON string into the buffer
+int json_string_unescape(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, char * output_buffer, const size_t output_buffer_size, size_t * output_length) {
+    // check arguments
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_buffer == NULL && output_buffer_size != 0) {
+        JSON_LOG("%s: output_buffer should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_length == NULL) {
+        JSON_LOG("%s: output_length should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_length = 0;
+
+    size_t endIndex;
+    if (json_string_unescape_n(input_string, input_string_length, input_string_startIndex, output_buffer, output_buffer_size, output_length, &endIndex) != 0) {
+        return -1;
+    }
+
+    // no room for '\0'
+    if (*output_length >= output_buffer_size) {
+        return 1;
+    }
+
+    output_buffer[*output_length] = '\0';
+    return 0;
+}
+
+// 1-57. Get the characters of JSON string in place if there is no escape
+int json_string_getSlice(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, const char ** output_slice, size_t * output_slice_length) {
+    // check arguments
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_slice == NULL) {
+        JSON_LOG("%s: output_slice should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_slice_length == NULL) {
+        JSON_LOG("%s: output_slice_length should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_slice = NULL;
+    *output_slice_length = 0;
+
+    if (json_util_charAt(input_string, input_string_length, input_string_startIndex) != '\"') {
+        return -1;
+    }
+
+    // 1. the plain string is the slice of the input string
+    size_t i;
+    if (json_string_skipCharacters(input_string, input_string_length, input_string_startIndex + 1, &i) != 0) {
+        return -1;
+    }
+
+    if (json_util_charAt(input_string, input_string_length, i) == '\"') {
+        *output_slice = input_string + input_string_startIndex + 1;
+        *output_slice_length = i - input_string_startIndex - 1;
+        return 0;
+    }
+
+    // 2. the escaped string should be unescaped, the length is the unescaped length
+    size_t endIndex;
+    if (json_string_unescape_n(input_string, input_string_length, input_string_startIndex, NULL, 0, output_slice_length, &endIndex) != 0) {
+        return -1;
+    }
+    return 1;
+}
+
+// 1-58. Get the last error of the calling thread
+int json_getLastError(JSON_Error * output_error) {
+    // check arguments
+    if (output_error == NULL) {
+        JSON_LOG("%s: output_error should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_error = json_error_last;
+    return 0;
+}
+
+// 1-59. JSON error description
+const char * json_error_toString(int code) {
+    switch (code) {
+        case JSON_ERROR_NONE:             return "none";
+        case JSON_ERROR_INVALID_ARGUMENT: return "invalid argument";
+        case JSON_ERROR_OUT_OF_MEMORY:    return "out of memory";
+        case JSON_ERROR_SYNTAX:           return "syntax error";
+        case JSON_ERROR_NOT_FOUND:        return "not found";
+        case JSON_ERROR_IO:               return "I/O error";
+        default:                          return "unknown";
+    }
+}
+
+// 1-60. Create the push parser
+int json_feed_create(JSON_Feed_Callback input_callback, void * input_user_data, JSON_Feed ** output_feed) {
+    // check arguments
+    if (output_feed == NULL) {
+        JSON_LOG("%s: output_feed should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_feed = NULL;
+
+    JSON_Feed * feed = calloc(1, sizeof(JSON_Feed));
+    if (feed == NULL) {
+        JSON_LOG("%s: out of memory\n", __func__);
+        return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+    }
+
+    // the root path is an empty string
+    if (json_feed_reserve(&feed->path, &feed->path_capacity, 1) != 0) {
+        free(feed);
+        return -1;
+    }
+    feed->path[0] = '\0';
+
+    feed->callback  = input_callback;
+    feed->user_data = input_user_data;
+    feed->state     = JSON_FEED_STATE_VALUE;
+    feed->token     = JSON_FEED_TOKEN_NONE;
+
+    *output_feed = feed;
+    return 0;
+}
+
+// 1-61. Parse the next chunk, the token split by the chunk boundary is kept in the buffer
+int json_feed(JSON_Feed * feed, const char * input_chunk, const size_t input_length) {
+    // check arguments
+    if (feed == NULL) {
+        JSON_LOG("%s: feed should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (input_chunk == NULL && input_length > 0) {
+        JSON_LOG("%s: input_chunk should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (feed->state == JSON_FEED_STATE_STOPPED) {
+        return 1;
+    }
+
+    if (feed->state == JSON_FEED_STATE_ERROR) {
+        JSON_LOG("%s: the document is invalid\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    const char * s = input_chunk;
+    const size_t length = input_length;
+    size_t i = 0;
+    size_t token_startIndex = 0;    // the token resumed from the previous chunk starts at 0
+    int result;
+
+    while (i < length) {
+        // 1. the token in progress, it's complete if it ends in the chunk
+        if (feed->token != JSON_FEED_TOKEN_NONE) {
+            i = json_feed_scanToken(feed, s, length, i);
+            if (i == JSON_INDEX_NONE) {
+                break;
+            }
+
+            result = json_feed_finishToken(feed, s, token_startIndex, i);
+            if (result != 0) {
+                return result;
+            }
+            continue;
+        }
+
+        // 2. filter the blank, util find the next character
+        const char c = json_util_skipWhitespace(s, length, &i);
+        if (i >= length) {
+            break;
+        }
+
+        result = 0;
+        switch (feed->state) {
+            // 2-1. the value, or the right square bracket of the empty array
+            case JSON_FEED_STATE_FIRST_VALUE:
+                if (c == ']') {
+                    result = json_feed_closeFrame(feed, s + i);
+                    i++;
+                    break;
+                }
+                // fall through
+
+            case JSON_FEED_STATE_VALUE:
+                switch (c) {
+                    case '{':
+                        result = json_feed_openFrame(feed, JSON_TYPE_OBJECT, s + i);
+                        i++;
+                        break;
+
+                    case '[':
+                        result = json_feed_openFrame(feed, JSON_TYPE_ARRAY, s + i);
+                        i++;
+                        break;
+
+                    case '\"':
+                        feed->token = JSON_FEED_TOKEN_STRING;
+                        break;
+
+                    case '-':
+                    case '0': case '1': case '2': case '3': case '4':
+                    case '5': case '6': case '7': case '8': case '9':
+                        feed->token = JSON_FEED_TOKEN_NUMBER;
+                        break;
+
+                    case 't':
+                    case 'f':
+                    case 'n':
+                        feed->token = JSON_FEED_TOKEN_LITERAL;
+                        break;
+
+                    default:
+                        goto invalid_character;
+                }
+
+                // the path of the array element is known when the value starts
+                if (feed->token != JSON_FEED_TOKEN_NONE && json_feed_beginValue(feed) != 0) {
+                    feed->state = JSON_FEED_STATE_ERROR;
+                    return -1;
+                }
+                break;
+
+            // 2-2. the key, or the right curly bracket of the empty object
+            case JSON_FEED_STATE_FIRST_KEY:
+                if (c == '}') {
+                    result = json_feed_closeFrame(feed, s + i);
+                    i++;
+                    break;
+                }
+                // fall through
+
+            case JSON_FEED_STATE_KEY:
+                if (c != '\"') {
+                    goto invalid_character;
+                }
+                feed->token = JSON_FEED_TOKEN_KEY;
+                break;
+
+            // 2-3. the colon behind the key
+            case JSON_FEED_STATE_COLON:
+                if (c != ':') {
+                    goto invalid_character;
+                }
+                feed->state = JSON_FEED_STATE_VALUE;
+                i++;
+                break;
+
+            // 2-4. the comma or the right bracket of the innermost object or array
+            case JSON_FEED_STATE_SEPARATOR: {
+                const int jsonType = feed->frames[feed->depth - 1].jsonType;
+                if (c == ',') {
+                    feed->state = jsonType == JSON_TYPE_OBJECT ? JSON_FEED_STATE_KEY : JSON_FEED_STATE_VALUE;
+                    i++;
+                } else if ((c == '}' && jsonType == JSON_TYPE_OBJECT) || (c == ']' && jsonType == JSON_TYPE_ARRAY)) {
+                    result = json_feed_closeFrame(feed, s + i);
+                    i++;
+                } else {
+                    goto invalid_character;
+                }
+                break;
+            }
+
+            // 2-5. only the whitespace is behind the root value
+            default:
+                goto invalid_character;
+        }
+
+        if (result != 0) {
+            return result;
+        }
+
+        // the token starts at the index
+        if (feed->token != JSON_FEED_TOKEN_NONE) {
+            token_startIndex = i;
+            feed->token_offset = feed->offset + i;
+            feed->escape = 0;
+            if (feed->token == JSON_FEED_TOKEN_STRING || feed->token == JSON_FEED_TOKEN_KEY) {
+                i++;
+            }
+        }
+    }
+
+    // keep the head of the token split by the chunk boundary
+    if (feed->token != JSON_FEED_TOKEN_NONE && token_startIndex < length) {
+        if (json_feed_reserve(&feed->buffer, &feed->buffer_capacity, feed->buffer_size + (length - token_startIndex)) != 0) {
+            feed->state = JSON_FEED_STATE_ERROR;
+            return -1;
+        }
+        memcpy(feed->buffer + feed->buffer_size, s + token_startIndex, length - token_startIndex);
+        feed->buffer_size += length - token_startIndex;
+    }
+
+    feed->offset += length;
+    return 0;
+
+invalid_character:
+    JSON_LOG("%s: invalid character at %zu\n", __func__, feed->offset + i);
+    feed->state = JSON_FEED_STATE_ERROR;
+    return json_error_set(JSON_ERROR_SYNTAX, feed->offset + i);
+}
+
+// 1-62. Finish the document
+int json_feed_end(JSON_Feed * feed) {
+    // check arguments
+    if (feed == NULL) {
+        JSON_LOG("%s: feed should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (feed->state == JSON_FEED_STATE_STOPPED) {
+        return 1;
+    }
+
+    if (feed->state == JSON_FEED_STATE_ERROR) {
+        JSON_LOG("%s: the document is invalid\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    // the number or literal is ended by the end of the stream, the string is not
+    if (feed->token == JSON_FEED_TOKEN_NUMBER || feed->token == JSON_FEED_TOKEN_LITERAL) {
+        const int result = json_feed_finishToken(feed, NULL, 0, 0);
+        if (result != 0) {
+            return result;
+        }
+    }
+
+    if (feed->state != JSON_FEED_STATE_DONE) {
+        JSON_LOG("%s: the document is incomplete\n", __func__);
+        feed->state = JSON_FEED_STATE_ERROR;
+        return json_error_set(JSON_ERROR_SYNTAX, feed->offset);
+    }
+
+    return 0;
+}
+
+// 1-63. Free the push parser
+int json_feed_free(JSON_Feed * feed) {
+
+    if (feed == NULL) {
+        return 0;
+    }
+
+    free(feed->buffer);
+    free(feed->path);
+    free(feed->frames);
+    free(feed);
+    return 0;
+}
+
+// 1-64. Read the JSON Lines records by the worker threads
+int json_lines_read(const char * input_string, const size_t input_string_length, const size_t input_threads, const int input_ordered, JSON_Record_Callback input_process, JSON_Result_Callback input_deliver, void * input_user_data) {
+    // check arguments
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (input_string_length == JSON_LENGTH_UNBOUNDED) {
+        JSON_LOG("%s: input_string_length should be the length of the string\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    // 1. the count of the threads, there is no more threads than batches
+    size_t threads = 1;
+#if JSON_THREADS
+    threads = input_threads;
+    if (threads == 0) {
+        const long processors = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = processors > 0 ? (size_t) processors : 1;
+    }
+
+    const size_t batches = input_string_length / JSON_LINES_BATCH_SIZE + 1;
+    if (threads > batches) {
+        threads = batches;
+    }
+#else
+    (void) input_threads;
+#endif
+
+    JSON_Lines_Reader reader;
+    memset(&reader, 0, sizeof(reader));
+    reader.string    = input_string;
+    reader.length    = input_string_length;
+    reader.ordered   = input_ordered;
+    reader.process   = input_process;
+    reader.deliver   = input_deliver;
+    reader.user_data = input_user_data;
+
+    JSON_Lines_Worker * workers = calloc(threads, sizeof(JSON_Lines_Worker));
+    if (workers == NULL) {
+        JSON_LOG("%s: out of memory\n", __func__);
+        return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+    }
+
+    // 2. the scratch state of each worker
+    size_t k;
+    for (k = 0; k < threads; k++) {
+        workers[k].reader = &reader;
+        if (json_arena_create(0, &workers[k].scratch) != 0) {
+            reader.result = -1;
+            goto cleanup;
+        }
+    }
+
+    // 3. the calling thread is the first worker
+#if JSON_THREADS
+    pthread_mutex_init(&reader.mutex, NULL);
+    pthread_cond_init(&reader.turn, NULL);
+
+    pthread_t * ids = malloc(threads * sizeof(pthread_t));
+    size_t started = 0;
+    if (ids != NULL) {
+        // the reading goes on with fewer workers if the thread can't be created
+        while (started + 1 < threads && pthread_create(&ids[started], NULL, json_lines_work, &workers[started + 1]) == 0) {
+            started++;
+        }
+    }
+
+    json_lines_work(&workers[0]);
+
+    for (k = 0; k < started; k++) {
+        pthread_join(ids[k], NULL);
+    }
+    free(ids);
+
+    pthread_cond_destroy(&reader.turn);
+    pthread_mutex_destroy(&reader.mutex);
+#else
+    json_lines_work(&workers[0]);
+#endif
+
+cleanup:
+    for (k = 0; k < threads; k++) {
+        json_arena_free(workers[k].scratch);
+        free(workers[k].tape.entries);
+        free(workers[k].records);
+    }
+    free(workers);
+
+    if (reader.result == -1) {
+        json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+    }
+    return reader.result;
+}
+
+// 1-65. Load the JSON file by mapping or reading it
+int json_document_open(const char * input_path, JSON_Document ** output_document) {
+    // check arguments
+    if (input_path == NULL) {
+        JSON_LOG("%s: input_path should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_document == NULL) {
+        JSON_LOG("%s: output_document should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_document = NULL;
+
+    JSON_Document * document = calloc(1, sizeof(JSON_Document));
+    if (document == NULL) {
+        JSON_LOG("%s: out of memory\n", __func__);
+        return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+    }
+
+    const int fd = open(input_path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        JSON_LOG("%s: %s: %s\n", __func__, input_path, strerror(errno));
+        free(document);
+        return json_error_set(JSON_ERROR_IO, JSON_INDEX_NONE);
+    }
+
+    // 1. map the regular file, the size of the pipe or the special file is unknown
+    struct stat st;
+    int result = -1;
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+        result = json_document_map(document, fd, (size_t) st.st_size);
+        if (result != 0) {
+            result = json_document_read(document, fd, (size_t) st.st_size);
+        }
+    } else {
+        result = json_document_read(document, fd, 0);
+    }
+
+    // the error of read is kept
+    const int error = errno;
+    close(fd);
+    errno = error;
+
+    if (result != 0) {
+        free(document);
+        return -1;
+    }
+
+    *output_document = document;
+    return 0;
+}
+
+// 1-66. Unmap or free the document
+int json_document_close(JSON_Document * document) {
+
+    if (document == NULL) {
+        return 0;
+    }
+
+    if (document->mapping != NULL) {
+        munmap(document->mapping, document->mapping_size);
+    } else {
+        free((void *) document->string);
+    }
+
+    free(document);
+    return 0;
+}
+
+// 1-67. Array Get Key Value Pair List by the threads
+int json_array_getKeyValuePairList_parallel(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, const size_t input_threads, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size) {
+    // check arguments
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_keyValuePairList == NULL) {
+        JSON_LOG("%s: output_keyValuePairList should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_keyValuePairList_size == NULL) {
+        JSON_LOG("%s: output_keyValuePairList_size should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_keyValuePairList = NULL;
+    *output_keyValuePairList_size = 0;
+
+    // 1. the count of the chunks, the small array is got in one pass
+    size_t threads = 1;
+#if JSON_THREADS
+    threads = input_threads;
+    if (threads == 0) {
+        const long processors = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = processors > 0 ? (size_t) processors : 1;
+    }
+
+    if (input_string_length != JSON_LENGTH_UNBOUNDED && input_string_startIndex < input_string_length) {
+        const size_t chunks = (input_string_length - input_string_startIndex) / JSON_PARALLEL_CHUNK_SIZE;
+        if (threads > chunks) {
+            threads = chunks;
+        }
+    } else {
+        threads = 1;
+    }
+#else
+    (void) input_threads;
+#endif
+
+    if (threads <= 1 || input_string[input_string_startIndex] != '[') {
+        return json_array_getKeyValuePairList_alloc(NULL, NULL, input_string, input_string_length, input_string_startIndex, output_keyValuePairList, output_keyValuePairList_size);
+    }
+
+    JSON_Parallel_Chunk * chunks = calloc(threads, sizeof(JSON_Parallel_Chunk));
+    if (chunks == NULL) {
+        JSON_LOG("%s: out of memory\n", __func__);
+        return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+    }
+
+    // 2. split the characters behind the left square bracket, the chunk never starts behind a reverse solidus,
+    //    so the character at the start of the chunk is never escaped
+    const size_t size = (input_string_length - input_string_startIndex - 1) / threads;
+    size_t k;
+    for (k = 0; k < threads; k++) {
+        JSON_Parallel_Chunk * chunk = &chunks[k];
+        chunk->string = input_string;
+        chunk->length = input_string_length;
+        chunk->startIndex = k == 0 ? input_string_startIndex + 1 : chunks[k - 1].endIndex;
+        chunk->endIndex = input_string_startIndex + 1 + size * (k + 1);
+        if (k == threads - 1 || chunk->endIndex < chunk->startIndex) {
+            chunk->endIndex = k == threads - 1 ? input_string_length : chunk->startIndex;
+        }
+        while (chunk->endIndex < input_string_length && chunk->endIndex > chunk->startIndex && input_string[chunk->endIndex - 1] == '\\') {
+            chunk->endIndex++;
+        }
+    }
+
+    // 3. scan the chunks for both string states at the start, then resolve the states from the first chunk
+    json_parallel_run(json_parallel_scanChunk, chunks, threads);
+
+    chunks[0].inString = 0;
+    chunks[0].depth = 1;
+    for (k = 1; k < threads; k++) {
+        const JSON_Parallel_Chunk * previous = &chunks[k - 1];
+        chunks[k].inString = previous->inString_end[previous->inString];
+        chunks[k].depth = previous->depth + previous->depth_delta[previous->inString];
+    }
+
+    // 4. get the pairs of each chunk from its first element, the first element of the array is behind the left square bracket
+    for (k = 0; k < threads; k++) {
+        chunks[k].first = k == 0 ? input_string_startIndex : JSON_INDEX_NONE;
+        chunks[k].next  = JSON_INDEX_NONE;
+    }
+    json_parallel_run(json_parallel_sliceChunk, chunks, threads);
+
+    // 5. confirm the slices are chained, the comma where a slice stops is the first comma of the next slice
+    size_t count = 0;
+    size_t last = 0;
+    k = 0;
+    for (;;) {
+        JSON_Parallel_Chunk * chunk = &chunks[k];
+        if (chunk->failed) {
+            goto fallback;
+        }
+
+        chunk->base = count;
+        count += chunk->size;
+        last = k;
+
+        if (chunk->next == JSON_INDEX_NONE) {
+            break;
+        }
+
+        // the chunks inside the element have no slice
+        for (k++; k < threads && chunks[k].endIndex <= chunk->next; k++) {
+            if (chunks[k].first != JSON_INDEX_NONE) {
+                goto fallback;
+            }
+        }
+
+        if (k == threads || chunks[k].first != chunk->next) {
+            goto fallback;
+        }
+    }
+
+    // 6. link the slices in order and discard the slices behind the array
+    JSON_Key_Value_Pair * tail = NULL;
+    for (k = 0; k < threads; k++) {
+        JSON_Parallel_Chunk * chunk = &chunks[k];
+        if (k > last) {
+            json_keyValuePair_free(chunk->head);
+            chunk->head = NULL;
+            chunk->size = 0;
+            continue;
+        }
+
+        if (chunk->head == NULL) {
+            continue;
+        }
+
+        if (tail == NULL) {
+            *output_keyValuePairList = chunk->head;
+        } else {
+            tail->next = chunk->head;
+        }
+        tail = chunk->tail;
+    }
+
+    // 7. the key is the position in the whole array
+    json_parallel_run(json_parallel_assignKeys, chunks, last + 1);
+
+    int result = 0;
+    for (k = 0; k <= last; k++) {
+        if (chunks[k].failed) {
+            result = -1;
+        }
+    }
+
+    free(chunks);
+
+    if (result != 0) {
+        json_keyValuePair_free(*output_keyValuePairList);
+        *output_keyValuePairList = NULL;
+        return -1;
+    }
+
+    *output_keyValuePairList_size = count;
+    return 0;
+
+fallback:
+    // the boundaries can't be confirmed, the invalid array is reported by the one pass
+    JSON_LOG("%s: the chunk boundaries can't be confirmed\n", __func__);
+    for (k = 0; k < threads; k++) {
+        json_keyValuePair_free(chunks[k].head);
+    }
+    free(chunks);
+    return json_array_getKeyValuePairList_alloc(NULL, NULL, input_string, input_string_length, input_string_startIndex, output_keyValuePairList, output_keyValuePairList_size);
+}
+
+// 1-68. Get the values of all paths for each document by the threads
+int json_path_evalBatch(const JSON_Path_Set * set, const char * const * input_strings, const size_t * input_lengths, const size_t input_count, const size_t input_threads, JSON_Value_Range * output_values) {
+    // check arguments
+    if (set == NULL) {
+        JSON_LOG("%s: set should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (input_strings == NULL && input_count > 0) {
+        JSON_LOG("%s: input_strings should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_values == NULL && input_count > 0) {
+        JSON_LOG("%s: output_values should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    JSON_Batch batch;
+    batch.set     = set;
+    batch.strings = input_strings;
+    batch.lengths = input_lengths;
+    batch.values  = output_values;
+
+    // 1. the count of the threads, there is no more threads than documents
+    size_t threads = 1;
+#if JSON_THREADS
+    threads = input_threads;
+    if (threads == 0) {
+        const long processors = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = processors > 0 ? (size_t) processors : 1;
+    }
+
+    if (threads > input_count) {
+        threads = input_count;
+    }
+#else
+    (void) input_threads;
+#endif
+
+    // 2. the matched flags of the set walk for each thread, a flag for each node, on their own cache lines
+    const size_t scratch_size = (set->nodes_size + 63) & ~(size_t) 63;
+    unsigned char * scratch = malloc(scratch_size * (threads > 1 ? threads : 1));
+    if (scratch == NULL) {
+        size_t i;
+        for (i = 0; i < input_count * set->size; i++) {
+            output_values[i].startIndex = JSON_INDEX_NONE;
+            output_values[i].endIndex   = JSON_INDEX_NONE;
+            output_values[i].jsonType   = -1;
+        }
+        JSON_LOG("%s: out of memory\n", __func__);
+        return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+    }
+
+    // the documents are evaluated in the calling thread if the workers can't be allocated
+    size_t k;
+    batch.workers = threads > 1 ? calloc(threads, sizeof(JSON_Batch_Worker)) : NULL;
+    if (batch.workers == NULL) {
+        for (k = 0; k < input_count; k++) {
+            json_batch_eval(&batch, k, scratch);
+        }
+        free(scratch);
+        return 0;
+    }
+    batch.size = threads;
+
+    // 3. each queue starts with an equal range of the documents
+#if JSON_THREADS
+    for (k = 0; k < threads; k++) {
+        JSON_Batch_Worker * worker = &batch.workers[k];
+        worker->batch   = &batch;
+        worker->id      = k;
+        worker->scratch = scratch + scratch_size * k;
+        worker->queue.top    = input_count / threads * k + (k < input_count % threads ? k : input_count % threads);
+        worker->queue.bottom = worker->queue.top + input_count / threads + (k < input_count % threads);
+        pthread_mutex_init(&worker->queue.mutex, NULL);
+    }
+
+    // 4. the calling thread is the first worker, the queue of the thread which can't be created is stolen by the others
+    pthread_t * ids = malloc(threads * sizeof(pthread_t));
+    char * started = calloc(threads, sizeof(char));
+    for (k = 1; k < threads && ids != NULL && started != NULL; k++) {
+        started[k] = pthread_create(&ids[k], NULL, json_batch_work, &batch.workers[k]) == 0;
+    }
+
+    json_batch_work(&batch.workers[0]);
+
+    for (k = 1; k < threads && started != NULL; k++) {
+        if (started[k]) {
+            pthread_join(ids[k], NULL);
+        }
+    }
+    free(started);
+    free(ids);
+
+    for (k = 0; k < threads; k++) {
+        pthread_mutex_destroy(&batch.workers[k].queue.mutex);
+    }
+#endif
+
+    free(batch.workers);
+    free(scratch);
+    return 0;
+}
+
+// 1-69. Create the path cache of the string
+int json_cache_create(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, const size_t input_capacity, JSON_Cache ** output_cache) {
+    // check arguments
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_cache == NULL) {
+        JSON_LOG("%s: output_cache should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_cache = NULL;
+
+    const size_t capacity = input_capacity == 0 ? JSON_CACHE_CAPACITY : input_capacity;
+    size_t buckets = 16;
+    while (buckets < capacity && buckets <= SIZE_MAX / 4 / sizeof(size_t)) {
+        buckets *= 2;
+    }
+
+    JSON_Cache * cache = calloc(1, sizeof(JSON_Cache));
+    if (cache == NULL) {
+        JSON_LOG("%s: out of memory\n", __func__);
+        return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+    }
+
+    cache->entries = calloc(capacity, sizeof(JSON_Cache_Entry));
+    cache->buckets = malloc(buckets * sizeof(size_t));
+    if (cache->entries == NULL || cache->buckets == NULL) {
+        JSON_LOG("%s: out of memory\n", __func__);
+        json_cache_free(cache);
+        return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+    }
+
+    size_t i;
+    for (i = 0; i < buckets; i++) {
+        cache->buckets[i] = JSON_INDEX_NONE;
+    }
+
+    cache->string       = input_string;
+    cache->length       = input_string_length;
+    cache->startIndex   = input_string_startIndex;
+    cache->capacity     = capacity;
+    cache->newest       = JSON_INDEX_NONE;
+    cache->oldest       = JSON_INDEX_NONE;
+    cache->buckets_mask = buckets - 1;
+
+    *output_cache = cache;
+    return 0;
+}
+
+// 1-70. Free the path cache
+int json_cache_free(JSON_Cache * cache) {
+
+    if (cache == NULL) {
+        return 0;
+    }
+
+    size_t i;
+    for (i = 0; i < cache->size; i++) {
+        free(cache->entries[i].prefix);
+    }
+
+    free(cache->entries);
+    free(cache->buckets);
+    free(cache->steps);
+    free(cache->prefix);
+    free(cache);
+    return 0;
+}
+
+// 1-71. Get value by Javascript Syntax, start from the longest cached prefix of the keys
+int json_cache_getValueByJS(JSON_Cache * cache, const char * input_keys, const size_t input_keys_length, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType) {
+    // check arguments
+    if (cache == NULL) {
+        JSON_LOG("%s: cache should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (input_keys == NULL) {
+        JSON_LOG("%s: input_keys should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_startIndex == NULL) {
+        JSON_LOG("%s: output_value_startIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_endIndex == NULL) {
+        JSON_LOG("%s: output_value_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_jsonType == NULL) {
+        JSON_LOG("%s: output_value_jsonType should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_value_startIndex = JSON_INDEX_NONE;
+    *output_value_endIndex   = JSON_INDEX_NONE;
+    *output_value_jsonType   = -1;
+
+    // 1. split the keys into the steps and their canonical prefixes
+    size_t size;
+    if (json_cache_parseKeys(cache, input_keys, input_keys_length, &size) != 0) {
+        return -1;
+    }
+
+    // 2. find the longest cached prefix, the shorter prefixes might be evicted before the longer ones
+    size_t depth = size;
+    size_t entry = JSON_INDEX_NONE;
+    while (depth > 0 && (entry = json_cache_find(cache, &cache->steps[depth - 1])) == JSON_INDEX_NONE) {
+        depth--;
+    }
+
+    size_t value_startIndex = cache->startIndex;
+    size_t value_endIndex = JSON_INDEX_NONE;
+    int value_jsonType = -1;
+
+    if (entry != JSON_INDEX_NONE) {
+        value_startIndex = cache->entries[entry].value_startIndex;
+        value_endIndex   = cache->entries[entry].value_endIndex;
+        value_jsonType   = cache->entries[entry].value_jsonType;
+
+        json_cache_unlink(cache, entry);
+        json_cache_pushNewest(cache, entry);
+    }
+
+    // 3. resolve the rest of the steps, and cache each resolved prefix
+    for (; depth < size; depth++) {
+        const JSON_Cache_Step * step = &cache->steps[depth];
+
+        if (step->type == JSON_TYPE_STRING) {
+            if (json_object_getValueByKey_n(cache->string, cache->length, value_startIndex, input_keys, step->key_startIndex, step->key_endIndex, &value_startIndex, &value_endIndex, &value_jsonType) != 0) {
+                return -1;
+            }
+        }
+        else {
+            if (json_array_getValueByPosition_n(cache->string, cache->length, value_startIndex, step->position, &value_startIndex, &value_endIndex, &value_jsonType) != 0) {
+                return -1;
+            }
+        }
+
+        json_cache_insert(cache, step, value_startIndex, value_endIndex, value_jsonType);
+    }
+
+    *output_value_startIndex = value_startIndex;
+    *output_value_endIndex   = value_endIndex;
+    *output_value_jsonType   = value_jsonType;
+    return 0;
+}
+
+// 1-72. Create the intern table
+int json_intern_create(const size_t input_value_length, JSON_Intern ** output_intern) {
+    // check arguments
+    if (output_intern == NULL) {
+        JSON_LOG("%s: output_intern should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_intern = NULL;
+
+    JSON_Intern * intern = calloc(1, sizeof(JSON_Intern));
+    if (intern == NULL) {
+        JSON_LOG("%s: out of memory\n", __func__);
+        return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+    }
+
+    if (json_arena_create(0, &intern->strings) != 0) {
+        free(intern);
+        return -1;
+    }
+
+    intern->value_length = input_value_length == 0 ? JSON_INTERN_VALUE_LENGTH : input_value_length;
+
+    *output_intern = intern;
+    return 0;
+}
+
+// 1-73. Free the intern table and the interned strings
+int json_intern_free(JSON_Intern * intern) {
+
+    if (intern == NULL) {
+        return 0;
+    }
+
+    json_arena_free(intern->strings);
+    free(intern->slots);
+    free(intern);
+    return 0;
+}
+
+// 1-74. Get the interned copy of the string
+int json_intern_string(JSON_Intern * intern, const char * input_string, const size_t input_string_length, const char ** output_string) {
+    // check arguments
+    if (intern == NULL) {
+        JSON_LOG("%s: intern should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_string == NULL) {
+        JSON_LOG("%s: output_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    char * string;
+    if (json_intern_find(intern, input_string, input_string_length, &string) != 0) {
+        *output_string = NULL;
+        return -1;
+    }
+
+    *output_string = string;
+    return 0;
+}
+
+// 1-75. object get key value pair list in the arena, the keys and the short values are interned
+int json_object_getKeyValuePairList_intern(JSON_Arena * arena, JSON_Intern * intern, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size) {
+    // check arguments
+    if (arena == NULL) {
+        JSON_LOG("%s: arena should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (intern == NULL) {
+        JSON_LOG("%s: intern should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    return json_object_getKeyValuePairList_alloc(arena, intern, input_string, input_string_length, input_string_startIndex, output_keyValuePairList, output_keyValuePairList_size);
+}
+
+// 1-76. array get key value pair list in the arena, the keys and the short values are interned
+int json_array_getKeyValuePairList_intern(JSON_Arena * arena, JSON_Intern * intern, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size) {
+    // check arguments
+    if (arena == NULL) {
+        JSON_LOG("%s: arena should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (intern == NULL) {
+        JSON_LOG("%s: intern should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    return json_array_getKeyValuePairList_alloc(arena, intern, input_string, input_string_length, input_string_startIndex, output_keyValuePairList, output_keyValuePairList_size);
+}
+
+// 1-77. object or array get key value pair list in the arena, the keys and the short values are interned
+int json_getKeyValuePairList_intern(JSON_Arena * arena, JSON_Intern * intern, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size) {
+    if (json_object_getKeyValuePairList_intern(arena, intern, input_string, input_string_length, input_string_startIndex, output_keyValuePairList, output_keyValuePairList_size) == 0) {
+        return 0;
+    }
+
+    if (json_array_getKeyValuePairList_intern(arena, intern, input_string, input_string_length, input_string_startIndex, output_keyValuePairList, output_keyValuePairList_size) == 0) {
+        return 0;
+    }
+
+    return -1;
+}
+
+// 2-1. Object Get Key Value Pair List
+int json_object_getKeyValuePairList(const char * input_string, const int input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, int * output_keyValuePairList_size) {
+    // check arguments
+    if (input_string_startIndex < 0) {
+        JSON_LOG("%s: input_string_startIndex (%d) should not be negative\n", __func__, input_string_startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_keyValuePairList_size == NULL) {
+        JSON_LOG("%s: output_keyValuePairList_size should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    size_t size = 0;
+    int result = json_object_getKeyValuePairList_n(input_string, JSON_LENGTH_UNBOUNDED, input_string_startIndex, output_keyValuePairList, &size);
+
+    *output_keyValuePairList_size = (int) size;
+    return result;
+}
+
+// 2-2. Array Get Key Value Pair List
+int  json_array_getKeyValuePairList(const char * input_string, const int input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, int * output_keyValuePairList_size) {
+    // check arguments
+    if (input_string_startIndex < 0) {
+        JSON_LOG("%s: input_string_startIndex (%d) should not be negative\n", __func__, input_string_startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_keyValuePairList_size == NULL) {
+        JSON_LOG("%s: output_keyValuePairList_size should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    size_t size = 0;
+    int result = json_array_getKeyValuePairList_n(input_string, JSON_LENGTH_UNBOUNDED, input_string_startIndex, output_keyValuePairList, &size);
+
+    *output_keyValuePairList_size = (int) size;
+    return result;
+}
+
+// 2-3. Get Key Value Pair
+int json_getKeyValuePair(const char * input_string, const int input_string_startIndex, int * output_key_startIndex, int * output_key_endIndex, int * output_value_startIndex, int * output_value_endIndex, int * output_value_jsonType) {
+    // check arguments
+    if (input_string_startIndex < 0) {
+        JSON_LOG("%s: input_string_startIndex (%d) should not be negative\n", __func__, input_string_startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_key_startIndex == NULL) {
+        JSON_LOG("%s: output_key_startIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_key_endIndex == NULL) {
+        JSON_LOG("%s: output_key_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_startIndex == NULL) {
+        JSON_LOG("%s: output_value_startIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_endIndex == NULL) {
+        JSON_LOG("%s: output_value_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    size_t key_startIndex = JSON_INDEX_NONE, key_endIndex = JSON_INDEX_NONE, value_startIndex = JSON_INDEX_NONE, value_endIndex = JSON_INDEX_NONE;
+    int result = json_getKeyValuePair_n(input_string, JSON_LENGTH_UNBOUNDED, input_string_startIndex, &key_startIndex, &key_endIndex, &value_startIndex, &value_endIndex, output_value_jsonType);
+
+    *output_key_startIndex   = json_util_indexToInt(key_startIndex);
+    *output_key_endIndex     = json_util_indexToInt(key_endIndex);
+    *output_value_startIndex = json_util_indexToInt(value_startIndex);
+    *output_value_endIndex   = json_util_indexToInt(value_endIndex);
+    return result;
+}
+
+// 2-4. Get Key
+int json_getKey(const char * input_string, const int input_string_startIndex, int * output_key_startIndex, int * output_key_endIndex, int * output_key_jsonType) {
+    // check arguments
+    if (input_string_startIndex < 0) {
+        JSON_LOG("%s: input_string_startIndex (%d) should not be negative\n", __func__, input_string_startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_key_startIndex == NULL) {
+        JSON_LOG("%s: output_key_startIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_key_endIndex == NULL) {
+        JSON_LOG("%s: output_key_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    size_t key_startIndex = JSON_INDEX_NONE, key_endIndex = JSON_INDEX_NONE;
+    int result = json_getKey_n(input_string, JSON_LENGTH_UNBOUNDED, input_string_startIndex, &key_startIndex, &key_endIndex, output_key_jsonType);
+
+    *output_key_startIndex = json_util_indexToInt(key_startIndex);
+    *output_key_endIndex   = json_util_indexToInt(key_endIndex);
+    return result;
+}
+
+// 2-5. Object Get Key Value Pair List (length-bounded), the pairs are allocated in the arena, or in the heap if the arena is NULL
+// the keys and the short values are interned if the intern table isn't NULL
+int json_object_getKeyValuePairList_alloc(JSON_Arena * arena, JSON_Intern * intern, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size) {
+    const char DEBUG = 0;
+
+    // check arguments
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_keyValuePairList == NULL) {
+        JSON_LOG("%s: output_keyValuePairList should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_keyValuePairList_size == NULL) {
+        JSON_LOG("%s: output_keyValuePairList_size should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    size_t i = input_string_startIndex;
+
+    *output_keyValuePairList = NULL;
+    *output_keyValuePairList_size = 0;
+
+    // check the first character
+    if (json_util_charAt(input_string, input_string_length, i) != '{') {
+        if (DEBUG) {
+            JSON_LOG("%s: invalid character at %zu, it should be left curly bracket\n", __func__, i);
+        }
+        return json_error_set(JSON_ERROR_NOT_FOUND, i);
+    }
+    i++;
+
+    // filter the blank, util find the next character
+    if (json_util_getNextCharacter_n(input_string, input_string_length, &i) != 0) {
+        goto invalid_character;
+    }
+
+    // check right curly bracket
+    if (input_string[i] == '}') {
+        return 0;
+    }
+
+    JSON_Key_Value_Pair * last = *output_keyValuePairList;
+
+    for (;;) {
+        // 1. get the key value pair
+        size_t key_startIndex, key_endIndex;
+        size_t value_startIndex, value_endIndex;
+        int value_jsonType;
+        if (json_keyValuePair_scan(input_string, input_string_length, &i, &key_startIndex, &key_endIndex, &value_startIndex, &value_endIndex, &value_jsonType) != 0) {
+            if (DEBUG) {
+                JSON_LOG("%s: invalid JSON Key Value Pair at %zu\n", __func__, i);
+            }
+            goto invalid_character;
+        }
+
+        // 2. create JSON_Key_Value_Pair
+        JSON_Key_Value_Pair * pair;
+        if (json_arena_allocZero(arena, sizeof(JSON_Key_Value_Pair), (void **) &pair) != 0) {
+            goto failure;
+        }
+
+        // 3. add to output_keyValuePairList
+        if (last == NULL) {
+            *output_keyValuePairList = pair;
+            last = pair;
+        } else {
+            last->next = pair;
+            last = pair;
+        }
+
+        // key & key_type
+        pair->key_type = JSON_TYPE_STRING;
+        if (json_intern_allocSubstring(arena, intern, input_string, key_startIndex, key_endIndex, &(pair->key)) != 0) {
+            goto failure;
+        }
+
+        // value & value_type
+        pair->value_type = value_jsonType;
+        if (json_intern_allocSubstring(arena, json_intern_forValue(intern, value_jsonType, value_endIndex - value_startIndex + 1), input_string, value_startIndex, value_endIndex, &(pair->value)) != 0) {
+            goto failure;
+        }
+
+        (*output_keyValuePairList_size)++;
+
+        // 4. move to the index behind the value
+        i = value_endIndex + 1;
+
+        // filter the blank, util find the next character
+        if (json_util_getNextCharacter_n(input_string, input_string_length, &i) != 0) {
+            goto invalid_character;
+        }
+
+        // 5. check the character after the VALUE
+        switch (input_string[i]) {
+            // 2-1. check right square bracket
+            case '}':
+                // it's the end of the object
+                return 0;
+
+            // 2-2. find comma behind the value
+            case ',':
+                i++;
+                break;
+
+            // 2-3. is not right square bracket or comma
+            default:
+                goto invalid_character;
+        }
+
+        // filter the blank, util find the next character
+        if (json_util_getNextCharacter_n(input_string, input_string_length, &i) != 0) {
+            goto invalid_character;
+        }
+    }
+
+invalid_character:
+    if (DEBUG) {
+        JSON_LOG("%s: invalid character at %zu\n", __func__, i);
+    }
+    json_error_set(JSON_ERROR_SYNTAX, i);
+
+failure:
+    // the pairs in the arena are released by json_arena_reset
+    if (arena == NULL) {
+        json_keyValuePair_free(*output_keyValuePairList);
+    }
+    *output_keyValuePairList = NULL;
+    *output_keyValuePairList_size = 0;
+    return -1;
+}
+
+// 2-6. Array Get Key Value Pair List (length-bounded), the pairs are allocated in the arena, or in the heap if the arena is NULL
+// the keys and the short values are interned if the intern table isn't NULL
+int json_array_getKeyValuePairList_alloc(JSON_Arena * arena, JSON_Intern * intern, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size) {
+    const char DEBUG = 0;
+
+    // check arguments
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_keyValuePairList == NULL) {
+        JSON_LOG("%s: output_keyValuePairList should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_keyValuePairList_size == NULL) {
+        JSON_LOG("%s: output_keyValuePairList_size should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    size_t i = input_string_startIndex;
+
+    *output_keyValuePairList = NULL;
+    *output_keyValuePairList_size = 0;
+
+    // check the first character
+    if (json_util_charAt(input_string, input_string_length, i) != '[') {
+        if (DEBUG) {
+            JSON_LOG("%s: invalid character at %zu, it should be left square bracket\n", __func__, i);
+        }
+        return json_error_set(JSON_ERROR_NOT_FOUND, i);
+    }
+    i++;
+
+    // filter the blank, util find the next character
+    if (json_util_getNextCharacter_n(input_string, input_string_length, &i) != 0) {
+        goto invalid_character;
+    }
+
+    // check right square bracket
+    if (input_string[i] == ']') {
+        return 0;
+    }
+
+    JSON_Key_Value_Pair * last = *output_keyValuePairList;
+    for (;;) {
+        // 1-1. check the value
+        size_t endIndex;
+        int jsonType;
+        if (json_value_scan(input_string, input_string_length, i, &endIndex, &jsonType) != 0) {
+            if (DEBUG) {
+                JSON_LOG("%s: invalid JSON Value at %zu (%c)\n", __func__, i, input_string[i]);
+            }
+            goto invalid_character;
+        }
+
+        // 2. create JSON_Key_Value_Pair
+        JSON_Key_Value_Pair * pair;
+        if (json_arena_allocZero(arena, sizeof(JSON_Key_Value_Pair), (void **) &pair) != 0) {
+            goto failure;
+        }
 
         // 3. add to output_keyValuePairList
         if (last == NULL) {
             *output_keyValuePairList = pair;
             last = pair;
         } else {
-            last->next = pair;
-            last = pair;
+            last->next = pair;
+            last = pair;
+        }
+
+        // key & key_type
+        pair->key_type = JSON_TYPE_NUMBER;
+        if (json_intern_allocStringBySize(arena, intern, *output_keyValuePairList_size, &(pair->key)) != 0) {
+            goto failure;
+        }
+
+        // value & value_type
+        pair->value_type = jsonType;
+        if (json_intern_allocSubstring(arena, json_intern_forValue(intern, jsonType, endIndex - i + 1), input_string, i, endIndex, &(pair->value)) != 0) {
+            goto failure;
+        }
+
+        (*output_keyValuePairList_size)++;
+
+        // 4. move to the index behind the value
+        i = endIndex + 1;
+
+        // filter the blank, util find the next character
+        if (json_util_getNextCharacter_n(input_string, input_string_length, &i) != 0) {
+            goto invalid_character;
+        }
+
+        // 5. check the character after the VALUE
+        switch (input_string[i]) {
+            // 2-1. check right square bracket
+            case ']':
+                // it's the end of the array
+                return 0;
+
+            // 2-2. find comma behind the value
+            case ',':
+                i++;
+                break;
+
+            // 2-3. is not right square bracket or comma
+            default:
+                goto invalid_character;
+        }
+
+        // filter the blank, util find the next character
+        if (json_util_getNextCharacter_n(input_string, input_string_length, &i) != 0) {
+            goto invalid_character;
+        }
+    }
+
+invalid_character:
+    if (DEBUG) {
+        JSON_LOG("%s: invalid character at %zu\n", __func__, i);
+    }
+    json_error_set(JSON_ERROR_SYNTAX, i);
+
+failure:
+    // the pairs in the arena are released by json_arena_reset
+    if (arena == NULL) {
+        json_keyValuePair_free(*output_keyValuePairList);
+    }
+    *output_keyValuePairList = NULL;
+    *output_keyValuePairList_size = 0;
+    return -1;
+}
+
+// 2-7. Get Key Value Pair (length-bounded)
+int json_getKeyValuePair_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, size_t * output_key_startIndex, size_t * output_key_endIndex, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType) {
+    // check arguments
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_key_startIndex == NULL) {
+        JSON_LOG("%s: output_key_startIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_key_endIndex == NULL) {
+        JSON_LOG("%s: output_key_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_startIndex == NULL) {
+        JSON_LOG("%s: output_value_startIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_endIndex == NULL) {
+        JSON_LOG("%s: output_value_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_value_jsonType == NULL) {
+        JSON_LOG("%s: output_value_jsonType should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    // the outputs are set to default by the kernel on failure
+    size_t i = input_string_startIndex;
+    if (json_keyValuePair_scan(input_string, input_string_length, &i, output_key_startIndex, output_key_endIndex, output_value_startIndex, output_value_endIndex, output_value_jsonType) != 0) {
+        return json_error_set(JSON_ERROR_SYNTAX, i);
+    }
+
+    return 0;
+}
+
+// 2-8. Get Key (length-bounded)
+int json_getKey_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, size_t * output_key_startIndex, size_t * output_key_endIndex, int * output_key_jsonType) {
+    const char DEBUG = 0;
+
+    // check arguments
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_key_startIndex == NULL) {
+        JSON_LOG("%s: output_key_startIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_key_endIndex == NULL) {
+        JSON_LOG("%s: output_key_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_key_jsonType == NULL) {
+        JSON_LOG("%s: output_key_jsonType should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_key_startIndex = JSON_INDEX_NONE;
+    *output_key_endIndex   = JSON_INDEX_NONE;
+    *output_key_jsonType   = -1;
+
+    size_t endIndex;
+    if (json_getArrayInShallow_n(input_string, input_string_length, input_string_startIndex, &endIndex) != 0) {
+        return -1;
+    }
+
+    size_t key_startIndex = input_string_startIndex + 1;
+
+    // check the key length
+    if (endIndex == key_startIndex) {
+        if (DEBUG) {
+            JSON_LOG("%s: the key is empty\n", __func__);
+        }
+        return -1;
+    }
+
+    size_t key_endIndex = endIndex - 1;
+
+    // 1. string key
+    if (json_getString_n(input_string, input_string_length, key_startIndex, &endIndex) == 0 && key_endIndex == endIndex) {
+        *output_key_startIndex = key_startIndex;
+        *output_key_endIndex   = key_endIndex;
+        *output_key_jsonType   = JSON_TYPE_STRING;
+
+        if (DEBUG) {
+            JSON_LOG("%s: ", __func__);
+            json_util_printSubstring_n(input_string, *output_key_startIndex, *output_key_endIndex);
+            JSON_LOG(" (%s)\n", json_type_toString(*output_key_jsonType));
+        }
+        return 0;
+    }
+
+    // 2. number key
+    size_t i;
+    for (i = key_startIndex; i <= key_endIndex; i++) {
+        if (!isdigit((unsigned char) input_string[i])) {
+            return -1;
+        }
+    }
+
+    *output_key_startIndex = key_startIndex;
+    *output_key_endIndex   = key_endIndex;
+    *output_key_jsonType   = JSON_TYPE_NUMBER;
+
+    if (DEBUG) {
+        JSON_LOG("%s: ", __func__);
+        json_util_printSubstring_n(input_string, *output_key_startIndex, *output_key_endIndex);
+        JSON_LOG(" (%s)\n", json_type_toString(*output_key_jsonType));
+    }
+    return 0;
+}
+
+// 2-9. Object Get Key Value Pair List (length-bounded)
+int json_object_getKeyValuePairList_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size) {
+    return json_object_getKeyValuePairList_alloc(NULL, NULL, input_string, input_string_length, input_string_startIndex, output_keyValuePairList, output_keyValuePairList_size);
+}
+
+// 2-10. Array Get Key Value Pair List (length-bounded)
+int json_array_getKeyValuePairList_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size) {
+    return json_array_getKeyValuePairList_alloc(NULL, NULL, input_string, input_string_length, input_string_startIndex, output_keyValuePairList, output_keyValuePairList_size);
+}
+
+// 2-11. Object Get Key Value View List (length-bounded)
+int json_object_getKeyValueViewList_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_View * output_views, const size_t output_views_capacity, size_t * output_views_size) {
+    const char DEBUG = 0;
+
+    // check arguments
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_views == NULL && output_views_capacity != 0) {
+        JSON_LOG("%s: output_views should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_views_size == NULL) {
+        JSON_LOG("%s: output_views_size should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    size_t i = input_string_startIndex;
+
+    *output_views_size = 0;
+
+    // check the first character
+    if (json_util_charAt(input_string, input_string_length, i) != '{') {
+        if (DEBUG) {
+            JSON_LOG("%s: invalid character at %zu, it should be left curly bracket\n", __func__, i);
+        }
+        return json_error_set(JSON_ERROR_NOT_FOUND, i);
+    }
+    i++;
+
+    // filter the blank, util find the next character
+    if (json_util_getNextCharacter_n(input_string, input_string_length, &i) != 0) {
+        goto invalid_character;
+    }
+
+    // check right curly bracket
+    if (input_string[i] == '}') {
+        return 0;
+    }
+
+    for (;;) {
+        // 1. get the key value pair
+        size_t key_startIndex, key_endIndex;
+        size_t value_startIndex, value_endIndex;
+        int value_jsonType;
+        if (json_keyValuePair_scan(input_string, input_string_length, &i, &key_startIndex, &key_endIndex, &value_startIndex, &value_endIndex, &value_jsonType) != 0) {
+            if (DEBUG) {
+                JSON_LOG("%s: invalid JSON Key Value Pair at %zu\n", __func__, i);
+            }
+            goto invalid_character;
+        }
+
+        // 2. fill the view, the pairs beyond the capacity are only counted
+        if (*output_views_size < output_views_capacity) {
+            JSON_Key_Value_View * view = &output_views[*output_views_size];
+            view->key_startIndex   = key_startIndex;
+            view->key_length       = key_endIndex - key_startIndex + 1;
+            view->key_type         = JSON_TYPE_STRING;
+            view->key_escaped      = memchr(input_string + key_startIndex + 1, '\\', key_endIndex - key_startIndex - 1) != NULL;
+            view->value_startIndex = value_startIndex;
+            view->value_length     = value_endIndex - value_startIndex + 1;
+            view->value_type       = value_jsonType;
+        }
+
+        (*output_views_size)++;
+
+        // 3. move to the index behind the value
+        i = value_endIndex + 1;
+
+        // filter the blank, util find the next character
+        if (json_util_getNextCharacter_n(input_string, input_string_length, &i) != 0) {
+            goto invalid_character;
+        }
+
+        // 4. check the character after the VALUE
+        switch (input_string[i]) {
+            // 4-1. check right curly bracket
+            case '}':
+                // it's the end of the object
+                return 0;
+
+            // 4-2. find comma behind the value
+            case ',':
+                i++;
+                break;
+
+            // 4-3. is not right curly bracket or comma
+            default:
+                goto invalid_character;
+        }
+
+        // filter the blank, util find the next character
+        if (json_util_getNextCharacter_n(input_string, input_string_length, &i) != 0) {
+            goto invalid_character;
+        }
+    }
+
+invalid_character:
+    if (DEBUG) {
+        JSON_LOG("%s: invalid character at %zu\n", __func__, i);
+    }
+    json_error_set(JSON_ERROR_SYNTAX, i);
+
+    *output_views_size = 0;
+    return -1;
+}
+
+// 2-12. Array Get Key Value View List (length-bounded)
+int json_array_getKeyValueViewList_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_View * output_views, const size_t output_views_capacity, size_t * output_views_size) {
+    const char DEBUG = 0;
+
+    // check arguments
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_views == NULL && output_views_capacity != 0) {
+        JSON_LOG("%s: output_views should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_views_size == NULL) {
+        JSON_LOG("%s: output_views_size should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    size_t i = input_string_startIndex;
+
+    *output_views_size = 0;
+
+    // check the first character
+    if (json_util_charAt(input_string, input_string_length, i) != '[') {
+        if (DEBUG) {
+            JSON_LOG("%s: invalid character at %zu, it should be left square bracket\n", __func__, i);
+        }
+        return json_error_set(JSON_ERROR_NOT_FOUND, i);
+    }
+    i++;
+
+    // filter the blank, util find the next character
+    if (json_util_getNextCharacter_n(input_string, input_string_length, &i) != 0) {
+        goto invalid_character;
+    }
+
+    // check right square bracket
+    if (input_string[i] == ']') {
+        return 0;
+    }
+
+    for (;;) {
+        // 1. check the value
+        size_t endIndex;
+        int jsonType;
+        if (json_value_scan(input_string, input_string_length, i, &endIndex, &jsonType) != 0) {
+            if (DEBUG) {
+                JSON_LOG("%s: invalid JSON Value at %zu (%c)\n", __func__, i, input_string[i]);
+            }
+            goto invalid_character;
+        }
+
+        // 2. fill the view, the key is the position in the array
+        if (*output_views_size < output_views_capacity) {
+            JSON_Key_Value_View * view = &output_views[*output_views_size];
+            view->key_startIndex   = JSON_INDEX_NONE;
+            view->key_length       = 0;
+            view->key_type         = JSON_TYPE_NUMBER;
+            view->key_escaped      = 0;
+            view->value_startIndex = i;
+            view->value_length     = endIndex - i + 1;
+            view->value_type       = jsonType;
+        }
+
+        (*output_views_size)++;
+
+        // 3. move to the index behind the value
+        i = endIndex + 1;
+
+        // filter the blank, util find the next character
+        if (json_util_getNextCharacter_n(input_string, input_string_length, &i) != 0) {
+            goto invalid_character;
+        }
+
+        // 4. check the character after the VALUE
+        switch (input_string[i]) {
+            // 4-1. check right square bracket
+            case ']':
+                // it's the end of the array
+                return 0;
+
+            // 4-2. find comma behind the value
+            case ',':
+                i++;
+                break;
+
+            // 4-3. is not right square bracket or comma
+            default:
+                goto invalid_character;
+        }
+
+        // filter the blank, util find the next character
+        if (json_util_getNextCharacter_n(input_string, input_string_length, &i) != 0) {
+            goto invalid_character;
+        }
+    }
+
+invalid_character:
+    if (DEBUG) {
+        JSON_LOG("%s: invalid character at %zu\n", __func__, i);
+    }
+    json_error_set(JSON_ERROR_SYNTAX, i);
+
+    *output_views_size = 0;
+    return -1;
+}
+
+
+// 3. Get Value with start & end index and JSON type
+int json_getValue(const char * input_string, const int input_string_startIndex, int * output_endIndex, int * output_jsonType) {
+    // check input arguments
+    if (input_string_startIndex < 0) {
+        JSON_LOG("%s: input_string_startIndex (%d) should not be negative\n", __func__, input_string_startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_endIndex == NULL) {
+        JSON_LOG("%s: output_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    size_t endIndex = JSON_INDEX_NONE;
+    int result = json_getValue_n(input_string, JSON_LENGTH_UNBOUNDED, input_string_startIndex, &endIndex, output_jsonType);
+
+    *output_endIndex = json_util_indexToInt(endIndex);
+    return result;
+}
+
+// 3-1. Get Object in Shallow
+int json_getObjectInShallow(const char * input_string, const int input_string_startIndex, int * output_endIndex) {
+    // check input arguments
+    if (input_string_startIndex < 0) {
+        JSON_LOG("%s: input_string_startIndex (%d) should not be negative\n", __func__, input_string_startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_endIndex == NULL) {
+        JSON_LOG("%s: output_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    size_t endIndex = JSON_INDEX_NONE;
+    int result = json_getObjectInShallow_n(input_string, JSON_LENGTH_UNBOUNDED, input_string_startIndex, &endIndex);
+
+    *output_endIndex = json_util_indexToInt(endIndex);
+    return result;
+}
+
+// 3-2. Get Array in Shallow
+int json_getArrayInShallow(const char * input_string, const int input_string_startIndex, int * output_endIndex) {
+    // check input arguments
+    if (input_string_startIndex < 0) {
+        JSON_LOG("%s: input_string_startIndex (%d) should not be negative\n", __func__, input_string_startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_endIndex == NULL) {
+        JSON_LOG("%s: output_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    size_t endIndex = JSON_INDEX_NONE;
+    int result = json_getArrayInShallow_n(input_string, JSON_LENGTH_UNBOUNDED, input_string_startIndex, &endIndex);
+
+    *output_endIndex = json_util_indexToInt(endIndex);
+    return result;
+}
+
+// 3-3. Get the number with end index
+int json_getNumber(const char * input_string, const int input_string_startIndex, int * output_endIndex) {
+    // check input arguments
+    if (input_string_startIndex < 0) {
+        JSON_LOG("%s: input_string_startIndex (%d) should not be negative\n", __func__, input_string_startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_endIndex == NULL) {
+        JSON_LOG("%s: output_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    size_t endIndex = JSON_INDEX_NONE;
+    int result = json_getNumber_n(input_string, JSON_LENGTH_UNBOUNDED, input_string_startIndex, &endIndex);
+
+    *output_endIndex = json_util_indexToInt(endIndex);
+    return result;
+}
+
+// 3-4. Get the string with end index
+int json_getString(const char * input_string, const int input_string_startIndex, int * output_endIndex) {
+    // check input arguments
+    if (input_string_startIndex < 0) {
+        JSON_LOG("%s: input_string_startIndex (%d) should not be negative\n", __func__, input_string_startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_endIndex == NULL) {
+        JSON_LOG("%s: output_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    size_t endIndex = JSON_INDEX_NONE;
+    int result = json_getString_n(input_string, JSON_LENGTH_UNBOUNDED, input_string_startIndex, &endIndex);
+
+    *output_endIndex = json_util_indexToInt(endIndex);
+    return result;
+}
+
+// 3-5. Get the boolean with end index.
+int json_getBoolean(const char * input_string, const int input_string_startIndex, int * output_endIndex) {
+    // check input arguments
+    if (input_string_startIndex < 0) {
+        JSON_LOG("%s: input_string_startIndex (%d) should not be negative\n", __func__, input_string_startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_endIndex == NULL) {
+        JSON_LOG("%s: output_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    size_t endIndex = JSON_INDEX_NONE;
+    int result = json_getBoolean_n(input_string, JSON_LENGTH_UNBOUNDED, input_string_startIndex, &endIndex);
+
+    *output_endIndex = json_util_indexToInt(endIndex);
+    return result;
+}
+
+// 3-6. Get the null with end index.
+int json_getNull(const char * input_string, const int input_string_startIndex, int * output_endIndex) {
+    // check input arguments
+    if (input_string_startIndex < 0) {
+        JSON_LOG("%s: input_string_startIndex (%d) should not be negative\n", __func__, input_string_startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_endIndex == NULL) {
+        JSON_LOG("%s: output_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    size_t endIndex = JSON_INDEX_NONE;
+    int result = json_getNull_n(input_string, JSON_LENGTH_UNBOUNDED, input_string_startIndex, &endIndex);
+
+    *output_endIndex = json_util_indexToInt(endIndex);
+    return result;
+}
+
+// 3-7. Get Value with start & end index and JSON type (length-bounded)
+int json_getValue_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, size_t * output_endIndex, int * output_jsonType) {
+    // check input arguments
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_endIndex == NULL) {
+        JSON_LOG("%s: output_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_jsonType == NULL) {
+        JSON_LOG("%s: output_jsonType should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    return json_value_scan(input_string, input_string_length, input_string_startIndex, output_endIndex, output_jsonType);
+}
+
+// 3-8. Get Object in Shallow (length-bounded)
+int json_getObjectInShallow_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, size_t * output_endIndex) {
+    // check input arguments
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_endIndex == NULL) {
+        JSON_LOG("%s: output_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    // skip the nested brackets, the brackets inside the strings are ignored
+    if (json_util_charAt(input_string, input_string_length, input_string_startIndex) == '{') {
+        return json_simd_skipContainer(input_string, input_string_length, input_string_startIndex, '{', '}', output_endIndex);
+    }
+
+    *output_endIndex = JSON_INDEX_NONE;
+    return -1;
+}
+
+// 3-9. Get Array in Shallow (length-bounded)
+int json_getArrayInShallow_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, size_t * output_endIndex) {
+    // check input arguments
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_endIndex == NULL) {
+        JSON_LOG("%s: output_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    // skip the nested brackets, the brackets inside the strings are ignored
+    if (json_util_charAt(input_string, input_string_length, input_string_startIndex) == '[') {
+        return json_simd_skipContainer(input_string, input_string_length, input_string_startIndex, '[', ']', output_endIndex);
+    }
+
+    *output_endIndex = JSON_INDEX_NONE;
+    return -1;
+}
+
+// 3-10. Get the number with end index (length-bounded)
+int json_getNumber_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, size_t * output_endIndex) {
+    // check input arguments
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_endIndex == NULL) {
+        JSON_LOG("%s: output_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_endIndex = JSON_INDEX_NONE; // set default to none
+    return json_number_scan(input_string, input_string_length, input_string_startIndex, output_endIndex);
+}
+
+// 3-11. Get the string with end index (length-bounded)
+int json_getString_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, size_t * output_endIndex) {
+    // check input arguments
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_endIndex == NULL) {
+        JSON_LOG("%s: output_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_endIndex = JSON_INDEX_NONE; // set default to none
+    return json_string_scan(input_string, input_string_length, input_string_startIndex, output_endIndex);
+}
+
+// 3-12. Get the boolean with end index (length-bounded)
+int json_getBoolean_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, size_t * output_endIndex) {
+    // check input arguments
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_endIndex == NULL) {
+        JSON_LOG("%s: output_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_endIndex = JSON_INDEX_NONE; // set default to none
+    return json_boolean_scan(input_string, input_string_length, input_string_startIndex, output_endIndex);
+}
+
+// 3-13. Get the null with end index (length-bounded)
+int json_getNull_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, size_t * output_endIndex) {
+    // check input arguments
+    if (input_string == NULL) {
+        JSON_LOG("%s: input_string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (output_endIndex == NULL) {
+        JSON_LOG("%s: output_endIndex should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    *output_endIndex = JSON_INDEX_NONE; // set default to none
+    return json_null_scan(input_string, input_string_length, input_string_startIndex, output_endIndex);
+}
+
+
+// 4-1. get next character without blank
+int json_util_getNextCharacter(const char * string, int * index) {
+    // check arguments
+    if (index == NULL) {
+        JSON_LOG("%s: index should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (*index < 0) {
+        JSON_LOG("%s: *index (%d) should not be negative\n", __func__, *index);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    size_t i = *index;
+    int result = json_util_getNextCharacter_n(string, JSON_LENGTH_UNBOUNDED, &i);
+
+    *index = (int) i;
+    return result;
+}
+
+// 4-2. print substring
+int json_util_printSubstring(const char * string, const int startIndex, const int endIndex) {
+    if (startIndex < 0) {
+        JSON_LOG("%s: startIndex (%d) should not be negative\n", __func__, startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (startIndex > endIndex) {
+        JSON_LOG("%s: endIndex (%d) should greater than startIndex (%d)\n", __func__, endIndex, startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    return json_util_printSubstring_n(string, startIndex, endIndex);
+}
+
+// 4-3. allocate substring
+int json_util_allocSubstring(const char * string, const int startIndex, const int endIndex, char ** substring) {
+    if (startIndex < 0) {
+        JSON_LOG("%s: startIndex (%d) should not be negative\n", __func__, startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (startIndex > endIndex) {
+        JSON_LOG("%s: endIndex (%d) should greater than startIndex (%d)\n", __func__, endIndex, startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    return json_util_allocSubstring_n(string, startIndex, endIndex, substring);
+}
+
+// 4-4. string compare
+int json_util_stringCompare(const char * s1, const int s1_startIndex, const int s1_endIndex, const char * s2, const int s2_startIndex, const int s2_endIndex) {
+    // check arguments
+    if (s1_startIndex < 0) {
+        JSON_LOG("%s: s1_startIndex (%d) should not be negative\n", __func__, s1_startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (s2_startIndex < 0) {
+        JSON_LOG("%s: s2_startIndex (%d) should not be negative\n", __func__, s2_startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (s1_endIndex < s1_startIndex) {
+        JSON_LOG("%s: s1_endIndex (%d) should greater than s1_startIndex (%d)\n", __func__, s1_endIndex, s1_startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (s2_endIndex < s2_startIndex) {
+        JSON_LOG("%s: s2_endIndex (%d) should greater than s2_startIndex (%d)\n", __func__, s2_endIndex, s2_startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    return json_util_stringCompare_n(s1, s1_startIndex, s1_endIndex, s2, s2_startIndex, s2_endIndex);
+}
+
+// 4-5. allocate string by integer
+int json_util_allocStringByInteger(const int number, char ** string) {
+
+    if (number < 0) {
+        JSON_LOG("%s: number (%d) should not be negative\n", __func__, number);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    return json_util_allocStringBySize_n(number, string);
+}
+
+// 4-6. get next character without blank (length-bounded)
+int json_util_getNextCharacter_n(const char * string, const size_t length, size_t * index) {
+    // check arguments
+    if (string == NULL) {
+        JSON_LOG("%s: string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (index == NULL) {
+        JSON_LOG("%s: index should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    // it's the end of the string
+    if (json_util_skipWhitespace(string, length, index) == '\0') {
+        return -1;
+    }
+
+    return 0;
+}
+
+// 4-7. print substring (length-bounded)
+int json_util_printSubstring_n(const char * string, const size_t startIndex, const size_t endIndex) {
+    if (string == NULL) {
+        JSON_LOG("%s: string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (startIndex > endIndex) {
+        JSON_LOG("%s: endIndex (%zu) should greater than startIndex (%zu)\n", __func__, endIndex, startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    size_t i;
+    for (i = startIndex; i <= endIndex; i++) {
+        printf("%c", string[i]);
+    }
+    return 0;
+}
+
+// 4-8. allocate substring (length-bounded)
+int json_util_allocSubstring_n(const char * string, const size_t startIndex, const size_t endIndex, char ** substring) {
+    if (string == NULL) {
+        JSON_LOG("%s: string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (startIndex > endIndex) {
+        JSON_LOG("%s: endIndex (%zu) should greater than startIndex (%zu)\n", __func__, endIndex, startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (substring == NULL) {
+        JSON_LOG("%s: substring should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    // set default to NULL
+    *substring = NULL;
+
+    char * s = (char *) calloc(endIndex - startIndex + 2, sizeof(char));
+    if (s == NULL) {
+        JSON_LOG("%s: out of memory\n", __func__);
+        return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+    }
+
+    size_t i;
+    for (i = 0; i <= endIndex - startIndex; i++) {
+        s[i] = string[startIndex + i];
+    }
+
+    *substring = s;
+    return 0;
+}
+
+// 4-9. allocate string by size (length-bounded)
+int json_util_allocStringBySize_n(const size_t number, char ** string) {
+
+    if (string == NULL) {
+        JSON_LOG("%s: string should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    int digit = 1;
+    size_t n = number;
+    while (n / 10 != 0) {
+        n /= 10;
+        digit++;
+    }
+
+    *string = (char *) calloc(digit + 1, sizeof(char));
+    if (*string == NULL) {
+        JSON_LOG("%s: out of memory\n", __func__);
+        return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+    }
+
+    sprintf(*string, "%zu", number);
+
+    return 0;
+}
+
+// 4-10. string compare (length-bounded)
+int json_util_stringCompare_n(const char * s1, const size_t s1_startIndex, const size_t s1_endIndex, const char * s2, const size_t s2_startIndex, const size_t s2_endIndex) {
+    const char DEBUG = 0;
+
+    // check arguments
+    if (s1 == NULL) {
+        JSON_LOG("%s: s1 should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (s1_endIndex < s1_startIndex) {
+        JSON_LOG("%s: s1_endIndex (%zu) should greater than s1_startIndex (%zu)\n", __func__, s1_endIndex, s1_startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (s2 == NULL) {
+        JSON_LOG("%s: s2 should not be NULL\n", __func__);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (s2_endIndex < s2_startIndex) {
+        JSON_LOG("%s: s2_endIndex (%zu) should greater than s2_startIndex (%zu)\n", __func__, s2_endIndex, s2_startIndex);
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    // check string length
+    size_t s1_length = s1_endIndex - s1_startIndex + 1;
+    size_t s2_length = s2_endIndex - s2_startIndex + 1;
+    if (s1_length != s2_length) {
+        if (DEBUG) {
+            JSON_LOG("%s: string length is not match, s1_length = %zu, s2_length = %zu\n\n", __func__, s1_length, s2_length);
+        }
+        return -1;
+    }
+
+    size_t i;
+    for (i = 0; i < s1_length; i++) {
+        if (s1[s1_startIndex + i] != s2[s2_startIndex + i]) {
+            if (DEBUG) {
+                JSON_LOG("%s: string is not match, s1[%zu] = %c, s2[%zu] = %c\n\n", __func__, s1_startIndex + i, s1[s1_startIndex + i], s2_startIndex + i, s2[s2_startIndex + i]);
+            }
+            return -1;
+        }
+    }
+
+    if (DEBUG) {
+        JSON_LOG("%s: string is match\n", __func__);
+        JSON_LOG("   s1[%zu..%zu] = ", s1_startIndex, s1_endIndex);
+        json_util_printSubstring_n(s1, s1_startIndex, s1_endIndex);
+
+        JSON_LOG("\n   s2[%zu..%zu] = ", s2_startIndex, s2_endIndex);
+        json_util_printSubstring_n(s2, s2_startIndex, s2_endIndex);
+        JSON_LOG("\n\n");
+    }
+    return 0;
+}
+
+// 4-11. get the character at index, or '\0' if index is beyond the end of the string
+static inline char json_util_charAt(const char * string, const size_t length, const size_t index) {
+    return index < length ? string[index] : '\0';
+}
+
+// 4-12. convert length-bounded index to integer index
+static inline int json_util_indexToInt(const size_t index) {
+    return index == JSON_INDEX_NONE ? -1 : (int) index;
+}
+
+// 4-13. skip the whitespace, return the next significant character or '\0' at the end of the string
+static inline char json_util_skipWhitespace(const char * string, const size_t length, size_t * index) {
+    size_t i = *index;
+
+    // 1. the value is usually behind one space or no space
+    char c = json_util_charAt(string, length, i);
+    if (!json_util_whitespace[(unsigned char) c]) {
+        return c;
+    }
+
+    c = json_util_charAt(string, length, ++i);
+    if (!json_util_whitespace[(unsigned char) c]) {
+        *index = i;
+        return c;
+    }
+
+#if defined(__SSE2__)
+    // 2. the indentation, 16 characters are checked at a time
+    const __m128i space           = _mm_set1_epi8(' ');
+    const __m128i tab             = _mm_set1_epi8('\t');
+    const __m128i line_feed       = _mm_set1_epi8('\n');
+    const __m128i carriage_return = _mm_set1_epi8('\r');
+
+    // the NUL-terminated string is not readable behind the terminator
+    while (length == JSON_LENGTH_UNBOUNDED ? strnlen(string + i, 16) == 16 : (i <= length && length - i >= 16)) {
+        const __m128i v = _mm_loadu_si128((const __m128i *) (string + i));
+        const __m128i whitespace = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, space), _mm_cmpeq_epi8(v, tab)),
+                                                _mm_or_si128(_mm_cmpeq_epi8(v, line_feed), _mm_cmpeq_epi8(v, carriage_return)));
+        const int mask = ~_mm_movemask_epi8(whitespace) & 0xFFFF;
+        if (mask != 0) {
+            i += __builtin_ctz(mask);
+            *index = i;
+            return string[i];
+        }
+        i += 16;
+    }
+#endif
+
+    // 3. the rest characters
+    while (c = json_util_charAt(string, length, i), json_util_whitespace[(unsigned char) c]) {
+        i++;
+    }
+
+    *index = i;
+    return c;
+}
+
+// 4-14. the JSON whitespace characters, space, tab, line feed and carriage return
+static const unsigned char json_util_whitespace[256] = {
+    [' '] = 1, ['\t'] = 1, ['\n'] = 1, ['\r'] = 1
+};
+
+// 4-15. compare 4 characters at index with the word by one unaligned load
+static inline int json_util_matchWord(const char * string, const size_t length, const size_t index, const char * word) {
+
+    // the NUL-terminated string is not readable behind the terminator
+    if (length == JSON_LENGTH_UNBOUNDED ? strnlen(string + index, 4) < 4 : (index > length || length - index < 4)) {
+        return 0;
+    }
+
+    uint32_t a, b;
+    memcpy(&a, string + index, 4);
+    memcpy(&b, word, 4);
+    return a == b;
+}
+
+
+// 5-1. load the 64-byte block into vector registers
+static inline void json_simd_loadVectors(const char * block, JSON_Block_Vectors * vectors) {
+#if defined(__AVX2__)
+    vectors->chunk[0] = _mm256_loadu_si256((const __m256i *) block);
+    vectors->chunk[1] = _mm256_loadu_si256((const __m256i *) (block + 32));
+#elif defined(__SSE2__)
+    vectors->chunk[0] = _mm_loadu_si128((const __m128i *) block);
+    vectors->chunk[1] = _mm_loadu_si128((const __m128i *) (block + 16));
+    vectors->chunk[2] = _mm_loadu_si128((const __m128i *) (block + 32));
+    vectors->chunk[3] = _mm_loadu_si128((const __m128i *) (block + 48));
+#else
+    vectors->bytes = block;
+#endif
+}
+
+// 5-2. match the character in the 64-byte block, bit i of the mask is set when block[i] is the character
+static inline uint64_t json_simd_matchMask(const JSON_Block_Vectors * vectors, const char c) {
+#if defined(__AVX2__)
+    const __m256i v = _mm256_set1_epi8(c);
+    return (uint64_t) (uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(vectors->chunk[0], v)) |
+          ((uint64_t) (uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(vectors->chunk[1], v)) << 32);
+#elif defined(__SSE2__)
+    const __m128i v = _mm_set1_epi8(c);
+    return (uint64_t) (uint16_t) _mm_movemask_epi8(_mm_cmpeq_epi8(vectors->chunk[0], v)) |
+          ((uint64_t) (uint16_t) _mm_movemask_epi8(_mm_cmpeq_epi8(vectors->chunk[1], v)) << 16) |
+          ((uint64_t) (uint16_t) _mm_movemask_epi8(_mm_cmpeq_epi8(vectors->chunk[2], v)) << 32) |
+          ((uint64_t) (uint16_t) _mm_movemask_epi8(_mm_cmpeq_epi8(vectors->chunk[3], v)) << 48);
+#else
+    uint64_t mask = 0;
+    int i;
+    for (i = 0; i < 64; i++) {
+        mask |= (uint64_t) (vectors->bytes[i] == c) << i;
+    }
+    return mask;
+#endif
+}
+
+// 5-3. classify the 64-byte block, bit i of each mask is set when block[i] is the character
+static inline void json_simd_classifyBlock(const char * block, JSON_Block_Masks * masks) {
+#if defined(__AVX2__) || defined(__SSE2__)
+    JSON_Block_Vectors vectors;
+    json_simd_loadVectors(block, &vectors);
+
+    masks->quote        = json_simd_matchMask(&vectors, '\"');
+    masks->backslash    = json_simd_matchMask(&vectors, '\\');
+    masks->left_curly   = json_simd_matchMask(&vectors, '{');
+    masks->right_curly  = json_simd_matchMask(&vectors, '}');
+    masks->left_square  = json_simd_matchMask(&vectors, '[');
+    masks->right_square = json_simd_matchMask(&vectors, ']');
+    masks->colon        = json_simd_matchMask(&vectors, ':');
+    masks->comma        = json_simd_matchMask(&vectors, ',');
+    masks->whitespace   = json_simd_matchMask(&vectors, ' ') | json_simd_matchMask(&vectors, '\t') | json_simd_matchMask(&vectors, '\n') | json_simd_matchMask(&vectors, '\r');
+
+#else
+    // scalar fallback, classify all characters in one pass
+    memset(masks, 0, sizeof(JSON_Block_Masks));
+
+    int i;
+    for (i = 0; i < 64; i++) {
+        const uint64_t bit = (uint64_t) 1 << i;
+        switch (block[i]) {
+            case '\"': masks->quote        |= bit; break;
+            case '\\': masks->backslash    |= bit; break;
+            case '{':  masks->left_curly   |= bit; break;
+            case '}':  masks->right_curly  |= bit; break;
+            case '[':  masks->left_square  |= bit; break;
+            case ']':  masks->right_square |= bit; break;
+            case ':':  masks->colon        |= bit; break;
+            case ',':  masks->comma        |= bit; break;
+            case ' ':
+            case '\t':
+            case '\n':
+            case '\r': masks->whitespace   |= bit; break;
+            default:   break;
+        }
+    }
+#endif
+}
+
+// 5-4. get the mask of escaped characters from the backslash mask, the carry is the escape state across blocks
+static inline uint64_t json_simd_escapedMask(const uint64_t backslash, uint64_t * carry) {
+    const uint64_t ODD_BITS = 0xAAAAAAAAAAAAAAAAULL;
+
+    if (backslash == 0) {
+        uint64_t escaped = *carry;
+        *carry = 0;
+        return escaped;
+    }
+
+    // the backslash behind an escaping backslash is not an escape character
+    const uint64_t potential_escape = backslash & ~(*carry);
+
+    // the odd-length runs of backslash escape the next character
+    const uint64_t maybe_escaped = potential_escape << 1;
+    const uint64_t maybe_escaped_and_odd_bits = maybe_escaped | ODD_BITS;
+    const uint64_t even_series_codes_and_odd_bits = maybe_escaped_and_odd_bits - potential_escape;
+    const uint64_t escape_and_terminal_code = even_series_codes_and_odd_bits ^ ODD_BITS;
+
+    const uint64_t escaped = escape_and_terminal_code ^ (backslash | *carry);
+    const uint64_t escape = escape_and_terminal_code & backslash;
+
+    *carry = escape >> 63;
+    return escaped;
+}
+
+// 5-5. prefix xor, bit i of the result is the xor of bit 0 to bit i
+static inline uint64_t json_simd_prefixXor(uint64_t bitmask) {
+#if defined(__PCLMUL__)
+    const __m128i all_ones = _mm_set1_epi8((char) 0xFF);
+    const __m128i result = _mm_clmulepi64_si128(_mm_set_epi64x(0, (long long) bitmask), all_ones, 0);
+    return (uint64_t) _mm_cvtsi128_si64(result);
+#else
+    bitmask ^= bitmask << 1;
+    bitmask ^= bitmask << 2;
+    bitmask ^= bitmask << 4;
+    bitmask ^= bitmask << 8;
+    bitmask ^= bitmask << 16;
+    bitmask ^= bitmask << 32;
+    return bitmask;
+#endif
+}
+
+// 5-6. load the 64-byte block at index, the bytes behind the end of string are zero padding
+static inline const char * json_simd_loadBlock(const char * string, const size_t length, const size_t index, char * padding, size_t * output_size) {
+    size_t size = length - index;
+
+    // the string is NUL-terminated, never read behind the terminator
+    if (length == JSON_LENGTH_UNBOUNDED) {
+        size = strnlen(string + index, 64);
+    }
+
+    if (size >= 64) {
+        *output_size = 64;
+        return string + index;
+    }
+
+    memset(padding, 0, 64);
+    memcpy(padding, string + index, size);
+    *output_size = size;
+    return padding;
+}
+
+// 5-7. find the structural characters, string quotes and the first character of the other values
+int json_index_findStructurals(JSON_Index * index) {
+    const char * string = index->string;
+    const size_t length = index->length;
+
+    uint64_t escaped_carry  = 0;
+    uint64_t inString_carry = 0;
+    uint64_t boundary_carry = 1; // the start of string is a value boundary
+
+    char padding[64];
+    size_t i;
+    for (i = 0; i < length; i += 64) {
+        size_t blockSize;
+        const char * block = json_simd_loadBlock(string, length, i, padding, &blockSize);
+
+        JSON_Block_Masks masks;
+        json_simd_classifyBlock(block, &masks);
+
+        // 1. find the unescaped quotes and the characters inside the strings
+        const uint64_t escaped = json_simd_escapedMask(masks.backslash, &escaped_carry);
+        const uint64_t quote = masks.quote & ~escaped;
+        const uint64_t inString = json_simd_prefixXor(quote) ^ inString_carry;
+        inString_carry = (uint64_t) ((int64_t) inString >> 63);
+
+        // 2. find the operators outside the strings
+        const uint64_t operators = (masks.left_curly | masks.right_curly | masks.left_square | masks.right_square | masks.colon | masks.comma) & ~inString;
+
+        // 3. find the first character of number, boolean and null
+        const uint64_t valid = blockSize == 64 ? ~(uint64_t) 0 : ((uint64_t) 1 << blockSize) - 1;
+        const uint64_t boundary = operators | masks.whitespace | quote;
+        const uint64_t scalar = ~(boundary | inString) & valid;
+        const uint64_t scalar_start = scalar & ((boundary << 1) | boundary_carry);
+        boundary_carry = boundary >> 63;
+
+        // 4. flatten the structural bits to positions
+        uint64_t structurals = operators | quote | scalar_start;
+
+        if (index->size + 64 > index->capacity) {
+            size_t capacity = index->capacity == 0 ? 1024 : index->capacity * 2;
+            size_t * positions = realloc(index->positions, capacity * sizeof(size_t));
+            if (positions == NULL) {
+                JSON_LOG("%s: out of memory\n", __func__);
+                return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+            }
+            index->positions = positions;
+            index->capacity = capacity;
+        }
+
+        while (structurals != 0) {
+            index->positions[index->size++] = i + __builtin_ctzll(structurals);
+            structurals &= structurals - 1;
+        }
+
+        if (blockSize < 64) {
+            break;
+        }
+    }
+
+    // the last string is not terminated
+    if (inString_carry != 0) {
+        return json_error_set(JSON_ERROR_SYNTAX, length);
+    }
+
+    return 0;
+}
+
+// 5-8. check the left and right brackets are matched
+int json_index_checkBrackets(const JSON_Index * index) {
+    char * stack = NULL;
+    size_t stack_size = 0;
+    size_t stack_capacity = 0;
+
+    size_t k;
+    for (k = 0; k < index->size; k++) {
+        const char c = index->string[index->positions[k]];
+
+        if (c == '{' || c == '[') {
+            if (stack_size == stack_capacity) {
+                stack_capacity = stack_capacity == 0 ? 64 : stack_capacity * 2;
+                char * s = realloc(stack, stack_capacity);
+                if (s == NULL) {
+                    JSON_LOG("%s: out of memory\n", __func__);
+                    json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+                    free(stack);
+                    return -1;
+                }
+                stack = s;
+            }
+            stack[stack_size++] = c;
+            continue;
+        }
+
+        if (c == '}' || c == ']') {
+            if (stack_size == 0 || stack[--stack_size] != (c == '}' ? '{' : '[')) {
+                free(stack);
+                return json_error_set(JSON_ERROR_SYNTAX, index->positions[k]);
+            }
+        }
+    }
+
+    free(stack);
+
+    // the brackets are not closed at the end of string
+    if (stack_size != 0) {
+        return json_error_set(JSON_ERROR_SYNTAX, index->length);
+    }
+    return 0;
+}
+
+// 5-9. find the structural slot of the string index
+int json_index_findSlot(const JSON_Index * index, const size_t input_string_startIndex, size_t * output_slot) {
+    size_t low = 0, high = index->size;
+
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (index->positions[middle] < input_string_startIndex) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    // the start index is not the structural of a value
+    if (low == index->size || index->positions[low] != input_string_startIndex) {
+        return json_error_set(JSON_ERROR_NOT_FOUND, input_string_startIndex);
+    }
+
+    *output_slot = low;
+    return 0;
+}
+
+// 5-10. get the value at the structural slot with end index, JSON type and the slot behind the value
+int json_index_getValue(const JSON_Index * index, const size_t slot, size_t * output_endIndex, int * output_jsonType, size_t * output_nextSlot) {
+    if (slot >= index->size) {
+        return json_error_set(JSON_ERROR_SYNTAX, index->length);
+    }
+
+    const size_t * positions = index->positions;
+    const size_t startIndex = positions[slot];
+
+    switch (index->string[startIndex]) {
+        // 1. string, the next structural is the closing quote
+        case '\"':
+            if (slot + 1 >= index->size) {
+                return json_error_set(JSON_ERROR_SYNTAX, index->length);
+            }
+            *output_endIndex = positions[slot + 1];
+            *output_jsonType = JSON_TYPE_STRING;
+            *output_nextSlot = slot + 2;
+            return 0;
+
+        // 2. object & array, jump to the matched bracket
+        case '{':
+        case '[': {
+            size_t k, depth = 1;
+            for (k = slot + 1; k < index->size; k++) {
+                const char c = index->string[positions[k]];
+
+                if (c == '{' || c == '[') {
+                    depth++;
+                } else if ((c == '}' || c == ']') && --depth == 0) {
+                    *output_endIndex = positions[k];
+                    *output_jsonType = c == '}' ? JSON_TYPE_OBJECT : JSON_TYPE_ARRAY;
+                    *output_nextSlot = k + 1;
+                    return 0;
+                }
+            }
+            return json_error_set(JSON_ERROR_SYNTAX, index->length);
+        }
+
+        // 3. not a value
+        case '}':
+        case ']':
+        case ':':
+        case ',':
+            return json_error_set(JSON_ERROR_SYNTAX, startIndex);
+
+        // 4. number, boolean and null
+        default: {
+            size_t endIndex;
+            int jsonType;
+            if (json_value_scan(index->string, index->length, startIndex, &endIndex, &jsonType) != 0) {
+                return json_error_set(JSON_ERROR_SYNTAX, startIndex);
+            }
+
+            // the value should end before the next structural
+            if (slot + 1 < index->size && endIndex >= positions[slot + 1]) {
+                return json_error_set(JSON_ERROR_SYNTAX, positions[slot + 1]);
+            }
+
+            *output_endIndex = endIndex;
+            *output_jsonType = jsonType;
+            *output_nextSlot = slot + 1;
+            return 0;
+        }
+    }
+}
+
+// 5-11. object get the value slot by key
+int json_index_object_getSlotByKey(const JSON_Index * index, const size_t slot, const char * input_key, const size_t input_key_startIndex, const size_t input_key_endIndex, size_t * output_slot) {
+    const char * string = index->string;
+    const size_t * positions = index->positions;
+
+    // check the first character
+    if (slot >= index->size) {
+        return json_error_set(JSON_ERROR_NOT_FOUND, index->length);
+    }
+
+    if (string[positions[slot]] != '{') {
+        return json_error_set(JSON_ERROR_NOT_FOUND, positions[slot]);
+    }
+
+    size_t k = slot + 1;
+
+    // check right curly bracket
+    if (k < index->size && string[positions[k]] == '}') {
+        return json_error_set(JSON_ERROR_NOT_FOUND, positions[k]);
+    }
+
+    for (;;) {
+        // 1. key, colon and value
+        if (k + 3 >= index->size) {
+            return json_error_set(JSON_ERROR_SYNTAX, index->length);
+        }
+
+        if (string[positions[k]] != '\"') {
+            return json_error_set(JSON_ERROR_SYNTAX, positions[k]);
+        }
+
+        if (string[positions[k + 2]] != ':') {
+            return json_error_set(JSON_ERROR_SYNTAX, positions[k + 2]);
+        }
+
+        size_t value_endIndex, next;
+        int value_jsonType;
+        if (json_index_getValue(index, k + 3, &value_endIndex, &value_jsonType, &next) != 0) {
+            return -1;
+        }
+
+        // 2. check the key (string compare)
+        if (json_util_stringCompare_n(input_key, input_key_startIndex, input_key_endIndex, string, positions[k], positions[k + 1]) == 0) {
+            *output_slot = k + 3;
+            return 0;
+        }
+
+        // 3. check the structural behind the value
+        if (next >= index->size) {
+            return json_error_set(JSON_ERROR_SYNTAX, index->length);
+        }
+
+        if (string[positions[next]] != ',') {
+            // it's the end of the object or invalid character
+            return json_error_set(string[positions[next]] == '}' ? JSON_ERROR_NOT_FOUND : JSON_ERROR_SYNTAX, positions[next]);
+        }
+
+        k = next + 1;
+    }
+}
+
+// 5-12. array get the value slot by position
+int json_index_array_getSlotByPosition(const JSON_Index * index, const size_t slot, const size_t input_array_position, size_t * output_slot) {
+    const char * string = index->string;
+    const size_t * positions = index->positions;
+
+    // check the first character
+    if (slot >= index->size) {
+        return json_error_set(JSON_ERROR_NOT_FOUND, index->length);
+    }
+
+    if (string[positions[slot]] != '[') {
+        return json_error_set(JSON_ERROR_NOT_FOUND, positions[slot]);
+    }
+
+    size_t k = slot + 1;
+
+    // check right square bracket
+    if (k < index->size && string[positions[k]] == ']') {
+        return json_error_set(JSON_ERROR_NOT_FOUND, positions[k]);
+    }
+
+    size_t position;
+    for (position = 0; ; position++) {
+        size_t value_endIndex, next;
+        int value_jsonType;
+        if (json_index_getValue(index, k, &value_endIndex, &value_jsonType, &next) != 0) {
+            return -1;
+        }
+
+        if (position == input_array_position) {
+            *output_slot = k;
+            return 0;
+        }
+
+        // check the structural behind the value
+        if (next >= index->size) {
+            return json_error_set(JSON_ERROR_SYNTAX, index->length);
+        }
+
+        if (string[positions[next]] != ',') {
+            // it's the end of the array or invalid character
+            return json_error_set(string[positions[next]] == ']' ? JSON_ERROR_NOT_FOUND : JSON_ERROR_SYNTAX, positions[next]);
+        }
+
+        k = next + 1;
+    }
+}
+
+// 5-13. get the start & end index and JSON type of the value slot
+int json_index_getResult(const JSON_Index * index, const size_t slot, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType) {
+    size_t endIndex, next;
+    int jsonType;
+    if (json_index_getValue(index, slot, &endIndex, &jsonType, &next) != 0) {
+        return -1;
+    }
+
+    // the string value is returned to caller, check the characters inside the string
+    if (jsonType == JSON_TYPE_STRING) {
+        size_t string_endIndex;
+        if (json_getString_n(index->string, index->length, index->positions[slot], &string_endIndex) != 0 || string_endIndex != endIndex) {
+            return json_error_set(JSON_ERROR_SYNTAX, index->positions[slot]);
+        }
+    }
+
+    *output_value_startIndex = index->positions[slot];
+    *output_value_endIndex   = endIndex;
+    *output_value_jsonType   = jsonType;
+    return 0;
+}
+
+// 5-14. skip the object or array from the left bracket to the matched right bracket, the brackets inside the strings are ignored
+int json_simd_skipContainer(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, const char left, const char right, size_t * output_endIndex) {
+    uint64_t escaped_carry  = 0;
+    uint64_t inString_carry = 0;
+    size_t depth = 1;
+
+    char padding[64];
+    size_t i;
+    for (i = input_string_startIndex + 1; i < input_string_length; i += 64) {
+        size_t blockSize;
+        const char * block = json_simd_loadBlock(input_string, input_string_length, i, padding, &blockSize);
+
+        JSON_Block_Vectors vectors;
+        json_simd_loadVectors(block, &vectors);
+
+        // 1. find the characters inside the strings
+        const uint64_t escaped = json_simd_escapedMask(json_simd_matchMask(&vectors, '\\'), &escaped_carry);
+        const uint64_t quote = json_simd_matchMask(&vectors, '\"') & ~escaped;
+        const uint64_t inString = json_simd_prefixXor(quote) ^ inString_carry;
+        inString_carry = (uint64_t) ((int64_t) inString >> 63);
+
+        // 2. find the brackets outside the strings
+        const uint64_t opens  = json_simd_matchMask(&vectors, left)  & ~inString;
+        const uint64_t closes = json_simd_matchMask(&vectors, right) & ~inString;
+
+        // 3. the depth can't reach zero in this block, count the brackets in bulk
+        if ((size_t) __builtin_popcountll(closes) < depth) {
+            depth += __builtin_popcountll(opens);
+            depth -= __builtin_popcountll(closes);
+        }
+
+        // 4. walk the brackets in order to find the matched one
+        else {
+            uint64_t brackets = opens | closes;
+            while (brackets != 0) {
+                const uint64_t bit = brackets & (~brackets + 1);
+                if (opens & bit) {
+                    depth++;
+                } else if (--depth == 0) {
+                    *output_endIndex = i + __builtin_ctzll(bit);
+                    return 0;
+                }
+                brackets ^= bit;
+            }
+        }
+
+        // it's the end of the string
+        if (blockSize < 64) {
+            break;
+        }
+    }
+
+    *output_endIndex = JSON_INDEX_NONE;
+    return -1;
+}
+
+
+// 6-1. append the entry words to the tape
+int json_tape_append(JSON_Tape * tape, const uint64_t word_0, const uint64_t word_1, const uint64_t word_2, const size_t size) {
+    if (tape->size + size > tape->capacity) {
+        size_t capacity = tape->capacity == 0 ? 256 : tape->capacity * 2;
+        uint64_t * entries = realloc(tape->entries, capacity * sizeof(uint64_t));
+        if (entries == NULL) {
+            JSON_LOG("%s: out of memory\n", __func__);
+            return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+        }
+        tape->entries = entries;
+        tape->capacity = capacity;
+    }
+
+    uint64_t * entry = tape->entries + tape->size;
+    entry[0] = word_0;
+    if (size > 1) entry[1] = word_1;
+    if (size > 2) entry[2] = word_2;
+
+    tape->size += size;
+    return 0;
+}
+
+// 6-2. append the number entry, the integer is decoded to int64 and the others are decoded to double
+int json_tape_appendNumber(JSON_Tape * tape, const size_t startIndex, const size_t endIndex) {
+    // 1. try the integer in int64 range
+    uint64_t magnitude;
+    int negative;
+    const int error = json_number_parseInteger_n(tape->string, tape->length, startIndex, &magnitude, &negative);
+
+    // -0 is kept as double to keep the sign
+    if (error == JSON_NUMBER_ERROR_NONE && magnitude <= (uint64_t) INT64_MAX + negative && !(negative && magnitude == 0)) {
+        const int64_t value = negative ? (int64_t) (0 - magnitude) : (int64_t) magnitude;
+        return json_tape_append(tape, JSON_TAPE_ENTRY('l', startIndex), endIndex, (uint64_t) value, 3);
+    }
+
+    // 2. fraction, exponent or out of range integer
+    double number;
+    if (json_number_toDouble_n(tape->string, tape->length, startIndex, &number) != 0) {
+        return -1;
+    }
+
+    uint64_t bits;
+    memcpy(&bits, &number, sizeof(double));
+    return json_tape_append(tape, JSON_TAPE_ENTRY('d', startIndex), endIndex, bits, 3);
+}
+
+// 6-3. parse the JSON string to tape with an explicit container stack
+int json_tape_parse(JSON_Tape * tape) {
+    const char * s = tape->string;
+    const size_t length = tape->length;
+
+    // the tape index of the open containers
+    size_t * stack = NULL;
+    size_t stack_size = 0;
+    size_t stack_capacity = 0;
+
+    size_t i = 0, endIndex;
+
+    // the offset is stored in 56 bits
+    if (length != JSON_LENGTH_UNBOUNDED && length > JSON_TAPE_PAYLOAD_MASK) {
+        return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+    }
+
+    if (json_util_getNextCharacter_n(s, length, &i) != 0) {
+        return json_error_set(JSON_ERROR_SYNTAX, i);
+    }
+
+parse_value:
+    switch (json_util_charAt(s, length, i)) {
+        case '{':
+        case '[': {
+            const char left = s[i];
+
+            if (stack_size == stack_capacity) {
+                stack_capacity = stack_capacity == 0 ? 64 : stack_capacity * 2;
+                size_t * p = realloc(stack, stack_capacity * sizeof(size_t));
+                if (p == NULL) {
+                    JSON_LOG("%s: out of memory\n", __func__);
+                    json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+                    goto failure;
+                }
+                stack = p;
+            }
+            stack[stack_size++] = tape->size;
+
+            // the matched end entry index is set when the container is closed
+            if (json_tape_append(tape, JSON_TAPE_ENTRY(left, i), 0, 0, 2) != 0) {
+                goto failure;
+            }
+            i++;
+
+            if (json_util_getNextCharacter_n(s, length, &i) != 0) {
+                goto invalid_character;
+            }
+
+            // empty container
+            if (s[i] == (left == '{' ? '}' : ']')) {
+                goto close_container;
+            }
+
+            if (left == '{') {
+                goto parse_key;
+            }
+            goto parse_value;
+        }
+
+        case '\"':
+            if (json_string_scan(s, length, i, &endIndex) != 0) {
+                goto invalid_character;
+            }
+            if (json_tape_append(tape, JSON_TAPE_ENTRY('\"', i), endIndex, 0, 2) != 0) {
+                goto failure;
+            }
+            i = endIndex + 1;
+            goto after_value;
+
+        case 't':
+        case 'f':
+            if (json_boolean_scan(s, length, i, &endIndex) != 0) {
+                goto invalid_character;
+            }
+            if (json_tape_append(tape, JSON_TAPE_ENTRY(s[i], i), 0, 0, 1) != 0) {
+                goto failure;
+            }
+            i = endIndex + 1;
+            goto after_value;
+
+        case 'n':
+            if (json_null_scan(s, length, i, &endIndex) != 0) {
+                goto invalid_character;
+            }
+            if (json_tape_append(tape, JSON_TAPE_ENTRY('n', i), 0, 0, 1) != 0) {
+                goto failure;
+            }
+            i = endIndex + 1;
+            goto after_value;
+
+        default:
+            if (json_number_scan(s, length, i, &endIndex) != 0) {
+                goto invalid_character;
+            }
+            if (json_tape_appendNumber(tape, i, endIndex) != 0) {
+                goto failure;
+            }
+            i = endIndex + 1;
+            goto after_value;
+    }
+
+parse_key:
+    // key, the hash is stored for the lookup
+    if (json_util_charAt(s, length, i) != '\"' || json_string_scan(s, length, i, &endIndex) != 0) {
+        goto invalid_character;
+    }
+    if (json_tape_append(tape, JSON_TAPE_ENTRY('k', i), endIndex, json_util_hash(s + i + 1, endIndex - i - 1), 3) != 0) {
+        goto failure;
+    }
+    i = endIndex + 1;
+
+    // colon
+    if (json_util_skipWhitespace(s, length, &i) != ':') {
+        goto invalid_character;
+    }
+    i++;
+
+    if (json_util_getNextCharacter_n(s, length, &i) != 0) {
+        goto invalid_character;
+    }
+    goto parse_value;
+
+after_value:
+    // 1. it's the end of the root value, only the blank is allowed behind it
+    if (stack_size == 0) {
+        if (json_util_getNextCharacter_n(s, length, &i) == 0) {
+            goto invalid_character;
+        }
+        free(stack);
+        return 0;
+    }
+
+    if (json_util_getNextCharacter_n(s, length, &i) != 0) {
+        goto invalid_character;
+    }
+
+    // 2. comma, the next key or value
+    const char left = JSON_TAPE_TAG(tape->entries[stack[stack_size - 1]]);
+    if (s[i] == ',') {
+        i++;
+        if (json_util_getNextCharacter_n(s, length, &i) != 0) {
+            goto invalid_character;
+        }
+        if (left == '{') {
+            goto parse_key;
+        }
+        goto parse_value;
+    }
+
+    // 3. the end of container
+    if (s[i] != (left == '{' ? '}' : ']')) {
+        goto invalid_character;
+    }
+
+close_container: {
+        const size_t openIndex = stack[--stack_size];
+        tape->entries[openIndex + 1] = tape->size;
+
+        if (json_tape_append(tape, JSON_TAPE_ENTRY(s[i], i), openIndex, 0, 2) != 0) {
+            goto failure;
+        }
+        i++;
+        goto after_value;
+    }
+
+invalid_character:
+    json_error_set(JSON_ERROR_SYNTAX, i);
+
+failure:
+    free(stack);
+    return -1;
+}
+
+// 6-4. get the tape index behind the value, the object and array are skipped by the matched end entry index
+static inline size_t json_tape_nextIndex(const JSON_Tape * tape, const size_t tapeIndex) {
+    const uint64_t entry = tape->entries[tapeIndex];
+
+    switch (JSON_TAPE_TAG(entry)) {
+        case '{':
+        case '[':
+            return tape->entries[tapeIndex + 1] + 2;
+
+        case 'k':
+        case 'l':
+        case 'd':
+            return tapeIndex + 3;
+
+        case 't':
+        case 'f':
+        case 'n':
+            return tapeIndex + 1;
+
+        // string and the end of container
+        default:
+            return tapeIndex + 2;
+    }
+}
+
+// 6-5. hash the characters (FNV-1a)
+uint64_t json_util_hash(const char * string, const size_t length) {
+    uint64_t hash = 0xCBF29CE484222325ULL;
+
+    size_t i;
+    for (i = 0; i < length; i++) {
+        hash ^= (unsigned char) string[i];
+        hash *= 0x100000001B3ULL;
+    }
+
+    return hash;
+}
+
+
+// 6-6. find the value tape index of the key characters (without the quotes) in the object
+size_t json_tape_object_findKey(const JSON_Tape * tape, const size_t tapeIndex, const char * key, const size_t key_length, const uint64_t key_hash) {
+    const uint64_t * entries = tape->entries;
+    const size_t closeIndex = entries[tapeIndex + 1];
+
+    size_t t = tapeIndex + 2;
+    while (t < closeIndex) {
+        // 1. compare the hash and length first, then the key characters
+        const size_t key_startIndex = JSON_TAPE_PAYLOAD(entries[t]);
+        const size_t key_endIndex   = entries[t + 1];
+
+        if (entries[t + 2] == key_hash && key_endIndex - key_startIndex - 1 == key_length &&
+            memcmp(tape->string + key_startIndex + 1, key, key_length) == 0) {
+            return t + 3;
+        }
+
+        // 2. skip the key and the value
+        t = json_tape_nextIndex(tape, t + 3);
+    }
+
+    return JSON_INDEX_NONE;
+}
+
+
+// 7-1. find or insert the object record by the object start index
+JSON_Lookup_Object * json_lookup_findObject(JSON_Lookup * lookup, const size_t startIndex) {
+    // 1. grow the object table when it's half full
+    if ((lookup->size + 1) * 2 > lookup->capacity) {
+        size_t capacity = lookup->capacity == 0 ? 16 : lookup->capacity * 2;
+        JSON_Lookup_Object * objects = malloc(capacity * sizeof(JSON_Lookup_Object));
+        if (objects == NULL) {
+            JSON_LOG("%s: out of memory\n", __func__);
+            json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+            return NULL;
+        }
+
+        size_t i;
+        for (i = 0; i < capacity; i++) {
+            objects[i].startIndex = JSON_INDEX_NONE;
+        }
+
+        // rehash the records
+        for (i = 0; i < lookup->capacity; i++) {
+            if (lookup->objects[i].startIndex == JSON_INDEX_NONE) {
+                continue;
+            }
+
+            size_t j = json_util_hashIndex(lookup->objects[i].startIndex) & (capacity - 1);
+            while (objects[j].startIndex != JSON_INDEX_NONE) {
+                j = (j + 1) & (capacity - 1);
+            }
+            objects[j] = lookup->objects[i];
+        }
+
+        free(lookup->objects);
+        lookup->objects = objects;
+        lookup->capacity = capacity;
+    }
+
+    // 2. linear probing
+    const size_t mask = lookup->capacity - 1;
+    size_t i = json_util_hashIndex(startIndex) & mask;
+    while (lookup->objects[i].startIndex != JSON_INDEX_NONE) {
+        if (lookup->objects[i].startIndex == startIndex) {
+            return &lookup->objects[i];
+        }
+        i = (i + 1) & mask;
+    }
+
+    // 3. insert the new record
+    JSON_Lookup_Object * object = &lookup->objects[i];
+    object->startIndex = startIndex;
+    object->count      = 0;
+    object->failed     = 0;
+    object->endIndex   = JSON_INDEX_NONE;
+    object->slots      = NULL;
+    object->capacity   = 0;
+
+    lookup->size++;
+    return object;
+}
+
+// 7-2. build the hash table from the key to the value of the object
+int json_lookup_buildTable(const JSON_Lookup * lookup, JSON_Lookup_Object * object) {
+    const char * s = lookup->string;
+    const size_t length = lookup->length;
+    size_t i = object->startIndex;
+
+    if (json_util_charAt(s, length, i) != '{') {
+        return -1;
+    }
+    i++;
+
+    if (json_util_getNextCharacter_n(s, length, &i) != 0) {
+        return -1;
+    }
+
+    // 1. count the pairs and record them in order
+    size_t size = 0, capacity = 16;
+    JSON_Lookup_Slot * pairs = malloc(capacity * sizeof(JSON_Lookup_Slot));
+    if (pairs == NULL) {
+        JSON_LOG("%s: out of memory\n", __func__);
+        return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+    }
+
+    while (s[i] != '}') {
+        if (size == capacity) {
+            capacity *= 2;
+            JSON_Lookup_Slot * p = realloc(pairs, capacity * sizeof(JSON_Lookup_Slot));
+            if (p == NULL) {
+                JSON_LOG("%s: out of memory\n", __func__);
+                json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+                goto failure;
+            }
+            pairs = p;
+        }
+
+        JSON_Lookup_Slot * pair = &pairs[size++];
+        if (json_keyValuePair_scan(s, length, &i, &pair->key_startIndex, &pair->key_endIndex, &pair->value_startIndex, &pair->value_endIndex, &pair->value_jsonType) != 0) {
+            goto failure;
+        }
+        pair->hash = json_util_hash(s + pair->key_startIndex, pair->key_endIndex - pair->key_startIndex + 1);
+
+        // the comma or the end of object behind the value
+        i = pair->value_endIndex + 1;
+        if (json_util_getNextCharacter_n(s, length, &i) != 0) {
+            goto failure;
+        }
+
+        if (s[i] == ',') {
+            i++;
+            if (json_util_getNextCharacter_n(s, length, &i) != 0 || s[i] == '}') {
+                goto failure;
+            }
+        } else if (s[i] != '}') {
+            goto failure;
+        }
+    }
+
+    object->endIndex = i;
+
+    // 2. the table is at most half full
+    for (capacity = 16; capacity < size * 2; capacity *= 2);
+
+    object->slots = malloc(capacity * sizeof(JSON_Lookup_Slot));
+    if (object->slots == NULL) {
+        JSON_LOG("%s: out of memory\n", __func__);
+        json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+        goto failure;
+    }
+    object->capacity = capacity;
+
+    size_t j;
+    for (j = 0; j < capacity; j++) {
+        object->slots[j].key_startIndex = JSON_INDEX_NONE;
+    }
+
+    // 3. insert in order, the first one of the duplicate keys is kept
+    for (j = 0; j < size; j++) {
+        JSON_Lookup_Slot * slot = json_lookup_findSlot(lookup, object, s + pairs[j].key_startIndex, pairs[j].key_endIndex - pairs[j].key_startIndex + 1);
+        if (slot->key_startIndex == JSON_INDEX_NONE) {
+            *slot = pairs[j];
+        }
+    }
+
+    free(pairs);
+    return 0;
+
+failure:
+    free(pairs);
+    return -1;
+}
+
+// 7-3. find the slot of the key, or the empty slot where the key should be inserted
+JSON_Lookup_Slot * json_lookup_findSlot(const JSON_Lookup * lookup, const JSON_Lookup_Object * object, const char * key, const size_t key_length) {
+    const uint64_t hash = json_util_hash(key, key_length);
+    const size_t mask = object->capacity - 1;
+
+    size_t i = (size_t) hash & mask;
+    while (object->slots[i].key_startIndex != JSON_INDEX_NONE) {
+        const JSON_Lookup_Slot * slot = &object->slots[i];
+
+        if (slot->hash == hash && slot->key_endIndex - slot->key_startIndex + 1 == key_length &&
+            memcmp(lookup->string + slot->key_startIndex, key, key_length) == 0) {
+            break;
+        }
+        i = (i + 1) & mask;
+    }
+
+    return &object->slots[i];
+}
+
+// 7-4. hash the index (Fibonacci hashing)
+static inline size_t json_util_hashIndex(const size_t index) {
+    return (size_t) (((uint64_t) index * 0x9E3779B97F4A7C15ULL) >> 32);
+}
+
+
+// 8-1. add the trie node of the step
+size_t json_pathSet_addNode(JSON_Path_Set * set, const JSON_Path_Step * step, const char * keys) {
+    if (set->nodes_size == set->nodes_capacity) {
+        size_t capacity = set->nodes_capacity == 0 ? 16 : set->nodes_capacity * 2;
+        JSON_Path_Node * nodes = realloc(set->nodes, capacity * sizeof(JSON_Path_Node));
+        if (nodes == NULL) {
+            JSON_LOG("%s: out of memory\n", __func__);
+            json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+            return JSON_INDEX_NONE;
+        }
+        set->nodes = nodes;
+        set->nodes_capacity = capacity;
+    }
+
+    JSON_Path_Node * node = &set->nodes[set->nodes_size];
+    node->step    = step;
+    node->keys    = keys;
+    node->child   = JSON_INDEX_NONE;
+    node->sibling = JSON_INDEX_NONE;
+    node->output  = JSON_INDEX_NONE;
+
+    return set->nodes_size++;
+}
+
+// 8-2. insert the path into the trie, the same prefix shares the nodes
+int json_pathSet_insert(JSON_Path_Set * set, const size_t pathIndex) {
+    const JSON_Path * path = set->paths[pathIndex];
+
+    size_t node = 0;
+    size_t i;
+    for (i = 0; i < path->size; i++) {
+        const JSON_Path_Step * step = &path->steps[i];
+
+        // 1. find the child of the same step
+        size_t child = set->nodes[node].child, last = JSON_INDEX_NONE;
+        while (child != JSON_INDEX_NONE) {
+            const JSON_Path_Node * c = &set->nodes[child];
+
+            if (c->step->type == step->type) {
+                if (step->type == JSON_TYPE_STRING) {
+                    if (c->step->key_hash == step->key_hash &&
+                        json_util_stringCompare_n(c->keys, c->step->key_startIndex, c->step->key_endIndex, path->keys, step->key_startIndex, step->key_endIndex) == 0) {
+                        break;
+                    }
+                } else if (c->step->position == step->position) {
+                    break;
+                }
+            }
+
+            last = child;
+            child = c->sibling;
+        }
+
+        // 2. add the child behind the last one
+        if (child == JSON_INDEX_NONE) {
+            child = json_pathSet_addNode(set, step, path->keys);
+            if (child == JSON_INDEX_NONE) {
+                return -1;
+            }
+
+            if (last == JSON_INDEX_NONE) {
+                set->nodes[node].child = child;
+            } else {
+                set->nodes[last].sibling = child;
+            }
+        }
+
+        node = child;
+    }
+
+    // 3. the path ends at the node
+    set->outputs_next[pathIndex] = set->nodes[node].output;
+    set->nodes[node].output = pathIndex;
+    return 0;
+}
+
+// 8-3. walk the document from the root node, the walk stops once all children of a node are found
+//      the scratch has a matched flag for each node of the set at least, so the walk never allocates
+void json_pathSet_eval(const JSON_Path_Set * set, const char * string, const size_t length, const size_t startIndex, unsigned char * scratch, JSON_Value_Range * outputs) {
+    // 1. set to default, the path is not found
+    size_t i;
+    for (i = 0; i < set->size; i++) {
+        outputs[i].startIndex = JSON_INDEX_NONE;
+        outputs[i].endIndex   = JSON_INDEX_NONE;
+        outputs[i].jsonType   = -1;
+    }
+
+    // 2. walk into the object or array
+    switch (json_util_charAt(string, length, startIndex)) {
+        case '{':
+            json_pathSet_walkObject(set, 0, string, length, startIndex, scratch, outputs);
+            break;
+
+        case '[':
+            json_pathSet_walkArray(set, 0, string, length, startIndex, scratch, outputs);
+            break;
+
+        default:
+            break;
+    }
+}
+
+// 8-4. the value of the node is found, write the outputs and walk into the children
+void json_pathSet_match(const JSON_Path_Set * set, const size_t node, const char * string, const size_t length, const size_t value_startIndex, const size_t value_endIndex, const int value_jsonType, unsigned char * scratch, JSON_Value_Range * outputs) {
+    size_t p;
+    for (p = set->nodes[node].output; p != JSON_INDEX_NONE; p = set->outputs_next[p]) {
+        outputs[p].startIndex = value_startIndex;
+        outputs[p].endIndex   = value_endIndex;
+        outputs[p].jsonType   = value_jsonType;
+    }
+
+    if (set->nodes[node].child == JSON_INDEX_NONE) {
+        return;
+    }
+
+    if (value_jsonType == JSON_TYPE_OBJECT) {
+        json_pathSet_walkObject(set, node, string, length, value_startIndex, scratch, outputs);
+    } else if (value_jsonType == JSON_TYPE_ARRAY) {
+        json_pathSet_walkArray(set, node, string, length, value_startIndex, scratch, outputs);
+    }
+}
+
+// 8-5. scan the object once for the key children of the node, stop when all of them are found
+//      the matched flags of the children are at the front of the scratch, the nested walks use the rest of it
+void json_pathSet_walkObject(const JSON_Path_Set * set, const size_t node, const char * string, const size_t length, const size_t startIndex, unsigned char * scratch, JSON_Value_Range * outputs) {
+    const char * s = string;
+
+    // 1. count the key children, the first one of the duplicate keys is matched
+    size_t children = 0, remaining = 0;
+    size_t child;
+    for (child = set->nodes[node].child; child != JSON_INDEX_NONE; child = set->nodes[child].sibling) {
+        children++;
+        remaining += set->nodes[child].step->type == JSON_TYPE_STRING;
+    }
+
+    if (remaining == 0) {
+        return;
+    }
+
+    // the children of the nodes on the walk are disjoint, so the frames fit in the flags of all nodes
+    unsigned char * matched = scratch;
+    memset(matched, 0, children);
+
+    // 2. scan the key value pairs
+    size_t i = startIndex + 1;
+    if (json_util_getNextCharacter_n(s, length, &i) != 0 || s[i] == '}') {
+        return;
+    }
+
+    size_t key_startIndex, key_endIndex;
+    size_t value_startIndex, value_endIndex;
+    int value_jsonType;
+
+    while (json_keyValuePair_scan(s, length, &i, &key_startIndex, &key_endIndex, &value_startIndex, &value_endIndex, &value_jsonType) == 0) {
+        const char * key = s + key_startIndex + 1;
+        const size_t key_length = key_endIndex - key_startIndex - 1;
+        const uint64_t key_hash = json_util_hash(key, key_length);
+
+        size_t k;
+        for (child = set->nodes[node].child, k = 0; child != JSON_INDEX_NONE; child = set->nodes[child].sibling, k++) {
+            const JSON_Path_Node * c = &set->nodes[child];
+
+            if (!matched[k] && c->step->type == JSON_TYPE_STRING && c->step->key_hash == key_hash &&
+                c->step->key_endIndex - c->step->key_startIndex - 1 == key_length &&
+                memcmp(c->keys + c->step->key_startIndex + 1, key, key_length) == 0) {
+                matched[k] = 1;
+                remaining--;
+                json_pathSet_match(set, child, s, length, value_startIndex, value_endIndex, value_jsonType, scratch + children, outputs);
+                break;
+            }
+        }
+
+        // early stop
+        if (remaining == 0) {
+            return;
+        }
+
+        // comma behind the value, the whitespace before the next key is skipped by the kernel
+        if (json_util_skipWhitespace(s, length, &i) != ',') {
+            return;
+        }
+        i++;
+    }
+}
+
+// 8-6. scan the array once for the position children of the node, stop behind the last position
+void json_pathSet_walkArray(const JSON_Path_Set * set, const size_t node, const char * string, const size_t length, const size_t startIndex, unsigned char * scratch, JSON_Value_Range * outputs) {
+    const char * s = string;
+
+    // 1. the last position of the children
+    size_t remaining = 0, last_position = 0;
+    size_t child;
+    for (child = set->nodes[node].child; child != JSON_INDEX_NONE; child = set->nodes[child].sibling) {
+        if (set->nodes[child].step->type == JSON_TYPE_NUMBER) {
+            remaining++;
+            if (set->nodes[child].step->position > last_position) {
+                last_position = set->nodes[child].step->position;
+            }
+        }
+    }
+
+    if (remaining == 0) {
+        return;
+    }
+
+    // 2. scan the values
+    size_t i = startIndex + 1;
+    if (json_util_getNextCharacter_n(s, length, &i) != 0 || s[i] == ']') {
+        return;
+    }
+
+    size_t position = 0;
+    size_t endIndex;
+    int jsonType;
+
+    while (json_value_scan(s, length, i, &endIndex, &jsonType) == 0) {
+        for (child = set->nodes[node].child; child != JSON_INDEX_NONE; child = set->nodes[child].sibling) {
+            const JSON_Path_Node * c = &set->nodes[child];
+
+            if (c->step->type == JSON_TYPE_NUMBER && c->step->position == position) {
+                remaining--;
+                json_pathSet_match(set, child, s, length, i, endIndex, jsonType, scratch, outputs);
+                break;
+            }
+        }
+
+        // early stop
+        if (remaining == 0 || position++ == last_position) {
+            return;
+        }
+
+        // comma behind the value
+        i = endIndex + 1;
+        if (json_util_skipWhitespace(s, length, &i) != ',') {
+            return;
+        }
+        i++;
+
+        if (json_util_getNextCharacter_n(s, length, &i) != 0) {
+            return;
+        }
+    }
+}
+
+
+// 9-1. allocate the zeroed memory in the arena, or in the heap if the arena is NULL
+int json_arena_allocZero(JSON_Arena * arena, const size_t size, void ** pointer) {
+    if (arena == NULL) {
+        *pointer = calloc(1, size);
+        if (*pointer == NULL) {
+            JSON_LOG("%s: out of memory\n", __func__);
+            return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+        }
+        return 0;
+    }
+
+    if (json_arena_alloc(arena, size, pointer) != 0) {
+        return -1;
+    }
+
+    memset(*pointer, 0, size);
+    return 0;
+}
+
+// 9-2. allocate the substring in the arena, or in the heap if the arena is NULL
+int json_arena_allocSubstring(JSON_Arena * arena, const char * string, const size_t startIndex, const size_t endIndex, char ** substring) {
+    if (arena == NULL) {
+        return json_util_allocSubstring_n(string, startIndex, endIndex, substring);
+    }
+
+    *substring = NULL;
+
+    const size_t length = endIndex - startIndex + 1;
+    char * s;
+    if (json_arena_alloc(arena, length + 1, (void **) &s) != 0) {
+        return -1;
+    }
+
+    memcpy(s, string + startIndex, length);
+    s[length] = '\0';
+
+    *substring = s;
+    return 0;
+}
+
+// 9-3. allocate the string of the number in the arena, or in the heap if the arena is NULL
+int json_arena_allocStringBySize(JSON_Arena * arena, const size_t number, char ** string) {
+    if (arena == NULL) {
+        return json_util_allocStringBySize_n(number, string);
+    }
+
+    *string = NULL;
+
+    char buffer[24];
+    const int length = sprintf(buffer, "%zu", number);
+
+    char * s;
+    if (json_arena_alloc(arena, length + 1, (void **) &s) != 0) {
+        return -1;
+    }
+
+    memcpy(s, buffer, length + 1);
+
+    *string = s;
+    return 0;
+}
+
+
+// 10-1. initialize the iterator at the left bracket
+int json_iter_init(JSON_Iter * iter, const char * string, const size_t length, const size_t startIndex, const char left, const char right) {
+    iter->string   = string;
+    iter->length   = length;
+    iter->index    = startIndex;
+    iter->position = 0;
+    iter->state    = JSON_ITER_STATE_ERROR;
+
+    if (json_util_charAt(string, length, startIndex) != left) {
+        return -1;
+    }
+
+    // filter the blank, util find the first value or the right bracket
+    size_t i = startIndex + 1;
+    const char c = json_util_skipWhitespace(string, length, &i);
+    if (c == '\0') {
+        return -1;
+    }
+
+    iter->index = i;
+    iter->state = c == right ? JSON_ITER_STATE_END : JSON_ITER_STATE_VALUE;
+    return 0;
+}
+
+// 10-2. move the iterator to the next value, skip the comma behind the last value
+int json_iter_advance(JSON_Iter * iter, const char right) {
+    switch (iter->state) {
+        case JSON_ITER_STATE_VALUE:
+            return 0;
+
+        case JSON_ITER_STATE_END:
+            return 1;
+
+        case JSON_ITER_STATE_SEPARATOR:
+            break;
+
+        // the index is kept at the invalid character
+        default:
+            return json_error_set(JSON_ERROR_SYNTAX, iter->index);
+    }
+
+    const char * s = iter->string;
+    size_t i = iter->index;
+
+    // filter the blank, util find the next character
+    const char c = json_util_skipWhitespace(s, iter->length, &i);
+
+    // 1. it's the end of the object or array
+    if (c == right) {
+        iter->index = i;
+        iter->state = JSON_ITER_STATE_END;
+        return 1;
+    }
+
+    // 2. find comma behind the value
+    if (c != ',') {
+        goto invalid_character;
+    }
+    i++;
+
+    if (json_util_skipWhitespace(s, iter->length, &i) == '\0') {
+        goto invalid_character;
+    }
+
+    iter->index = i;
+    iter->state = JSON_ITER_STATE_VALUE;
+    return 0;
+
+invalid_character:
+    iter->index = i;
+    iter->state = JSON_ITER_STATE_ERROR;
+    return json_error_set(JSON_ERROR_SYNTAX, i);
+}
+
+
+// 11-1. parse the number to double in place, the grammar is the same as json_getNumber_n
+int json_number_parse_n(const char * string, const size_t length, const size_t startIndex, size_t * endIndex, double * number) {
+    const char * s = string;
+    size_t i = startIndex;
+
+    // 1. sign
+    const int negative = json_util_charAt(s, length, i) == '-';
+    if (negative) {
+        i++;
+    }
+
+    // 2. integer part, the mantissa overflows silently if there are more than 19 digits, it's handled below
+    const size_t integer_startIndex = i;
+    uint64_t mantissa = 0;
+
+    if (json_util_charAt(s, length, i) == '0') {
+        i++;
+    } else if (JSON_NUMBER_IS_DIGIT(json_util_charAt(s, length, i))) {
+        do {
+            mantissa = mantissa * 10 + (s[i] - '0');
+            i++;
+        } while (JSON_NUMBER_IS_DIGIT(json_util_charAt(s, length, i)));
+    } else {
+        return -1;
+    }
+
+    const size_t integer_endIndex = i;
+
+    // 3. fractional part, the '.' without digit behind it is not a part of the number
+    size_t fraction_startIndex = i, fraction_endIndex = i;
+    if (json_util_charAt(s, length, i) == '.' && JSON_NUMBER_IS_DIGIT(json_util_charAt(s, length, i + 1))) {
+        fraction_startIndex = ++i;
+        do {
+            mantissa = mantissa * 10 + (s[i] - '0');
+            i++;
+        } while (JSON_NUMBER_IS_DIGIT(json_util_charAt(s, length, i)));
+        fraction_endIndex = i;
+    }
+
+    // 4. exponent part, the 'e' without digit behind it is not a part of the number
+    int64_t exponent_number = 0;
+    char c = json_util_charAt(s, length, i);
+    if (c == 'e' || c == 'E') {
+        size_t j = i + 1;
+        int exponent_negative = 0;
+
+        c = json_util_charAt(s, length, j);
+        if (c == '+' || c == '-') {
+            exponent_negative = c == '-';
+            j++;
+        }
+
+        if (JSON_NUMBER_IS_DIGIT(json_util_charAt(s, length, j))) {
+            do {
+                // the value is infinity or zero anyway
+                if (exponent_number < 0x10000) {
+                    exponent_number = exponent_number * 10 + (s[j] - '0');
+                }
+                j++;
+            } while (JSON_NUMBER_IS_DIGIT(json_util_charAt(s, length, j)));
+
+            if (exponent_negative) {
+                exponent_number = -exponent_number;
+            }
+            i = j;
+        }
+    }
+
+    *endIndex = i - 1;
+
+    int64_t exponent = exponent_number - (int64_t) (fraction_endIndex - fraction_startIndex);
+
+    // 5. keep the first 19 significant digits if there are more, the mantissa is truncated
+    int truncated = 0;
+    size_t digit_count = (integer_endIndex - integer_startIndex) + (fraction_endIndex - fraction_startIndex);
+    if (digit_count > 19) {
+        // the leading zeros are not significant
+        size_t j;
+        for (j = integer_startIndex; j < fraction_endIndex && (s[j] == '0' || s[j] == '.'); j++) {
+            digit_count -= s[j] == '0';
+        }
+
+        if (digit_count > 19) {
+            truncated = 1;
+            mantissa = 0;
+
+            size_t n = 0;
+            for (j = integer_startIndex; j < integer_endIndex && n < 19; j++) {
+                if (n == 0 && s[j] == '0') {
+                    continue;
+                }
+                mantissa = mantissa * 10 + (s[j] - '0');
+                n++;
+            }
+
+            if (j < integer_endIndex) {
+                exponent = exponent_number + (int64_t) (integer_endIndex - j);
+            } else {
+                for (j = fraction_startIndex; j < fraction_endIndex && n < 19; j++) {
+                    if (n == 0 && s[j] == '0') {
+                        continue;
+                    }
+                    mantissa = mantissa * 10 + (s[j] - '0');
+                    n++;
+                }
+                exponent = exponent_number - (int64_t) (j - fraction_startIndex);
+            }
+        }
+    }
+
+    // 6-1. the mantissa and the power of ten are exact doubles (Clinger's fast path)
+    if (!truncated && exponent >= -22 && exponent <= 22 && mantissa <= ((uint64_t) 1 << 53)) {
+        static const double power_of_ten[23] = {
+            1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+
+        double value = (double) mantissa;
+        if (exponent < 0) {
+            value /= power_of_ten[-exponent];
+        } else {
+            value *= power_of_ten[exponent];
+        }
+
+        *number = negative ? -value : value;
+        return 0;
+    }
+
+    // 6-2. Eisel-Lemire, the truncated mantissa is correct if the mantissa + 1 is rounded to the same double
+    uint64_t bits;
+    uint64_t bits_upper;
+    json_number_eiselLemire(mantissa, exponent, &bits);
+
+    if (!truncated || (json_number_eiselLemire(mantissa + 1, exponent, &bits_upper), bits == bits_upper)) {
+        bits |= (uint64_t) negative << 63;
+        memcpy(number, &bits, sizeof(double));
+        return 0;
+    }
+
+    // 6-3. the hard case, parse the copy by strtod with the decimal point of the locale
+    return json_number_parseSlow(string, startIndex, *endIndex, number);
+}
+
+// 11-2. convert the decimal mantissa and exponent to the double bits (Eisel-Lemire)
+void json_number_eiselLemire(uint64_t mantissa, const int64_t exponent, uint64_t * bits) {
+    // 1. zero or infinity
+    if (mantissa == 0 || exponent < JSON_NUMBER_SMALLEST_POWER_OF_TEN) {
+        *bits = 0;
+        return;
+    }
+
+    if (exponent > JSON_NUMBER_LARGEST_POWER_OF_TEN) {
+        *bits = (uint64_t) 0x7FF << 52;
+        return;
+    }
+
+    // 2. multiply the normalized mantissa by the 128-bit power of five
+    const int leading_zeros = __builtin_clzll(mantissa);
+    mantissa <<= leading_zeros;
+
+    const size_t index = 2 * (size_t) (exponent - JSON_NUMBER_SMALLEST_POWER_OF_TEN);
+    uint64_t high, low;
+    json_number_multiply(mantissa, json_number_powerOfFive[index], &high, &low);
+
+    // the lower bits might be affected by the truncated power of five
+    if ((high & 0x1FF) == 0x1FF) {
+        uint64_t second_high, second_low;
+        json_number_multiply(mantissa, json_number_powerOfFive[index + 1], &second_high, &second_low);
+        low += second_high;
+        if (second_high > low) {
+            high++;
+        }
+    }
+
+    // 3. keep the 54 bits (53 bits and the rounding bit)
+    const int upper_bit = (int) (high >> 63);
+    const int shift = upper_bit + 64 - 52 - 3;
+    uint64_t m = high >> shift;
+    int64_t power2 = ((((152170 + 65536) * exponent) >> 16) + 63) + upper_bit - leading_zeros + 1023;
+
+    // 4. subnormal
+    if (power2 <= 0) {
+        if (-power2 + 1 >= 64) {
+            *bits = 0;
+            return;
+        }
+
+        m >>= -power2 + 1;
+        m += m & 1;
+        m >>= 1;
+
+        // the rounding might make it normal
+        power2 = m < ((uint64_t) 1 << 52) ? 0 : 1;
+        *bits = (m & (((uint64_t) 1 << 52) - 1)) | ((uint64_t) power2 << 52);
+        return;
+    }
+
+    // 5. round to even when the value is exactly in the middle
+    if (low <= 1 && exponent >= -4 && exponent <= 23 && (m & 3) == 1) {
+        if ((m << shift) == high) {
+            m &= ~(uint64_t) 1;
+        }
+    }
+
+    m += m & 1;
+    m >>= 1;
+
+    if (m >= ((uint64_t) 2 << 52)) {
+        m = (uint64_t) 1 << 52;
+        power2++;
+    }
+
+    m &= ~((uint64_t) 1 << 52);
+
+    if (power2 >= 0x7FF) {
+        *bits = (uint64_t) 0x7FF << 52;
+        return;
+    }
+
+    *bits = m | ((uint64_t) power2 << 52);
+}
+
+// 11-3. multiply the 64-bit integers to the 128-bit integer
+static inline void json_number_multiply(const uint64_t a, const uint64_t b, uint64_t * high, uint64_t * low) {
+#ifdef __SIZEOF_INT128__
+    const unsigned __int128 product = (unsigned __int128) a * b;
+    *high = (uint64_t) (product >> 64);
+    *low  = (uint64_t) product;
+#else
+    const uint64_t a_low = (uint32_t) a, a_high = a >> 32;
+    const uint64_t b_low = (uint32_t) b, b_high = b >> 32;
+
+    const uint64_t low_low   = a_low * b_low;
+    const uint64_t high_low  = a_high * b_low;
+    const uint64_t low_high  = a_low * b_high;
+    const uint64_t high_high = a_high * b_high;
+
+    const uint64_t cross = (low_low >> 32) + (uint32_t) high_low + low_high;
+    *high = high_high + (high_low >> 32) + (cross >> 32);
+    *low  = (cross << 32) | (uint32_t) low_low;
+#endif
+}
+
+// 11-4. parse the number by strtod, the '.' is replaced by the decimal point of the locale
+int json_number_parseSlow(const char * string, const size_t startIndex, const size_t endIndex, double * number) {
+    const size_t length = endIndex - startIndex + 1;
+
+    char buffer[128];
+    char * copy = buffer;
+    if (length >= sizeof(buffer)) {
+        copy = malloc(length + 1);
+        if (copy == NULL) {
+            JSON_LOG("%s: out of memory\n", __func__);
+            return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+        }
+    }
+
+    memcpy(copy, string + startIndex, length);
+    copy[length] = '\0';
+
+    const char decimal_point = localeconv()->decimal_point[0];
+    if (decimal_point != '.') {
+        char * dot = memchr(copy, '.', length);
+        if (dot != NULL) {
+            *dot = decimal_point;
         }
+    }
+
+    *number = strtod(copy, NULL);
 
-        (*output_keyValuePairList_size)++;
+    if (copy != buffer) {
+        free(copy);
+    }
+    return 0;
+}
 
-        // 4. move to the index behind the value
-        i = value_endIndex + 1;
+// 11-5. the 128-bit truncated powers of five from 5^-342 to 5^308, the most significant bit is set
+static const uint64_t json_number_powerOfFive[2 * (JSON_NUMBER_LARGEST_POWER_OF_TEN - JSON_NUMBER_SMALLEST_POWER_OF_TEN + 1)] = {
+    0xEEF453D6923BD65AULL, 0x113FAA2906A13B3FULL,   // 5^-342
+    0x9558B4661B6565F8ULL, 0x4AC7CA59A424C507ULL,   // 5^-341
+    0xBAAEE17FA23EBF76ULL, 0x5D79BCF00D2DF649ULL,   // 5^-340
+    0xE95A99DF8ACE6F53ULL, 0xF4D82C2C107973DCULL,   // 5^-339
+    0x91D8A02BB6C10594ULL, 0x79071B9B8A4BE869ULL,   // 5^-338
+    0xB64EC836A47146F9ULL, 0x9748E2826CDEE284ULL,   // 5^-337
+    0xE3E27A444D8D98B7ULL, 0xFD1B1B2308169B25ULL,   // 5^-336
+    0x8E6D8C6AB0787F72ULL, 0xFE30F0F5E50E20F7ULL,   // 5^-335
+    0xB208EF855C969F4FULL, 0xBDBD2D335E51A935ULL,   // 5^-334
+    0xDE8B2B66B3BC4723ULL, 0xAD2C788035E61382ULL,   // 5^-333
+    0x8B16FB203055AC76ULL, 0x4C3BCB5021AFCC31ULL,   // 5^-332
+    0xADDCB9E83C6B1793ULL, 0xDF4ABE242A1BBF3DULL,   // 5^-331
+    0xD953E8624B85DD78ULL, 0xD71D6DAD34A2AF0DULL,   // 5^-330
+    0x87D4713D6F33AA6BULL, 0x8672648C40E5AD68ULL,   // 5^-329
+    0xA9C98D8CCB009506ULL, 0x680EFDAF511F18C2ULL,   // 5^-328
+    0xD43BF0EFFDC0BA48ULL, 0x0212BD1B2566DEF2ULL,   // 5^-327
+    0x84A57695FE98746DULL, 0x014BB630F7604B57ULL,   // 5^-326
+    0xA5CED43B7E3E9188ULL, 0x419EA3BD35385E2DULL,   // 5^-325
+    0xCF42894A5DCE35EAULL, 0x52064CAC828675B9ULL,   // 5^-324
+    0x818995CE7AA0E1B2ULL, 0x7343EFEBD1940993ULL,   // 5^-323
+    0xA1EBFB4219491A1FULL, 0x1014EBE6C5F90BF8ULL,   // 5^-322
+    0xCA66FA129F9B60A6ULL, 0xD41A26E077774EF6ULL,   // 5^-321
+    0xFD00B897478238D0ULL, 0x8920B098955522B4ULL,   // 5^-320
+    0x9E20735E8CB16382ULL, 0x55B46E5F5D5535B0ULL,   // 5^-319
+    0xC5A890362FDDBC62ULL, 0xEB2189F734AA831DULL,   // 5^-318
+    0xF712B443BBD52B7BULL, 0xA5E9EC7501D523E4ULL,   // 5^-317
+    0x9A6BB0AA55653B2DULL, 0x47B233C92125366EULL,   // 5^-316
+    0xC1069CD4EABE89F8ULL, 0x999EC0BB696E840AULL,   // 5^-315
+    0xF148440A256E2C76ULL, 0xC00670EA43CA250DULL,   // 5^-314
+    0x96CD2A865764DBCAULL, 0x380406926A5E5728ULL,   // 5^-313
+    0xBC807527ED3E12BCULL, 0xC605083704F5ECF2ULL,   // 5^-312
+    0xEBA09271E88D976BULL, 0xF7864A44C633682EULL,   // 5^-311
+    0x93445B8731587EA3ULL, 0x7AB3EE6AFBE0211DULL,   // 5^-310
+    0xB8157268FDAE9E4CULL, 0x5960EA05BAD82964ULL,   // 5^-309
+    0xE61ACF033D1A45DFULL, 0x6FB92487298E33BDULL,   // 5^-308
+    0x8FD0C16206306BABULL, 0xA5D3B6D479F8E056ULL,   // 5^-307
+    0xB3C4F1BA87BC8696ULL, 0x8F48A4899877186CULL,   // 5^-306
+    0xE0B62E2929ABA83CULL, 0x331ACDABFE94DE87ULL,   // 5^-305
+    0x8C71DCD9BA0B4925ULL, 0x9FF0C08B7F1D0B14ULL,   // 5^-304
+    0xAF8E5410288E1B6FULL, 0x07ECF0AE5EE44DD9ULL,   // 5^-303
+    0xDB71E91432B1A24AULL, 0xC9E82CD9F69D6150ULL,   // 5^-302
+    0x892731AC9FAF056EULL, 0xBE311C083A225CD2ULL,   // 5^-301
+    0xAB70FE17C79AC6CAULL, 0x6DBD630A48AAF406ULL,   // 5^-300
+    0xD64D3D9DB981787DULL, 0x092CBBCCDAD5B108ULL,   // 5^-299
+    0x85F0468293F0EB4EULL, 0x25BBF56008C58EA5ULL,   // 5^-298
+    0xA76C582338ED2621ULL, 0xAF2AF2B80AF6F24EULL,   // 5^-297
+    0xD1476E2C07286FAAULL, 0x1AF5AF660DB4AEE1ULL,   // 5^-296
+    0x82CCA4DB847945CAULL, 0x50D98D9FC890ED4DULL,   // 5^-295
+    0xA37FCE126597973CULL, 0xE50FF107BAB528A0ULL,   // 5^-294
+    0xCC5FC196FEFD7D0CULL, 0x1E53ED49A96272C8ULL,   // 5^-293
+    0xFF77B1FCBEBCDC4FULL, 0x25E8E89C13BB0F7AULL,   // 5^-292
+    0x9FAACF3DF73609B1ULL, 0x77B191618C54E9ACULL,   // 5^-291
+    0xC795830D75038C1DULL, 0xD59DF5B9EF6A2417ULL,   // 5^-290
+    0xF97AE3D0D2446F25ULL, 0x4B0573286B44AD1DULL,   // 5^-289
+    0x9BECCE62836AC577ULL, 0x4EE367F9430AEC32ULL,   // 5^-288
+    0xC2E801FB244576D5ULL, 0x229C41F793CDA73FULL,   // 5^-287
+    0xF3A20279ED56D48AULL, 0x6B43527578C1110FULL,   // 5^-286
+    0x9845418C345644D6ULL, 0x830A13896B78AAA9ULL,   // 5^-285
+    0xBE5691EF416BD60CULL, 0x23CC986BC656D553ULL,   // 5^-284
+    0xEDEC366B11C6CB8FULL, 0x2CBFBE86B7EC8AA8ULL,   // 5^-283
+    0x94B3A202EB1C3F39ULL, 0x7BF7D71432F3D6A9ULL,   // 5^-282
+    0xB9E08A83A5E34F07ULL, 0xDAF5CCD93FB0CC53ULL,   // 5^-281
+    0xE858AD248F5C22C9ULL, 0xD1B3400F8F9CFF68ULL,   // 5^-280
+    0x91376C36D99995BEULL, 0x23100809B9C21FA1ULL,   // 5^-279
+    0xB58547448FFFFB2DULL, 0xABD40A0C2832A78AULL,   // 5^-278
+    0xE2E69915B3FFF9F9ULL, 0x16C90C8F323F516CULL,   // 5^-277
+    0x8DD01FAD907FFC3BULL, 0xAE3DA7D97F6792E3ULL,   // 5^-276
+    0xB1442798F49FFB4AULL, 0x99CD11CFDF41779CULL,   // 5^-275
+    0xDD95317F31C7FA1DULL, 0x40405643D711D583ULL,   // 5^-274
+    0x8A7D3EEF7F1CFC52ULL, 0x482835EA666B2572ULL,   // 5^-273
+    0xAD1C8EAB5EE43B66ULL, 0xDA3243650005EECFULL,   // 5^-272
+    0xD863B256369D4A40ULL, 0x90BED43E40076A82ULL,   // 5^-271
+    0x873E4F75E2224E68ULL, 0x5A7744A6E804A291ULL,   // 5^-270
+    0xA90DE3535AAAE202ULL, 0x711515D0A205CB36ULL,   // 5^-269
+    0xD3515C2831559A83ULL, 0x0D5A5B44CA873E03ULL,   // 5^-268
+    0x8412D9991ED58091ULL, 0xE858790AFE9486C2ULL,   // 5^-267
+    0xA5178FFF668AE0B6ULL, 0x626E974DBE39A872ULL,   // 5^-266
+    0xCE5D73FF402D98E3ULL, 0xFB0A3D212DC8128FULL,   // 5^-265
+    0x80FA687F881C7F8EULL, 0x7CE66634BC9D0B99ULL,   // 5^-264
+    0xA139029F6A239F72ULL, 0x1C1FFFC1EBC44E80ULL,   // 5^-263
+    0xC987434744AC874EULL, 0xA327FFB266B56220ULL,   // 5^-262
+    0xFBE9141915D7A922ULL, 0x4BF1FF9F0062BAA8ULL,   // 5^-261
+    0x9D71AC8FADA6C9B5ULL, 0x6F773FC3603DB4A9ULL,   // 5^-260
+    0xC4CE17B399107C22ULL, 0xCB550FB4384D21D3ULL,   // 5^-259
+    0xF6019DA07F549B2BULL, 0x7E2A53A146606A48ULL,   // 5^-258
+    0x99C102844F94E0FBULL, 0x2EDA7444CBFC426DULL,   // 5^-257
+    0xC0314325637A1939ULL, 0xFA911155FEFB5308ULL,   // 5^-256
+    0xF03D93EEBC589F88ULL, 0x793555AB7EBA27CAULL,   // 5^-255
+    0x96267C7535B763B5ULL, 0x4BC1558B2F3458DEULL,   // 5^-254
+    0xBBB01B9283253CA2ULL, 0x9EB1AAEDFB016F16ULL,   // 5^-253
+    0xEA9C227723EE8BCBULL, 0x465E15A979C1CADCULL,   // 5^-252
+    0x92A1958A7675175FULL, 0x0BFACD89EC191EC9ULL,   // 5^-251
+    0xB749FAED14125D36ULL, 0xCEF980EC671F667BULL,   // 5^-250
+    0xE51C79A85916F484ULL, 0x82B7E12780E7401AULL,   // 5^-249
+    0x8F31CC0937AE58D2ULL, 0xD1B2ECB8B0908810ULL,   // 5^-248
+    0xB2FE3F0B8599EF07ULL, 0x861FA7E6DCB4AA15ULL,   // 5^-247
+    0xDFBDCECE67006AC9ULL, 0x67A791E093E1D49AULL,   // 5^-246
+    0x8BD6A141006042BDULL, 0xE0C8BB2C5C6D24E0ULL,   // 5^-245
+    0xAECC49914078536DULL, 0x58FAE9F773886E18ULL,   // 5^-244
+    0xDA7F5BF590966848ULL, 0xAF39A475506A899EULL,   // 5^-243
+    0x888F99797A5E012DULL, 0x6D8406C952429603ULL,   // 5^-242
+    0xAAB37FD7D8F58178ULL, 0xC8E5087BA6D33B83ULL,   // 5^-241
+    0xD5605FCDCF32E1D6ULL, 0xFB1E4A9A90880A64ULL,   // 5^-240
+    0x855C3BE0A17FCD26ULL, 0x5CF2EEA09A55067FULL,   // 5^-239
+    0xA6B34AD8C9DFC06FULL, 0xF42FAA48C0EA481EULL,   // 5^-238
+    0xD0601D8EFC57B08BULL, 0xF13B94DAF124DA26ULL,   // 5^-237
+    0x823C12795DB6CE57ULL, 0x76C53D08D6B70858ULL,   // 5^-236
+    0xA2CB1717B52481EDULL, 0x54768C4B0C64CA6EULL,   // 5^-235
+    0xCB7DDCDDA26DA268ULL, 0xA9942F5DCF7DFD09ULL,   // 5^-234
+    0xFE5D54150B090B02ULL, 0xD3F93B35435D7C4CULL,   // 5^-233
+    0x9EFA548D26E5A6E1ULL, 0xC47BC5014A1A6DAFULL,   // 5^-232
+    0xC6B8E9B0709F109AULL, 0x359AB6419CA1091BULL,   // 5^-231
+    0xF867241C8CC6D4C0ULL, 0xC30163D203C94B62ULL,   // 5^-230
+    0x9B407691D7FC44F8ULL, 0x79E0DE63425DCF1DULL,   // 5^-229
+    0xC21094364DFB5636ULL, 0x985915FC12F542E4ULL,   // 5^-228
+    0xF294B943E17A2BC4ULL, 0x3E6F5B7B17B2939DULL,   // 5^-227
+    0x979CF3CA6CEC5B5AULL, 0xA705992CEECF9C42ULL,   // 5^-226
+    0xBD8430BD08277231ULL, 0x50C6FF782A838353ULL,   // 5^-225
+    0xECE53CEC4A314EBDULL, 0xA4F8BF5635246428ULL,   // 5^-224
+    0x940F4613AE5ED136ULL, 0x871B7795E136BE99ULL,   // 5^-223
+    0xB913179899F68584ULL, 0x28E2557B59846E3FULL,   // 5^-222
+    0xE757DD7EC07426E5ULL, 0x331AEADA2FE589CFULL,   // 5^-221
+    0x9096EA6F3848984FULL, 0x3FF0D2C85DEF7621ULL,   // 5^-220
+    0xB4BCA50B065ABE63ULL, 0x0FED077A756B53A9ULL,   // 5^-219
+    0xE1EBCE4DC7F16DFBULL, 0xD3E8495912C62894ULL,   // 5^-218
+    0x8D3360F09CF6E4BDULL, 0x64712DD7ABBBD95CULL,   // 5^-217
+    0xB080392CC4349DECULL, 0xBD8D794D96AACFB3ULL,   // 5^-216
+    0xDCA04777F541C567ULL, 0xECF0D7A0FC5583A0ULL,   // 5^-215
+    0x89E42CAAF9491B60ULL, 0xF41686C49DB57244ULL,   // 5^-214
+    0xAC5D37D5B79B6239ULL, 0x311C2875C522CED5ULL,   // 5^-213
+    0xD77485CB25823AC7ULL, 0x7D633293366B828BULL,   // 5^-212
+    0x86A8D39EF77164BCULL, 0xAE5DFF9C02033197ULL,   // 5^-211
+    0xA8530886B54DBDEBULL, 0xD9F57F830283FDFCULL,   // 5^-210
+    0xD267CAA862A12D66ULL, 0xD072DF63C324FD7BULL,   // 5^-209
+    0x8380DEA93DA4BC60ULL, 0x4247CB9E59F71E6DULL,   // 5^-208
+    0xA46116538D0DEB78ULL, 0x52D9BE85F074E608ULL,   // 5^-207
+    0xCD795BE870516656ULL, 0x67902E276C921F8BULL,   // 5^-206
+    0x806BD9714632DFF6ULL, 0x00BA1CD8A3DB53B6ULL,   // 5^-205
+    0xA086CFCD97BF97F3ULL, 0x80E8A40ECCD228A4ULL,   // 5^-204
+    0xC8A883C0FDAF7DF0ULL, 0x6122CD128006B2CDULL,   // 5^-203
+    0xFAD2A4B13D1B5D6CULL, 0x796B805720085F81ULL,   // 5^-202
+    0x9CC3A6EEC6311A63ULL, 0xCBE3303674053BB0ULL,   // 5^-201
+    0xC3F490AA77BD60FCULL, 0xBEDBFC4411068A9CULL,   // 5^-200
+    0xF4F1B4D515ACB93BULL, 0xEE92FB5515482D44ULL,   // 5^-199
+    0x991711052D8BF3C5ULL, 0x751BDD152D4D1C4AULL,   // 5^-198
+    0xBF5CD54678EEF0B6ULL, 0xD262D45A78A0635DULL,   // 5^-197
+    0xEF340A98172AACE4ULL, 0x86FB897116C87C34ULL,   // 5^-196
+    0x9580869F0E7AAC0EULL, 0xD45D35E6AE3D4DA0ULL,   // 5^-195
+    0xBAE0A846D2195712ULL, 0x8974836059CCA109ULL,   // 5^-194
+    0xE998D258869FACD7ULL, 0x2BD1A438703FC94BULL,   // 5^-193
+    0x91FF83775423CC06ULL, 0x7B6306A34627DDCFULL,   // 5^-192
+    0xB67F6455292CBF08ULL, 0x1A3BC84C17B1D542ULL,   // 5^-191
+    0xE41F3D6A7377EECAULL, 0x20CABA5F1D9E4A93ULL,   // 5^-190
+    0x8E938662882AF53EULL, 0x547EB47B7282EE9CULL,   // 5^-189
+    0xB23867FB2A35B28DULL, 0xE99E619A4F23AA43ULL,   // 5^-188
+    0xDEC681F9F4C31F31ULL, 0x6405FA00E2EC94D4ULL,   // 5^-187
+    0x8B3C113C38F9F37EULL, 0xDE83BC408DD3DD04ULL,   // 5^-186
+    0xAE0B158B4738705EULL, 0x9624AB50B148D445ULL,   // 5^-185
+    0xD98DDAEE19068C76ULL, 0x3BADD624DD9B0957ULL,   // 5^-184
+    0x87F8A8D4CFA417C9ULL, 0xE54CA5D70A80E5D6ULL,   // 5^-183
+    0xA9F6D30A038D1DBCULL, 0x5E9FCF4CCD211F4CULL,   // 5^-182
+    0xD47487CC8470652BULL, 0x7647C3200069671FULL,   // 5^-181
+    0x84C8D4DFD2C63F3BULL, 0x29ECD9F40041E073ULL,   // 5^-180
+    0xA5FB0A17C777CF09ULL, 0xF468107100525890ULL,   // 5^-179
+    0xCF79CC9DB955C2CCULL, 0x7182148D4066EEB4ULL,   // 5^-178
+    0x81AC1FE293D599BFULL, 0xC6F14CD848405530ULL,   // 5^-177
+    0xA21727DB38CB002FULL, 0xB8ADA00E5A506A7CULL,   // 5^-176
+    0xCA9CF1D206FDC03BULL, 0xA6D90811F0E4851CULL,   // 5^-175
+    0xFD442E4688BD304AULL, 0x908F4A166D1DA663ULL,   // 5^-174
+    0x9E4A9CEC15763E2EULL, 0x9A598E4E043287FEULL,   // 5^-173
+    0xC5DD44271AD3CDBAULL, 0x40EFF1E1853F29FDULL,   // 5^-172
+    0xF7549530E188C128ULL, 0xD12BEE59E68EF47CULL,   // 5^-171
+    0x9A94DD3E8CF578B9ULL, 0x82BB74F8301958CEULL,   // 5^-170
+    0xC13A148E3032D6E7ULL, 0xE36A52363C1FAF01ULL,   // 5^-169
+    0xF18899B1BC3F8CA1ULL, 0xDC44E6C3CB279AC1ULL,   // 5^-168
+    0x96F5600F15A7B7E5ULL, 0x29AB103A5EF8C0B9ULL,   // 5^-167
+    0xBCB2B812DB11A5DEULL, 0x7415D448F6B6F0E7ULL,   // 5^-166
+    0xEBDF661791D60F56ULL, 0x111B495B3464AD21ULL,   // 5^-165
+    0x936B9FCEBB25C995ULL, 0xCAB10DD900BEEC34ULL,   // 5^-164
+    0xB84687C269EF3BFBULL, 0x3D5D514F40EEA742ULL,   // 5^-163
+    0xE65829B3046B0AFAULL, 0x0CB4A5A3112A5112ULL,   // 5^-162
+    0x8FF71A0FE2C2E6DCULL, 0x47F0E785EABA72ABULL,   // 5^-161
+    0xB3F4E093DB73A093ULL, 0x59ED216765690F56ULL,   // 5^-160
+    0xE0F218B8D25088B8ULL, 0x306869C13EC3532CULL,   // 5^-159
+    0x8C974F7383725573ULL, 0x1E414218C73A13FBULL,   // 5^-158
+    0xAFBD2350644EEACFULL, 0xE5D1929EF90898FAULL,   // 5^-157
+    0xDBAC6C247D62A583ULL, 0xDF45F746B74ABF39ULL,   // 5^-156
+    0x894BC396CE5DA772ULL, 0x6B8BBA8C328EB783ULL,   // 5^-155
+    0xAB9EB47C81F5114FULL, 0x066EA92F3F326564ULL,   // 5^-154
+    0xD686619BA27255A2ULL, 0xC80A537B0EFEFEBDULL,   // 5^-153
+    0x8613FD0145877585ULL, 0xBD06742CE95F5F36ULL,   // 5^-152
+    0xA798FC4196E952E7ULL, 0x2C48113823B73704ULL,   // 5^-151
+    0xD17F3B51FCA3A7A0ULL, 0xF75A15862CA504C5ULL,   // 5^-150
+    0x82EF85133DE648C4ULL, 0x9A984D73DBE722FBULL,   // 5^-149
+    0xA3AB66580D5FDAF5ULL, 0xC13E60D0D2E0EBBAULL,   // 5^-148
+    0xCC963FEE10B7D1B3ULL, 0x318DF905079926A8ULL,   // 5^-147
+    0xFFBBCFE994E5C61FULL, 0xFDF17746497F7052ULL,   // 5^-146
+    0x9FD561F1FD0F9BD3ULL, 0xFEB6EA8BEDEFA633ULL,   // 5^-145
+    0xC7CABA6E7C5382C8ULL, 0xFE64A52EE96B8FC0ULL,   // 5^-144
+    0xF9BD690A1B68637BULL, 0x3DFDCE7AA3C673B0ULL,   // 5^-143
+    0x9C1661A651213E2DULL, 0x06BEA10CA65C084EULL,   // 5^-142
+    0xC31BFA0FE5698DB8ULL, 0x486E494FCFF30A62ULL,   // 5^-141
+    0xF3E2F893DEC3F126ULL, 0x5A89DBA3C3EFCCFAULL,   // 5^-140
+    0x986DDB5C6B3A76B7ULL, 0xF89629465A75E01CULL,   // 5^-139
+    0xBE89523386091465ULL, 0xF6BBB397F1135823ULL,   // 5^-138
+    0xEE2BA6C0678B597FULL, 0x746AA07DED582E2CULL,   // 5^-137
+    0x94DB483840B717EFULL, 0xA8C2A44EB4571CDCULL,   // 5^-136
+    0xBA121A4650E4DDEBULL, 0x92F34D62616CE413ULL,   // 5^-135
+    0xE896A0D7E51E1566ULL, 0x77B020BAF9C81D17ULL,   // 5^-134
+    0x915E2486EF32CD60ULL, 0x0ACE1474DC1D122EULL,   // 5^-133
+    0xB5B5ADA8AAFF80B8ULL, 0x0D819992132456BAULL,   // 5^-132
+    0xE3231912D5BF60E6ULL, 0x10E1FFF697ED6C69ULL,   // 5^-131
+    0x8DF5EFABC5979C8FULL, 0xCA8D3FFA1EF463C1ULL,   // 5^-130
+    0xB1736B96B6FD83B3ULL, 0xBD308FF8A6B17CB2ULL,   // 5^-129
+    0xDDD0467C64BCE4A0ULL, 0xAC7CB3F6D05DDBDEULL,   // 5^-128
+    0x8AA22C0DBEF60EE4ULL, 0x6BCDF07A423AA96BULL,   // 5^-127
+    0xAD4AB7112EB3929DULL, 0x86C16C98D2C953C6ULL,   // 5^-126
+    0xD89D64D57A607744ULL, 0xE871C7BF077BA8B7ULL,   // 5^-125
+    0x87625F056C7C4A8BULL, 0x11471CD764AD4972ULL,   // 5^-124
+    0xA93AF6C6C79B5D2DULL, 0xD598E40D3DD89BCFULL,   // 5^-123
+    0xD389B47879823479ULL, 0x4AFF1D108D4EC2C3ULL,   // 5^-122
+    0x843610CB4BF160CBULL, 0xCEDF722A585139BAULL,   // 5^-121
+    0xA54394FE1EEDB8FEULL, 0xC2974EB4EE658828ULL,   // 5^-120
+    0xCE947A3DA6A9273EULL, 0x733D226229FEEA32ULL,   // 5^-119
+    0x811CCC668829B887ULL, 0x0806357D5A3F525FULL,   // 5^-118
+    0xA163FF802A3426A8ULL, 0xCA07C2DCB0CF26F7ULL,   // 5^-117
+    0xC9BCFF6034C13052ULL, 0xFC89B393DD02F0B5ULL,   // 5^-116
+    0xFC2C3F3841F17C67ULL, 0xBBAC2078D443ACE2ULL,   // 5^-115
+    0x9D9BA7832936EDC0ULL, 0xD54B944B84AA4C0DULL,   // 5^-114
+    0xC5029163F384A931ULL, 0x0A9E795E65D4DF11ULL,   // 5^-113
+    0xF64335BCF065D37DULL, 0x4D4617B5FF4A16D5ULL,   // 5^-112
+    0x99EA0196163FA42EULL, 0x504BCED1BF8E4E45ULL,   // 5^-111
+    0xC06481FB9BCF8D39ULL, 0xE45EC2862F71E1D6ULL,   // 5^-110
+    0xF07DA27A82C37088ULL, 0x5D767327BB4E5A4CULL,   // 5^-109
+    0x964E858C91BA2655ULL, 0x3A6A07F8D510F86FULL,   // 5^-108
+    0xBBE226EFB628AFEAULL, 0x890489F70A55368BULL,   // 5^-107
+    0xEADAB0ABA3B2DBE5ULL, 0x2B45AC74CCEA842EULL,   // 5^-106
+    0x92C8AE6B464FC96FULL, 0x3B0B8BC90012929DULL,   // 5^-105
+    0xB77ADA0617E3BBCBULL, 0x09CE6EBB40173744ULL,   // 5^-104
+    0xE55990879DDCAABDULL, 0xCC420A6A101D0515ULL,   // 5^-103
+    0x8F57FA54C2A9EAB6ULL, 0x9FA946824A12232DULL,   // 5^-102
+    0xB32DF8E9F3546564ULL, 0x47939822DC96ABF9ULL,   // 5^-101
+    0xDFF9772470297EBDULL, 0x59787E2B93BC56F7ULL,   // 5^-100
+    0x8BFBEA76C619EF36ULL, 0x57EB4EDB3C55B65AULL,   // 5^-99
+    0xAEFAE51477A06B03ULL, 0xEDE622920B6B23F1ULL,   // 5^-98
+    0xDAB99E59958885C4ULL, 0xE95FAB368E45ECEDULL,   // 5^-97
+    0x88B402F7FD75539BULL, 0x11DBCB0218EBB414ULL,   // 5^-96
+    0xAAE103B5FCD2A881ULL, 0xD652BDC29F26A119ULL,   // 5^-95
+    0xD59944A37C0752A2ULL, 0x4BE76D3346F0495FULL,   // 5^-94
+    0x857FCAE62D8493A5ULL, 0x6F70A4400C562DDBULL,   // 5^-93
+    0xA6DFBD9FB8E5B88EULL, 0xCB4CCD500F6BB952ULL,   // 5^-92
+    0xD097AD07A71F26B2ULL, 0x7E2000A41346A7A7ULL,   // 5^-91
+    0x825ECC24C873782FULL, 0x8ED400668C0C28C8ULL,   // 5^-90
+    0xA2F67F2DFA90563BULL, 0x728900802F0F32FAULL,   // 5^-89
+    0xCBB41EF979346BCAULL, 0x4F2B40A03AD2FFB9ULL,   // 5^-88
+    0xFEA126B7D78186BCULL, 0xE2F610C84987BFA8ULL,   // 5^-87
+    0x9F24B832E6B0F436ULL, 0x0DD9CA7D2DF4D7C9ULL,   // 5^-86
+    0xC6EDE63FA05D3143ULL, 0x91503D1C79720DBBULL,   // 5^-85
+    0xF8A95FCF88747D94ULL, 0x75A44C6397CE912AULL,   // 5^-84
+    0x9B69DBE1B548CE7CULL, 0xC986AFBE3EE11ABAULL,   // 5^-83
+    0xC24452DA229B021BULL, 0xFBE85BADCE996168ULL,   // 5^-82
+    0xF2D56790AB41C2A2ULL, 0xFAE27299423FB9C3ULL,   // 5^-81
+    0x97C560BA6B0919A5ULL, 0xDCCD879FC967D41AULL,   // 5^-80
+    0xBDB6B8E905CB600FULL, 0x5400E987BBC1C920ULL,   // 5^-79
+    0xED246723473E3813ULL, 0x290123E9AAB23B68ULL,   // 5^-78
+    0x9436C0760C86E30BULL, 0xF9A0B6720AAF6521ULL,   // 5^-77
+    0xB94470938FA89BCEULL, 0xF808E40E8D5B3E69ULL,   // 5^-76
+    0xE7958CB87392C2C2ULL, 0xB60B1D1230B20E04ULL,   // 5^-75
+    0x90BD77F3483BB9B9ULL, 0xB1C6F22B5E6F48C2ULL,   // 5^-74
+    0xB4ECD5F01A4AA828ULL, 0x1E38AEB6360B1AF3ULL,   // 5^-73
+    0xE2280B6C20DD5232ULL, 0x25C6DA63C38DE1B0ULL,   // 5^-72
+    0x8D590723948A535FULL, 0x579C487E5A38AD0EULL,   // 5^-71
+    0xB0AF48EC79ACE837ULL, 0x2D835A9DF0C6D851ULL,   // 5^-70
+    0xDCDB1B2798182244ULL, 0xF8E431456CF88E65ULL,   // 5^-69
+    0x8A08F0F8BF0F156BULL, 0x1B8E9ECB641B58FFULL,   // 5^-68
+    0xAC8B2D36EED2DAC5ULL, 0xE272467E3D222F3FULL,   // 5^-67
+    0xD7ADF884AA879177ULL, 0x5B0ED81DCC6ABB0FULL,   // 5^-66
+    0x86CCBB52EA94BAEAULL, 0x98E947129FC2B4E9ULL,   // 5^-65
+    0xA87FEA27A539E9A5ULL, 0x3F2398D747B36224ULL,   // 5^-64
+    0xD29FE4B18E88640EULL, 0x8EEC7F0D19A03AADULL,   // 5^-63
+    0x83A3EEEEF9153E89ULL, 0x1953CF68300424ACULL,   // 5^-62
+    0xA48CEAAAB75A8E2BULL, 0x5FA8C3423C052DD7ULL,   // 5^-61
+    0xCDB02555653131B6ULL, 0x3792F412CB06794DULL,   // 5^-60
+    0x808E17555F3EBF11ULL, 0xE2BBD88BBEE40BD0ULL,   // 5^-59
+    0xA0B19D2AB70E6ED6ULL, 0x5B6ACEAEAE9D0EC4ULL,   // 5^-58
+    0xC8DE047564D20A8BULL, 0xF245825A5A445275ULL,   // 5^-57
+    0xFB158592BE068D2EULL, 0xEED6E2F0F0D56712ULL,   // 5^-56
+    0x9CED737BB6C4183DULL, 0x55464DD69685606BULL,   // 5^-55
+    0xC428D05AA4751E4CULL, 0xAA97E14C3C26B886ULL,   // 5^-54
+    0xF53304714D9265DFULL, 0xD53DD99F4B3066A8ULL,   // 5^-53
+    0x993FE2C6D07B7FABULL, 0xE546A8038EFE4029ULL,   // 5^-52
+    0xBF8FDB78849A5F96ULL, 0xDE98520472BDD033ULL,   // 5^-51
+    0xEF73D256A5C0F77CULL, 0x963E66858F6D4440ULL,   // 5^-50
+    0x95A8637627989AADULL, 0xDDE7001379A44AA8ULL,   // 5^-49
+    0xBB127C53B17EC159ULL, 0x5560C018580D5D52ULL,   // 5^-48
+    0xE9D71B689DDE71AFULL, 0xAAB8F01E6E10B4A6ULL,   // 5^-47
+    0x9226712162AB070DULL, 0xCAB3961304CA70E8ULL,   // 5^-46
+    0xB6B00D69BB55C8D1ULL, 0x3D607B97C5FD0D22ULL,   // 5^-45
+    0xE45C10C42A2B3B05ULL, 0x8CB89A7DB77C506AULL,   // 5^-44
+    0x8EB98A7A9A5B04E3ULL, 0x77F3608E92ADB242ULL,   // 5^-43
+    0xB267ED1940F1C61CULL, 0x55F038B237591ED3ULL,   // 5^-42
+    0xDF01E85F912E37A3ULL, 0x6B6C46DEC52F6688ULL,   // 5^-41
+    0x8B61313BBABCE2C6ULL, 0x2323AC4B3B3DA015ULL,   // 5^-40
+    0xAE397D8AA96C1B77ULL, 0xABEC975E0A0D081AULL,   // 5^-39
+    0xD9C7DCED53C72255ULL, 0x96E7BD358C904A21ULL,   // 5^-38
+    0x881CEA14545C7575ULL, 0x7E50D64177DA2E54ULL,   // 5^-37
+    0xAA242499697392D2ULL, 0xDDE50BD1D5D0B9E9ULL,   // 5^-36
+    0xD4AD2DBFC3D07787ULL, 0x955E4EC64B44E864ULL,   // 5^-35
+    0x84EC3C97DA624AB4ULL, 0xBD5AF13BEF0B113EULL,   // 5^-34
+    0xA6274BBDD0FADD61ULL, 0xECB1AD8AEACDD58EULL,   // 5^-33
+    0xCFB11EAD453994BAULL, 0x67DE18EDA5814AF2ULL,   // 5^-32
+    0x81CEB32C4B43FCF4ULL, 0x80EACF948770CED7ULL,   // 5^-31
+    0xA2425FF75E14FC31ULL, 0xA1258379A94D028DULL,   // 5^-30
+    0xCAD2F7F5359A3B3EULL, 0x096EE45813A04330ULL,   // 5^-29
+    0xFD87B5F28300CA0DULL, 0x8BCA9D6E188853FCULL,   // 5^-28
+    0x9E74D1B791E07E48ULL, 0x775EA264CF55347EULL,   // 5^-27
+    0xC612062576589DDAULL, 0x95364AFE032A819EULL,   // 5^-26
+    0xF79687AED3EEC551ULL, 0x3A83DDBD83F52205ULL,   // 5^-25
+    0x9ABE14CD44753B52ULL, 0xC4926A9672793543ULL,   // 5^-24
+    0xC16D9A0095928A27ULL, 0x75B7053C0F178294ULL,   // 5^-23
+    0xF1C90080BAF72CB1ULL, 0x5324C68B12DD6339ULL,   // 5^-22
+    0x971DA05074DA7BEEULL, 0xD3F6FC16EBCA5E04ULL,   // 5^-21
+    0xBCE5086492111AEAULL, 0x88F4BB1CA6BCF585ULL,   // 5^-20
+    0xEC1E4A7DB69561A5ULL, 0x2B31E9E3D06C32E6ULL,   // 5^-19
+    0x9392EE8E921D5D07ULL, 0x3AFF322E62439FD0ULL,   // 5^-18
+    0xB877AA3236A4B449ULL, 0x09BEFEB9FAD487C3ULL,   // 5^-17
+    0xE69594BEC44DE15BULL, 0x4C2EBE687989A9B4ULL,   // 5^-16
+    0x901D7CF73AB0ACD9ULL, 0x0F9D37014BF60A11ULL,   // 5^-15
+    0xB424DC35095CD80FULL, 0x538484C19EF38C95ULL,   // 5^-14
+    0xE12E13424BB40E13ULL, 0x2865A5F206B06FBAULL,   // 5^-13
+    0x8CBCCC096F5088CBULL, 0xF93F87B7442E45D4ULL,   // 5^-12
+    0xAFEBFF0BCB24AAFEULL, 0xF78F69A51539D749ULL,   // 5^-11
+    0xDBE6FECEBDEDD5BEULL, 0xB573440E5A884D1CULL,   // 5^-10
+    0x89705F4136B4A597ULL, 0x31680A88F8953031ULL,   // 5^-9
+    0xABCC77118461CEFCULL, 0xFDC20D2B36BA7C3EULL,   // 5^-8
+    0xD6BF94D5E57A42BCULL, 0x3D32907604691B4DULL,   // 5^-7
+    0x8637BD05AF6C69B5ULL, 0xA63F9A49C2C1B110ULL,   // 5^-6
+    0xA7C5AC471B478423ULL, 0x0FCF80DC33721D54ULL,   // 5^-5
+    0xD1B71758E219652BULL, 0xD3C36113404EA4A9ULL,   // 5^-4
+    0x83126E978D4FDF3BULL, 0x645A1CAC083126EAULL,   // 5^-3
+    0xA3D70A3D70A3D70AULL, 0x3D70A3D70A3D70A4ULL,   // 5^-2
+    0xCCCCCCCCCCCCCCCCULL, 0xCCCCCCCCCCCCCCCDULL,   // 5^-1
+    0x8000000000000000ULL, 0x0000000000000000ULL,   // 5^0
+    0xA000000000000000ULL, 0x0000000000000000ULL,   // 5^1
+    0xC800000000000000ULL, 0x0000000000000000ULL,   // 5^2
+    0xFA00000000000000ULL, 0x0000000000000000ULL,   // 5^3
+    0x9C40000000000000ULL, 0x0000000000000000ULL,   // 5^4
+    0xC350000000000000ULL, 0x0000000000000000ULL,   // 5^5
+    0xF424000000000000ULL, 0x0000000000000000ULL,   // 5^6
+    0x9896800000000000ULL, 0x0000000000000000ULL,   // 5^7
+    0xBEBC200000000000ULL, 0x0000000000000000ULL,   // 5^8
+    0xEE6B280000000000ULL, 0x0000000000000000ULL,   // 5^9
+    0x9502F90000000000ULL, 0x0000000000000000ULL,   // 5^10
+    0xBA43B74000000000ULL, 0x0000000000000000ULL,   // 5^11
+    0xE8D4A51000000000ULL, 0x0000000000000000ULL,   // 5^12
+    0x9184E72A00000000ULL, 0x0000000000000000ULL,   // 5^13
+    0xB5E620F480000000ULL, 0x0000000000000000ULL,   // 5^14
+    0xE35FA931A0000000ULL, 0x0000000000000000ULL,   // 5^15
+    0x8E1BC9BF04000000ULL, 0x0000000000000000ULL,   // 5^16
+    0xB1A2BC2EC5000000ULL, 0x0000000000000000ULL,   // 5^17
+    0xDE0B6B3A76400000ULL, 0x0000000000000000ULL,   // 5^18
+    0x8AC7230489E80000ULL, 0x0000000000000000ULL,   // 5^19
+    0xAD78EBC5AC620000ULL, 0x0000000000000000ULL,   // 5^20
+    0xD8D726B7177A8000ULL, 0x0000000000000000ULL,   // 5^21
+    0x878678326EAC9000ULL, 0x0000000000000000ULL,   // 5^22
+    0xA968163F0A57B400ULL, 0x0000000000000000ULL,   // 5^23
+    0xD3C21BCECCEDA100ULL, 0x0000000000000000ULL,   // 5^24
+    0x84595161401484A0ULL, 0x0000000000000000ULL,   // 5^25
+    0xA56FA5B99019A5C8ULL, 0x0000000000000000ULL,   // 5^26
+    0xCECB8F27F4200F3AULL, 0x0000000000000000ULL,   // 5^27
+    0x813F3978F8940984ULL, 0x4000000000000000ULL,   // 5^28
+    0xA18F07D736B90BE5ULL, 0x5000000000000000ULL,   // 5^29
+    0xC9F2C9CD04674EDEULL, 0xA400000000000000ULL,   // 5^30
+    0xFC6F7C4045812296ULL, 0x4D00000000000000ULL,   // 5^31
+    0x9DC5ADA82B70B59DULL, 0xF020000000000000ULL,   // 5^32
+    0xC5371912364CE305ULL, 0x6C28000000000000ULL,   // 5^33
+    0xF684DF56C3E01BC6ULL, 0xC732000000000000ULL,   // 5^34
+    0x9A130B963A6C115CULL, 0x3C7F400000000000ULL,   // 5^35
+    0xC097CE7BC90715B3ULL, 0x4B9F100000000000ULL,   // 5^36
+    0xF0BDC21ABB48DB20ULL, 0x1E86D40000000000ULL,   // 5^37
+    0x96769950B50D88F4ULL, 0x1314448000000000ULL,   // 5^38
+    0xBC143FA4E250EB31ULL, 0x17D955A000000000ULL,   // 5^39
+    0xEB194F8E1AE525FDULL, 0x5DCFAB0800000000ULL,   // 5^40
+    0x92EFD1B8D0CF37BEULL, 0x5AA1CAE500000000ULL,   // 5^41
+    0xB7ABC627050305ADULL, 0xF14A3D9E40000000ULL,   // 5^42
+    0xE596B7B0C643C719ULL, 0x6D9CCD05D0000000ULL,   // 5^43
+    0x8F7E32CE7BEA5C6FULL, 0xE4820023A2000000ULL,   // 5^44
+    0xB35DBF821AE4F38BULL, 0xDDA2802C8A800000ULL,   // 5^45
+    0xE0352F62A19E306EULL, 0xD50B2037AD200000ULL,   // 5^46
+    0x8C213D9DA502DE45ULL, 0x4526F422CC340000ULL,   // 5^47
+    0xAF298D050E4395D6ULL, 0x9670B12B7F410000ULL,   // 5^48
+    0xDAF3F04651D47B4CULL, 0x3C0CDD765F114000ULL,   // 5^49
+    0x88D8762BF324CD0FULL, 0xA5880A69FB6AC800ULL,   // 5^50
+    0xAB0E93B6EFEE0053ULL, 0x8EEA0D047A457A00ULL,   // 5^51
+    0xD5D238A4ABE98068ULL, 0x72A4904598D6D880ULL,   // 5^52
+    0x85A36366EB71F041ULL, 0x47A6DA2B7F864750ULL,   // 5^53
+    0xA70C3C40A64E6C51ULL, 0x999090B65F67D924ULL,   // 5^54
+    0xD0CF4B50CFE20765ULL, 0xFFF4B4E3F741CF6DULL,   // 5^55
+    0x82818F1281ED449FULL, 0xBFF8F10E7A8921A4ULL,   // 5^56
+    0xA321F2D7226895C7ULL, 0xAFF72D52192B6A0DULL,   // 5^57
+    0xCBEA6F8CEB02BB39ULL, 0x9BF4F8A69F764490ULL,   // 5^58
+    0xFEE50B7025C36A08ULL, 0x02F236D04753D5B4ULL,   // 5^59
+    0x9F4F2726179A2245ULL, 0x01D762422C946590ULL,   // 5^60
+    0xC722F0EF9D80AAD6ULL, 0x424D3AD2B7B97EF5ULL,   // 5^61
+    0xF8EBAD2B84E0D58BULL, 0xD2E0898765A7DEB2ULL,   // 5^62
+    0x9B934C3B330C8577ULL, 0x63CC55F49F88EB2FULL,   // 5^63
+    0xC2781F49FFCFA6D5ULL, 0x3CBF6B71C76B25FBULL,   // 5^64
+    0xF316271C7FC3908AULL, 0x8BEF464E3945EF7AULL,   // 5^65
+    0x97EDD871CFDA3A56ULL, 0x97758BF0E3CBB5ACULL,   // 5^66
+    0xBDE94E8E43D0C8ECULL, 0x3D52EEED1CBEA317ULL,   // 5^67
+    0xED63A231D4C4FB27ULL, 0x4CA7AAA863EE4BDDULL,   // 5^68
+    0x945E455F24FB1CF8ULL, 0x8FE8CAA93E74EF6AULL,   // 5^69
+    0xB975D6B6EE39E436ULL, 0xB3E2FD538E122B44ULL,   // 5^70
+    0xE7D34C64A9C85D44ULL, 0x60DBBCA87196B616ULL,   // 5^71
+    0x90E40FBEEA1D3A4AULL, 0xBC8955E946FE31CDULL,   // 5^72
+    0xB51D13AEA4A488DDULL, 0x6BABAB6398BDBE41ULL,   // 5^73
+    0xE264589A4DCDAB14ULL, 0xC696963C7EED2DD1ULL,   // 5^74
+    0x8D7EB76070A08AECULL, 0xFC1E1DE5CF543CA2ULL,   // 5^75
+    0xB0DE65388CC8ADA8ULL, 0x3B25A55F43294BCBULL,   // 5^76
+    0xDD15FE86AFFAD912ULL, 0x49EF0EB713F39EBEULL,   // 5^77
+    0x8A2DBF142DFCC7ABULL, 0x6E3569326C784337ULL,   // 5^78
+    0xACB92ED9397BF996ULL, 0x49C2C37F07965404ULL,   // 5^79
+    0xD7E77A8F87DAF7FBULL, 0xDC33745EC97BE906ULL,   // 5^80
+    0x86F0AC99B4E8DAFDULL, 0x69A028BB3DED71A3ULL,   // 5^81
+    0xA8ACD7C0222311BCULL, 0xC40832EA0D68CE0CULL,   // 5^82
+    0xD2D80DB02AABD62BULL, 0xF50A3FA490C30190ULL,   // 5^83
+    0x83C7088E1AAB65DBULL, 0x792667C6DA79E0FAULL,   // 5^84
+    0xA4B8CAB1A1563F52ULL, 0x577001B891185938ULL,   // 5^85
+    0xCDE6FD5E09ABCF26ULL, 0xED4C0226B55E6F86ULL,   // 5^86
+    0x80B05E5AC60B6178ULL, 0x544F8158315B05B4ULL,   // 5^87
+    0xA0DC75F1778E39D6ULL, 0x696361AE3DB1C721ULL,   // 5^88
+    0xC913936DD571C84CULL, 0x03BC3A19CD1E38E9ULL,   // 5^89
+    0xFB5878494ACE3A5FULL, 0x04AB48A04065C723ULL,   // 5^90
+    0x9D174B2DCEC0E47BULL, 0x62EB0D64283F9C76ULL,   // 5^91
+    0xC45D1DF942711D9AULL, 0x3BA5D0BD324F8394ULL,   // 5^92
+    0xF5746577930D6500ULL, 0xCA8F44EC7EE36479ULL,   // 5^93
+    0x9968BF6ABBE85F20ULL, 0x7E998B13CF4E1ECBULL,   // 5^94
+    0xBFC2EF456AE276E8ULL, 0x9E3FEDD8C321A67EULL,   // 5^95
+    0xEFB3AB16C59B14A2ULL, 0xC5CFE94EF3EA101EULL,   // 5^96
+    0x95D04AEE3B80ECE5ULL, 0xBBA1F1D158724A12ULL,   // 5^97
+    0xBB445DA9CA61281FULL, 0x2A8A6E45AE8EDC97ULL,   // 5^98
+    0xEA1575143CF97226ULL, 0xF52D09D71A3293BDULL,   // 5^99
+    0x924D692CA61BE758ULL, 0x593C2626705F9C56ULL,   // 5^100
+    0xB6E0C377CFA2E12EULL, 0x6F8B2FB00C77836CULL,   // 5^101
+    0xE498F455C38B997AULL, 0x0B6DFB9C0F956447ULL,   // 5^102
+    0x8EDF98B59A373FECULL, 0x4724BD4189BD5EACULL,   // 5^103
+    0xB2977EE300C50FE7ULL, 0x58EDEC91EC2CB657ULL,   // 5^104
+    0xDF3D5E9BC0F653E1ULL, 0x2F2967B66737E3EDULL,   // 5^105
+    0x8B865B215899F46CULL, 0xBD79E0D20082EE74ULL,   // 5^106
+    0xAE67F1E9AEC07187ULL, 0xECD8590680A3AA11ULL,   // 5^107
+    0xDA01EE641A708DE9ULL, 0xE80E6F4820CC9495ULL,   // 5^108
+    0x884134FE908658B2ULL, 0x3109058D147FDCDDULL,   // 5^109
+    0xAA51823E34A7EEDEULL, 0xBD4B46F0599FD415ULL,   // 5^110
+    0xD4E5E2CDC1D1EA96ULL, 0x6C9E18AC7007C91AULL,   // 5^111
+    0x850FADC09923329EULL, 0x03E2CF6BC604DDB0ULL,   // 5^112
+    0xA6539930BF6BFF45ULL, 0x84DB8346B786151CULL,   // 5^113
+    0xCFE87F7CEF46FF16ULL, 0xE612641865679A63ULL,   // 5^114
+    0x81F14FAE158C5F6EULL, 0x4FCB7E8F3F60C07EULL,   // 5^115
+    0xA26DA3999AEF7749ULL, 0xE3BE5E330F38F09DULL,   // 5^116
+    0xCB090C8001AB551CULL, 0x5CADF5BFD3072CC5ULL,   // 5^117
+    0xFDCB4FA002162A63ULL, 0x73D9732FC7C8F7F6ULL,   // 5^118
+    0x9E9F11C4014DDA7EULL, 0x2867E7FDDCDD9AFAULL,   // 5^119
+    0xC646D63501A1511DULL, 0xB281E1FD541501B8ULL,   // 5^120
+    0xF7D88BC24209A565ULL, 0x1F225A7CA91A4226ULL,   // 5^121
+    0x9AE757596946075FULL, 0x3375788DE9B06958ULL,   // 5^122
+    0xC1A12D2FC3978937ULL, 0x0052D6B1641C83AEULL,   // 5^123
+    0xF209787BB47D6B84ULL, 0xC0678C5DBD23A49AULL,   // 5^124
+    0x9745EB4D50CE6332ULL, 0xF840B7BA963646E0ULL,   // 5^125
+    0xBD176620A501FBFFULL, 0xB650E5A93BC3D898ULL,   // 5^126
+    0xEC5D3FA8CE427AFFULL, 0xA3E51F138AB4CEBEULL,   // 5^127
+    0x93BA47C980E98CDFULL, 0xC66F336C36B10137ULL,   // 5^128
+    0xB8A8D9BBE123F017ULL, 0xB80B0047445D4184ULL,   // 5^129
+    0xE6D3102AD96CEC1DULL, 0xA60DC059157491E5ULL,   // 5^130
+    0x9043EA1AC7E41392ULL, 0x87C89837AD68DB2FULL,   // 5^131
+    0xB454E4A179DD1877ULL, 0x29BABE4598C311FBULL,   // 5^132
+    0xE16A1DC9D8545E94ULL, 0xF4296DD6FEF3D67AULL,   // 5^133
+    0x8CE2529E2734BB1DULL, 0x1899E4A65F58660CULL,   // 5^134
+    0xB01AE745B101E9E4ULL, 0x5EC05DCFF72E7F8FULL,   // 5^135
+    0xDC21A1171D42645DULL, 0x76707543F4FA1F73ULL,   // 5^136
+    0x899504AE72497EBAULL, 0x6A06494A791C53A8ULL,   // 5^137
+    0xABFA45DA0EDBDE69ULL, 0x0487DB9D17636892ULL,   // 5^138
+    0xD6F8D7509292D603ULL, 0x45A9D2845D3C42B6ULL,   // 5^139
+    0x865B86925B9BC5C2ULL, 0x0B8A2392BA45A9B2ULL,   // 5^140
+    0xA7F26836F282B732ULL, 0x8E6CAC7768D7141EULL,   // 5^141
+    0xD1EF0244AF2364FFULL, 0x3207D795430CD926ULL,   // 5^142
+    0x8335616AED761F1FULL, 0x7F44E6BD49E807B8ULL,   // 5^143
+    0xA402B9C5A8D3A6E7ULL, 0x5F16206C9C6209A6ULL,   // 5^144
+    0xCD036837130890A1ULL, 0x36DBA887C37A8C0FULL,   // 5^145
+    0x802221226BE55A64ULL, 0xC2494954DA2C9789ULL,   // 5^146
+    0xA02AA96B06DEB0FDULL, 0xF2DB9BAA10B7BD6CULL,   // 5^147
+    0xC83553C5C8965D3DULL, 0x6F92829494E5ACC7ULL,   // 5^148
+    0xFA42A8B73ABBF48CULL, 0xCB772339BA1F17F9ULL,   // 5^149
+    0x9C69A97284B578D7ULL, 0xFF2A760414536EFBULL,   // 5^150
+    0xC38413CF25E2D70DULL, 0xFEF5138519684ABAULL,   // 5^151
+    0xF46518C2EF5B8CD1ULL, 0x7EB258665FC25D69ULL,   // 5^152
+    0x98BF2F79D5993802ULL, 0xEF2F773FFBD97A61ULL,   // 5^153
+    0xBEEEFB584AFF8603ULL, 0xAAFB550FFACFD8FAULL,   // 5^154
+    0xEEAABA2E5DBF6784ULL, 0x95BA2A53F983CF38ULL,   // 5^155
+    0x952AB45CFA97A0B2ULL, 0xDD945A747BF26183ULL,   // 5^156
+    0xBA756174393D88DFULL, 0x94F971119AEEF9E4ULL,   // 5^157
+    0xE912B9D1478CEB17ULL, 0x7A37CD5601AAB85DULL,   // 5^158
+    0x91ABB422CCB812EEULL, 0xAC62E055C10AB33AULL,   // 5^159
+    0xB616A12B7FE617AAULL, 0x577B986B314D6009ULL,   // 5^160
+    0xE39C49765FDF9D94ULL, 0xED5A7E85FDA0B80BULL,   // 5^161
+    0x8E41ADE9FBEBC27DULL, 0x14588F13BE847307ULL,   // 5^162
+    0xB1D219647AE6B31CULL, 0x596EB2D8AE258FC8ULL,   // 5^163
+    0xDE469FBD99A05FE3ULL, 0x6FCA5F8ED9AEF3BBULL,   // 5^164
+    0x8AEC23D680043BEEULL, 0x25DE7BB9480D5854ULL,   // 5^165
+    0xADA72CCC20054AE9ULL, 0xAF561AA79A10AE6AULL,   // 5^166
+    0xD910F7FF28069DA4ULL, 0x1B2BA1518094DA04ULL,   // 5^167
+    0x87AA9AFF79042286ULL, 0x90FB44D2F05D0842ULL,   // 5^168
+    0xA99541BF57452B28ULL, 0x353A1607AC744A53ULL,   // 5^169
+    0xD3FA922F2D1675F2ULL, 0x42889B8997915CE8ULL,   // 5^170
+    0x847C9B5D7C2E09B7ULL, 0x69956135FEBADA11ULL,   // 5^171
+    0xA59BC234DB398C25ULL, 0x43FAB9837E699095ULL,   // 5^172
+    0xCF02B2C21207EF2EULL, 0x94F967E45E03F4BBULL,   // 5^173
+    0x8161AFB94B44F57DULL, 0x1D1BE0EEBAC278F5ULL,   // 5^174
+    0xA1BA1BA79E1632DCULL, 0x6462D92A69731732ULL,   // 5^175
+    0xCA28A291859BBF93ULL, 0x7D7B8F7503CFDCFEULL,   // 5^176
+    0xFCB2CB35E702AF78ULL, 0x5CDA735244C3D43EULL,   // 5^177
+    0x9DEFBF01B061ADABULL, 0x3A0888136AFA64A7ULL,   // 5^178
+    0xC56BAEC21C7A1916ULL, 0x088AAA1845B8FDD0ULL,   // 5^179
+    0xF6C69A72A3989F5BULL, 0x8AAD549E57273D45ULL,   // 5^180
+    0x9A3C2087A63F6399ULL, 0x36AC54E2F678864BULL,   // 5^181
+    0xC0CB28A98FCF3C7FULL, 0x84576A1BB416A7DDULL,   // 5^182
+    0xF0FDF2D3F3C30B9FULL, 0x656D44A2A11C51D5ULL,   // 5^183
+    0x969EB7C47859E743ULL, 0x9F644AE5A4B1B325ULL,   // 5^184
+    0xBC4665B596706114ULL, 0x873D5D9F0DDE1FEEULL,   // 5^185
+    0xEB57FF22FC0C7959ULL, 0xA90CB506D155A7EAULL,   // 5^186
+    0x9316FF75DD87CBD8ULL, 0x09A7F12442D588F2ULL,   // 5^187
+    0xB7DCBF5354E9BECEULL, 0x0C11ED6D538AEB2FULL,   // 5^188
+    0xE5D3EF282A242E81ULL, 0x8F1668C8A86DA5FAULL,   // 5^189
+    0x8FA475791A569D10ULL, 0xF96E017D694487BCULL,   // 5^190
+    0xB38D92D760EC4455ULL, 0x37C981DCC395A9ACULL,   // 5^191
+    0xE070F78D3927556AULL, 0x85BBE253F47B1417ULL,   // 5^192
+    0x8C469AB843B89562ULL, 0x93956D7478CCEC8EULL,   // 5^193
+    0xAF58416654A6BABBULL, 0x387AC8D1970027B2ULL,   // 5^194
+    0xDB2E51BFE9D0696AULL, 0x06997B05FCC0319EULL,   // 5^195
+    0x88FCF317F22241E2ULL, 0x441FECE3BDF81F03ULL,   // 5^196
+    0xAB3C2FDDEEAAD25AULL, 0xD527E81CAD7626C3ULL,   // 5^197
+    0xD60B3BD56A5586F1ULL, 0x8A71E223D8D3B074ULL,   // 5^198
+    0x85C7056562757456ULL, 0xF6872D5667844E49ULL,   // 5^199
+    0xA738C6BEBB12D16CULL, 0xB428F8AC016561DBULL,   // 5^200
+    0xD106F86E69D785C7ULL, 0xE13336D701BEBA52ULL,   // 5^201
+    0x82A45B450226B39CULL, 0xECC0024661173473ULL,   // 5^202
+    0xA34D721642B06084ULL, 0x27F002D7F95D0190ULL,   // 5^203
+    0xCC20CE9BD35C78A5ULL, 0x31EC038DF7B441F4ULL,   // 5^204
+    0xFF290242C83396CEULL, 0x7E67047175A15271ULL,   // 5^205
+    0x9F79A169BD203E41ULL, 0x0F0062C6E984D386ULL,   // 5^206
+    0xC75809C42C684DD1ULL, 0x52C07B78A3E60868ULL,   // 5^207
+    0xF92E0C3537826145ULL, 0xA7709A56CCDF8A82ULL,   // 5^208
+    0x9BBCC7A142B17CCBULL, 0x88A66076400BB691ULL,   // 5^209
+    0xC2ABF989935DDBFEULL, 0x6ACFF893D00EA435ULL,   // 5^210
+    0xF356F7EBF83552FEULL, 0x0583F6B8C4124D43ULL,   // 5^211
+    0x98165AF37B2153DEULL, 0xC3727A337A8B704AULL,   // 5^212
+    0xBE1BF1B059E9A8D6ULL, 0x744F18C0592E4C5CULL,   // 5^213
+    0xEDA2EE1C7064130CULL, 0x1162DEF06F79DF73ULL,   // 5^214
+    0x9485D4D1C63E8BE7ULL, 0x8ADDCB5645AC2BA8ULL,   // 5^215
+    0xB9A74A0637CE2EE1ULL, 0x6D953E2BD7173692ULL,   // 5^216
+    0xE8111C87C5C1BA99ULL, 0xC8FA8DB6CCDD0437ULL,   // 5^217
+    0x910AB1D4DB9914A0ULL, 0x1D9C9892400A22A2ULL,   // 5^218
+    0xB54D5E4A127F59C8ULL, 0x2503BEB6D00CAB4BULL,   // 5^219
+    0xE2A0B5DC971F303AULL, 0x2E44AE64840FD61DULL,   // 5^220
+    0x8DA471A9DE737E24ULL, 0x5CEAECFED289E5D2ULL,   // 5^221
+    0xB10D8E1456105DADULL, 0x7425A83E872C5F47ULL,   // 5^222
+    0xDD50F1996B947518ULL, 0xD12F124E28F77719ULL,   // 5^223
+    0x8A5296FFE33CC92FULL, 0x82BD6B70D99AAA6FULL,   // 5^224
+    0xACE73CBFDC0BFB7BULL, 0x636CC64D1001550BULL,   // 5^225
+    0xD8210BEFD30EFA5AULL, 0x3C47F7E05401AA4EULL,   // 5^226
+    0x8714A775E3E95C78ULL, 0x65ACFAEC34810A71ULL,   // 5^227
+    0xA8D9D1535CE3B396ULL, 0x7F1839A741A14D0DULL,   // 5^228
+    0xD31045A8341CA07CULL, 0x1EDE48111209A050ULL,   // 5^229
+    0x83EA2B892091E44DULL, 0x934AED0AAB460432ULL,   // 5^230
+    0xA4E4B66B68B65D60ULL, 0xF81DA84D5617853FULL,   // 5^231
+    0xCE1DE40642E3F4B9ULL, 0x36251260AB9D668EULL,   // 5^232
+    0x80D2AE83E9CE78F3ULL, 0xC1D72B7C6B426019ULL,   // 5^233
+    0xA1075A24E4421730ULL, 0xB24CF65B8612F81FULL,   // 5^234
+    0xC94930AE1D529CFCULL, 0xDEE033F26797B627ULL,   // 5^235
+    0xFB9B7CD9A4A7443CULL, 0x169840EF017DA3B1ULL,   // 5^236
+    0x9D412E0806E88AA5ULL, 0x8E1F289560EE864EULL,   // 5^237
+    0xC491798A08A2AD4EULL, 0xF1A6F2BAB92A27E2ULL,   // 5^238
+    0xF5B5D7EC8ACB58A2ULL, 0xAE10AF696774B1DBULL,   // 5^239
+    0x9991A6F3D6BF1765ULL, 0xACCA6DA1E0A8EF29ULL,   // 5^240
+    0xBFF610B0CC6EDD3FULL, 0x17FD090A58D32AF3ULL,   // 5^241
+    0xEFF394DCFF8A948EULL, 0xDDFC4B4CEF07F5B0ULL,   // 5^242
+    0x95F83D0A1FB69CD9ULL, 0x4ABDAF101564F98EULL,   // 5^243
+    0xBB764C4CA7A4440FULL, 0x9D6D1AD41ABE37F1ULL,   // 5^244
+    0xEA53DF5FD18D5513ULL, 0x84C86189216DC5EDULL,   // 5^245
+    0x92746B9BE2F8552CULL, 0x32FD3CF5B4E49BB4ULL,   // 5^246
+    0xB7118682DBB66A77ULL, 0x3FBC8C33221DC2A1ULL,   // 5^247
+    0xE4D5E82392A40515ULL, 0x0FABAF3FEAA5334AULL,   // 5^248
+    0x8F05B1163BA6832DULL, 0x29CB4D87F2A7400EULL,   // 5^249
+    0xB2C71D5BCA9023F8ULL, 0x743E20E9EF511012ULL,   // 5^250
+    0xDF78E4B2BD342CF6ULL, 0x914DA9246B255416ULL,   // 5^251
+    0x8BAB8EEFB6409C1AULL, 0x1AD089B6C2F7548EULL,   // 5^252
+    0xAE9672ABA3D0C320ULL, 0xA184AC2473B529B1ULL,   // 5^253
+    0xDA3C0F568CC4F3E8ULL, 0xC9E5D72D90A2741EULL,   // 5^254
+    0x8865899617FB1871ULL, 0x7E2FA67C7A658892ULL,   // 5^255
+    0xAA7EEBFB9DF9DE8DULL, 0xDDBB901B98FEEAB7ULL,   // 5^256
+    0xD51EA6FA85785631ULL, 0x552A74227F3EA565ULL,   // 5^257
+    0x8533285C936B35DEULL, 0xD53A88958F87275FULL,   // 5^258
+    0xA67FF273B8460356ULL, 0x8A892ABAF368F137ULL,   // 5^259
+    0xD01FEF10A657842CULL, 0x2D2B7569B0432D85ULL,   // 5^260
+    0x8213F56A67F6B29BULL, 0x9C3B29620E29FC73ULL,   // 5^261
+    0xA298F2C501F45F42ULL, 0x8349F3BA91B47B8FULL,   // 5^262
+    0xCB3F2F7642717713ULL, 0x241C70A936219A73ULL,   // 5^263
+    0xFE0EFB53D30DD4D7ULL, 0xED238CD383AA0110ULL,   // 5^264
+    0x9EC95D1463E8A506ULL, 0xF4363804324A40AAULL,   // 5^265
+    0xC67BB4597CE2CE48ULL, 0xB143C6053EDCD0D5ULL,   // 5^266
+    0xF81AA16FDC1B81DAULL, 0xDD94B7868E94050AULL,   // 5^267
+    0x9B10A4E5E9913128ULL, 0xCA7CF2B4191C8326ULL,   // 5^268
+    0xC1D4CE1F63F57D72ULL, 0xFD1C2F611F63A3F0ULL,   // 5^269
+    0xF24A01A73CF2DCCFULL, 0xBC633B39673C8CECULL,   // 5^270
+    0x976E41088617CA01ULL, 0xD5BE0503E085D813ULL,   // 5^271
+    0xBD49D14AA79DBC82ULL, 0x4B2D8644D8A74E18ULL,   // 5^272
+    0xEC9C459D51852BA2ULL, 0xDDF8E7D60ED1219EULL,   // 5^273
+    0x93E1AB8252F33B45ULL, 0xCABB90E5C942B503ULL,   // 5^274
+    0xB8DA1662E7B00A17ULL, 0x3D6A751F3B936243ULL,   // 5^275
+    0xE7109BFBA19C0C9DULL, 0x0CC512670A783AD4ULL,   // 5^276
+    0x906A617D450187E2ULL, 0x27FB2B80668B24C5ULL,   // 5^277
+    0xB484F9DC9641E9DAULL, 0xB1F9F660802DEDF6ULL,   // 5^278
+    0xE1A63853BBD26451ULL, 0x5E7873F8A0396973ULL,   // 5^279
+    0x8D07E33455637EB2ULL, 0xDB0B487B6423E1E8ULL,   // 5^280
+    0xB049DC016ABC5E5FULL, 0x91CE1A9A3D2CDA62ULL,   // 5^281
+    0xDC5C5301C56B75F7ULL, 0x7641A140CC7810FBULL,   // 5^282
+    0x89B9B3E11B6329BAULL, 0xA9E904C87FCB0A9DULL,   // 5^283
+    0xAC2820D9623BF429ULL, 0x546345FA9FBDCD44ULL,   // 5^284
+    0xD732290FBACAF133ULL, 0xA97C177947AD4095ULL,   // 5^285
+    0x867F59A9D4BED6C0ULL, 0x49ED8EABCCCC485DULL,   // 5^286
+    0xA81F301449EE8C70ULL, 0x5C68F256BFFF5A74ULL,   // 5^287
+    0xD226FC195C6A2F8CULL, 0x73832EEC6FFF3111ULL,   // 5^288
+    0x83585D8FD9C25DB7ULL, 0xC831FD53C5FF7EABULL,   // 5^289
+    0xA42E74F3D032F525ULL, 0xBA3E7CA8B77F5E55ULL,   // 5^290
+    0xCD3A1230C43FB26FULL, 0x28CE1BD2E55F35EBULL,   // 5^291
+    0x80444B5E7AA7CF85ULL, 0x7980D163CF5B81B3ULL,   // 5^292
+    0xA0555E361951C366ULL, 0xD7E105BCC332621FULL,   // 5^293
+    0xC86AB5C39FA63440ULL, 0x8DD9472BF3FEFAA7ULL,   // 5^294
+    0xFA856334878FC150ULL, 0xB14F98F6F0FEB951ULL,   // 5^295
+    0x9C935E00D4B9D8D2ULL, 0x6ED1BF9A569F33D3ULL,   // 5^296
+    0xC3B8358109E84F07ULL, 0x0A862F80EC4700C8ULL,   // 5^297
+    0xF4A642E14C6262C8ULL, 0xCD27BB612758C0FAULL,   // 5^298
+    0x98E7E9CCCFBD7DBDULL, 0x8038D51CB897789CULL,   // 5^299
+    0xBF21E44003ACDD2CULL, 0xE0470A63E6BD56C3ULL,   // 5^300
+    0xEEEA5D5004981478ULL, 0x1858CCFCE06CAC74ULL,   // 5^301
+    0x95527A5202DF0CCBULL, 0x0F37801E0C43EBC8ULL,   // 5^302
+    0xBAA718E68396CFFDULL, 0xD30560258F54E6BAULL,   // 5^303
+    0xE950DF20247C83FDULL, 0x47C6B82EF32A2069ULL,   // 5^304
+    0x91D28B7416CDD27EULL, 0x4CDC331D57FA5441ULL,   // 5^305
+    0xB6472E511C81471DULL, 0xE0133FE4ADF8E952ULL,   // 5^306
+    0xE3D8F9E563A198E5ULL, 0x58180FDDD97723A6ULL,   // 5^307
+    0x8E679C2F5E44FF8FULL, 0x570F09EAA7EA7648ULL,   // 5^308
+};
+
+// 12-1. parse the integer to the magnitude and the sign in place, the grammar is the same as json_number_parse_n
+int json_number_parseInteger_n(const char * string, const size_t length, const size_t startIndex, uint64_t * magnitude, int * negative) {
+    const char * s = string;
+    size_t i = startIndex;
+
+    // 1. sign
+    *negative = json_util_charAt(s, length, i) == '-';
+    if (*negative) {
+        i++;
+    }
 
-        // filter the blank, util find the next character
-        if (json_util_getNextCharacter(input_string, &i) != 0) {
-            goto invalid_character;
+    // 2. integer part, the leading zero is the whole integer part
+    uint64_t value = 0;
+    int overflow = 0;
+
+    if (json_util_charAt(s, length, i) == '0') {
+        i++;
+    } else if (JSON_NUMBER_IS_DIGIT(json_util_charAt(s, length, i))) {
+        const size_t integer_startIndex = i;
+
+        // 2-1. 8 digits at a time while there are at most 19 digits, it never overflows
+        uint64_t word;
+        while (i - integer_startIndex <= 11 && json_number_loadEightBytes(s, length, i, &word) == 0 && json_number_isEightDigits(word)) {
+            value = value * 100000000 + json_number_parseEightDigits(word);
+            i += 8;
         }
 
-        // 5. check the character after the VALUE
-        switch (input_string[i]) {
-            // 2-1. check right square bracket
-            case '}':
-                // it's the end of the object
-                return 0;
+        // 2-2. the rest digits, the 20th digit may overflow
+        while (JSON_NUMBER_IS_DIGIT(json_util_charAt(s, length, i))) {
+            const uint64_t digit = s[i] - '0';
+            if (i - integer_startIndex < 19) {
+                value = value * 10 + digit;
+            } else if (overflow || value > (UINT64_MAX - digit) / 10) {
+                overflow = 1;
+            } else {
+                value = value * 10 + digit;
+            }
+            i++;
+        }
+    } else {
+        return JSON_NUMBER_ERROR_NOT_NUMBER;
+    }
 
-            // 2-2. find comma behind the value
-            case ',':
-                i++;
-                break;
+    *magnitude = value;
 
-            // 2-3. is not right square bracket or comma
-            default:
-                goto invalid_character;
+    // 3. fractional or exponent part, the caller could fall back to double
+    char c = json_util_charAt(s, length, i);
+    if (c == '.' && JSON_NUMBER_IS_DIGIT(json_util_charAt(s, length, i + 1))) {
+        return JSON_NUMBER_ERROR_NOT_INTEGER;
+    }
+
+    if (c == 'e' || c == 'E') {
+        c = json_util_charAt(s, length, ++i);
+        if (c == '+' || c == '-') {
+            i++;
         }
 
-        // filter the blank, util find the next character
-        if (json_util_getNextCharacter(input_string, &i) != 0) {
-            goto invalid_character;
+        if (JSON_NUMBER_IS_DIGIT(json_util_charAt(s, length, i))) {
+            return JSON_NUMBER_ERROR_NOT_INTEGER;
         }
     }
 
-invalid_character:
-    if (DEBUG) {
-        printf("%s: invalid character at %d (%c 0x%02x)\n", __func__, i, input_string[i], input_string[i]);
-    }
-    return -1;
+    return overflow ? JSON_NUMBER_ERROR_OVERFLOW : JSON_NUMBER_ERROR_NONE;
 }
 
-// 2-2. Array Get Key Value Pair List
-int  json_array_getKeyValuePairList(const char * input_string, const int input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, int * output_keyValuePairList_size) {
-    const char DEBUG = 0;
+// 12-2. load 8 bytes as the little-endian word, the NUL-terminated string is not readable behind the terminator
+static inline int json_number_loadEightBytes(const char * string, const size_t length, const size_t index, uint64_t * word) {
 
-    // check arguments
-    if (input_string == NULL) {
-        printf("%s: input_string should not be NULL\n", __func__);
+    if (length == JSON_LENGTH_UNBOUNDED ? strnlen(string + index, 8) < 8 : (index > length || length - index < 8)) {
         return -1;
     }
 
-    if (input_string_startIndex < 0) {
-        printf("%s: input_string_startIndex (%d) should not be negative\n", __func__, input_string_startIndex);
-        return -1;
-    }
+    memcpy(word, string + index, 8);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    *word = __builtin_bswap64(*word);
+#endif
+    return 0;
+}
 
-    if (output_keyValuePairList == NULL) {
-        printf("%s: output_keyValuePairList should not be NULL\n", __func__);
-        return -1;
+// 12-3. check the 8 bytes are '0' ~ '9', the high nibble is 3 and the low nibble + 6 doesn't carry
+static inline int json_number_isEightDigits(const uint64_t word) {
+    return ((word & 0xF0F0F0F0F0F0F0F0) | (((word + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) == 0x3333333333333333;
+}
+
+// 12-4. convert the 8 digits to the integer, the adjacent digits are combined by multiplication in 3 steps
+static inline uint32_t json_number_parseEightDigits(uint64_t word) {
+    word = ((word & 0x0F0F0F0F0F0F0F0F) * (1 + (10 << 8))) >> 8;           // 2 digits in every 16 bits
+    word = ((word & 0x00FF00FF00FF00FF) * (1 + (100 << 16))) >> 16;        // 4 digits in every 32 bits
+    return (uint32_t) (((word & 0x0000FFFF0000FFFF) * (1 + (10000ULL << 32))) >> 32);
+}
+
+// 13-1. unescape the string into the buffer in one pass, the characters which don't fit in the buffer are counted only
+int json_string_unescape_n(const char * string, const size_t length, const size_t startIndex, char * buffer, const size_t buffer_size, size_t * output_length, size_t * endIndex) {
+    const char * s = string;
+    size_t i = startIndex, j = 0;
+
+    if (json_util_charAt(s, length, i) != '\"') {
+        return json_error_set(JSON_ERROR_SYNTAX, i);
     }
+    i++;
 
-    if (output_keyValuePairList_size == NULL) {
-        printf("%s: output_keyValuePairList_size should not be NULL\n", __func__);
-        return -1;
+    for (;;) {
+        // 1. copy the plain characters before the quotation mark, reverse solidus or control character
+        size_t plain_endIndex;
+        if (json_string_skipCharacters(s, length, i, &plain_endIndex) != 0) {
+            return json_error_set(JSON_ERROR_SYNTAX, i);
+        }
+        json_string_write(buffer, buffer_size, &j, s + i, plain_endIndex - i);
+        i = plain_endIndex;
+
+        const char c = json_util_charAt(s, length, i);
+        if (c == '\"') {
+            *output_length = j;
+            *endIndex = i;
+            return 0;
+        }
+
+        // the control character or the end of string
+        if (c != '\\') {
+            return json_error_set(JSON_ERROR_SYNTAX, i);
+        }
+
+        // 2. the escape sequence
+        char character;
+        switch (json_util_charAt(s, length, i + 1)) {
+            case '\"': character = '\"'; break;
+            case '\\': character = '\\'; break;
+            case '/':  character = '/';  break;
+            case 'b':  character = '\b'; break;
+            case 'f':  character = '\f'; break;
+            case 'n':  character = '\n'; break;
+            case 'r':  character = '\r'; break;
+            case 't':  character = '\t'; break;
+
+            // Unicode, the surrogate pair is combined and the lone surrogate is replaced by U+FFFD
+            case 'u': {
+                uint32_t code, low;
+                if (json_string_parseHex(s, length, i + 2, &code) != 0) {
+                    return json_error_set(JSON_ERROR_SYNTAX, i);
+                }
+                i += 6;
+
+                if (code >= 0xD800 && code <= 0xDBFF) {
+                    if (json_util_charAt(s, length, i) == '\\' && json_util_charAt(s, length, i + 1) == 'u' &&
+                        json_string_parseHex(s, length, i + 2, &low) == 0 && low >= 0xDC00 && low <= 0xDFFF) {
+                        code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                        i += 6;
+                    } else {
+                        code = 0xFFFD;
+                    }
+                } else if (code >= 0xDC00 && code <= 0xDFFF) {
+                    code = 0xFFFD;
+                }
+
+                char utf8[4];
+                json_string_write(buffer, buffer_size, &j, utf8, json_string_encodeUTF8(code, utf8));
+                continue;
+            }
+
+            default:
+                return json_error_set(JSON_ERROR_SYNTAX, i);
+        }
+
+        json_string_write(buffer, buffer_size, &j, &character, 1);
+        i += 2;
     }
+}
 
-    int i = input_string_startIndex;
+// 13-2. skip the plain characters, 32 or 16 characters are checked at a time
+//       the non-ASCII character stops the skip if it should be validated
+static inline size_t json_string_skipPlain(const char * string, const size_t length, size_t index) {
+#if defined(__AVX2__)
+    {
+        const __m256i quote     = _mm256_set1_epi8('\"');
+        const __m256i backslash = _mm256_set1_epi8('\\');
+        const __m256i control   = _mm256_set1_epi8(0x1F);
+        const __m256i del       = _mm256_set1_epi8(0x7F);
+
+        // the NUL-terminated string is not readable behind the terminator
+        while (length == JSON_LENGTH_UNBOUNDED ? strnlen(string + index, 32) == 32 : (index <= length && length - index >= 32)) {
+            const __m256i v = _mm256_loadu_si256((const __m256i *) (string + index));
+
+            // the character is a control character if min(c, 0x1F) is c
+            const __m256i special = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, quote), _mm256_cmpeq_epi8(v, backslash)),
+                                                    _mm256_or_si256(_mm256_cmpeq_epi8(_mm256_min_epu8(v, control), v), _mm256_cmpeq_epi8(v, del)));
+            uint32_t mask = (uint32_t) _mm256_movemask_epi8(special);
+#if JSON_VALIDATE_UTF8
+            mask |= (uint32_t) _mm256_movemask_epi8(v);
+#endif
+            if (mask != 0) {
+                return index + __builtin_ctz(mask);
+            }
+            index += 32;
+        }
+    }
+#endif
+
+#if defined(__SSE2__)
+    {
+        const __m128i quote     = _mm_set1_epi8('\"');
+        const __m128i backslash = _mm_set1_epi8('\\');
+        const __m128i control   = _mm_set1_epi8(0x1F);
+        const __m128i del       = _mm_set1_epi8(0x7F);
+
+        while (length == JSON_LENGTH_UNBOUNDED ? strnlen(string + index, 16) == 16 : (index <= length && length - index >= 16)) {
+            const __m128i v = _mm_loadu_si128((const __m128i *) (string + index));
+
+            const __m128i special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, backslash)),
+                                                 _mm_or_si128(_mm_cmpeq_epi8(_mm_min_epu8(v, control), v), _mm_cmpeq_epi8(v, del)));
+            int mask = _mm_movemask_epi8(special);
+#if JSON_VALIDATE_UTF8
+            mask |= _mm_movemask_epi8(v);
+#endif
+            if (mask != 0) {
+                return index + __builtin_ctz(mask);
+            }
+            index += 16;
+        }
+    }
+#endif
 
-    *output_keyValuePairList = NULL;
-    *output_keyValuePairList_size = 0;
+    for (;;) {
+        const unsigned char c = (unsigned char) json_util_charAt(string, length, index);
+        if (c == '\"' || c == '\\' || c < 0x20 || c == 0x7F || (JSON_VALIDATE_UTF8 && c >= 0x80)) {
+            return index;
+        }
+        index++;
+    }
+}
 
-    // check the first character
-    if (input_string[i] != '[') {
-        if (DEBUG) {
-            printf("%s: invalid character at %d (%c, 0x%02x), it should be left square bracket\n", __func__, i, input_string[i], input_string[i]);
+// 13-3. parse 4 hexadecimal digits behind \u
+static inline int json_string_parseHex(const char * string, const size_t length, const size_t index, uint32_t * code) {
+    uint32_t value = 0;
+
+    int k;
+    for (k = 0; k < 4; k++) {
+        const char c = json_util_charAt(string, length, index + k);
+        if (c >= '0' && c <= '9') {
+            value = (value << 4) | (uint32_t) (c - '0');
+        } else if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f') {
+            value = (value << 4) | (uint32_t) ((c | 0x20) - 'a' + 10);
+        } else {
+            return -1;
         }
-        return -1;
     }
-    i++;
 
-    // filter the blank, util find the next character
-    if (json_util_getNextCharacter(input_string, &i) != 0) {
-        goto invalid_character;
+    *code = value;
+    return 0;
+}
+
+// 13-4. encode the code point to UTF-8, return the count of bytes
+static inline size_t json_string_encodeUTF8(const uint32_t code, char * utf8) {
+    if (code < 0x80) {
+        utf8[0] = (char) code;
+        return 1;
     }
 
-    // check right square bracket
-    if (input_string[i] == ']') {
-        return 0;
+    if (code < 0x800) {
+        utf8[0] = (char) (0xC0 | (code >> 6));
+        utf8[1] = (char) (0x80 | (code & 0x3F));
+        return 2;
     }
 
-    JSON_Key_Value_Pair * last = *output_keyValuePairList;
+    if (code < 0x10000) {
+        utf8[0] = (char) (0xE0 | (code >> 12));
+        utf8[1] = (char) (0x80 | ((code >> 6) & 0x3F));
+        utf8[2] = (char) (0x80 | (code & 0x3F));
+        return 3;
+    }
+
+    utf8[0] = (char) (0xF0 | (code >> 18));
+    utf8[1] = (char) (0x80 | ((code >> 12) & 0x3F));
+    utf8[2] = (char) (0x80 | ((code >> 6) & 0x3F));
+    utf8[3] = (char) (0x80 | (code & 0x3F));
+    return 4;
+}
+
+// 13-5. write the characters into the buffer if they fit, the index is moved anyway
+static inline void json_string_write(char * buffer, const size_t buffer_size, size_t * index, const char * source, const size_t size) {
+    if (buffer != NULL && *index + size <= buffer_size) {
+        memcpy(buffer + *index, source, size);
+    }
+    *index += size;
+}
+
+// 13-6. skip the plain characters and the valid UTF-8 sequences, stop at the quotation mark, reverse solidus or control character
+static inline int json_string_skipCharacters(const char * string, const size_t length, const size_t index, size_t * output_index) {
+    size_t i = index;
+
     for (;;) {
-        // 1-1. check the value
-        int endIndex, jsonType;
-        if (json_getValue(input_string, i, &endIndex, &jsonType) != 0) {
-            if (DEBUG) {
-                printf("%s: invalid JSON Value at %d (%c)\n", __func__, i, input_string[i]);
+        i = json_string_skipPlain(string, length, i);
+
+#if JSON_VALIDATE_UTF8
+        if ((unsigned char) json_util_charAt(string, length, i) >= 0x80) {
+            size_t size;
+            if (json_string_validateUTF8(string, length, i, &size) != 0) {
+                *output_index = i;
+                return -1;
             }
-            return -1;
+            i += size;
+            continue;
         }
+#endif
 
-        // 2. create JSON_Key_Value_Pair
-        JSON_Key_Value_Pair * pair = malloc(sizeof(JSON_Key_Value_Pair));
-        if (pair == NULL) {
-            printf("%s: out of memory\n", __func__);
-            json_keyValuePair_free(*output_keyValuePairList);
-            return -1;
-        }
+        *output_index = i;
+        return 0;
+    }
+}
 
-        // key & key_type
-        pair->key_type = JSON_TYPE_NUMBER;
-        if (json_util_allocStringByInteger(*output_keyValuePairList_size, &(pair->key)) != 0) {
-            json_keyValuePair_free(*output_keyValuePairList);
-            return -1;
+// 13-7. validate the UTF-8 sequence at index, the overlong encoding, surrogate and code point above U+10FFFF are invalid
+static inline int json_string_validateUTF8(const char * string, const size_t length, const size_t index, size_t * output_size) {
+    const unsigned char c0 = (unsigned char) json_util_charAt(string, length, index);
+    const unsigned char c1 = (unsigned char) json_util_charAt(string, length, index + 1);
+
+    // the range of the second byte depends on the first byte
+    unsigned char c1_min = 0x80, c1_max = 0xBF;
+    size_t size;
+
+    if (c0 >= 0xC2 && c0 <= 0xDF) {
+        size = 2;
+    } else if (c0 >= 0xE0 && c0 <= 0xEF) {
+        size = 3;
+        if (c0 == 0xE0) {
+            c1_min = 0xA0;
+        }
+        if (c0 == 0xED) {
+            c1_max = 0x9F;
         }
+    } else if (c0 >= 0xF0 && c0 <= 0xF4) {
+        size = 4;
+        if (c0 == 0xF0) {
+            c1_min = 0x90;
+        }
+        if (c0 == 0xF4) {
+            c1_max = 0x8F;
+        }
+    } else {
+        return -1;
+    }
 
-        // value & value_type
-        pair->value_type = jsonType;
-        if (json_util_allocSubstring(input_string, i, endIndex, &(pair->value)) != 0) {
-            json_keyValuePair_free(*output_keyValuePairList);
+    if (c1 < c1_min || c1 > c1_max) {
+        return -1;
+    }
+
+    size_t k;
+    for (k = 2; k < size; k++) {
+        if (((unsigned char) json_util_charAt(string, length, index + k) & 0xC0) != 0x80) {
             return -1;
         }
+    }
 
-        // next pointer
-        pair->next = NULL;
+    *output_size = size;
+    return 0;
+}
 
-        // 3. add to output_keyValuePairList
-        if (last == NULL) {
-            *output_keyValuePairList = pair;
-            last = pair;
-        } else {
-            last->next = pair;
-            last = pair;
-        }
+// 14-1. record the failure of the calling thread, return -1
+JSON_COLD int json_error_set(const int code, const size_t offset) {
+    json_error_last.code   = code;
+    json_error_last.offset = offset;
+    return -1;
+}
 
-        (*output_keyValuePairList_size)++;
+// 14-2. get value with end index and JSON type, the first character decides the type, the arguments are not checked
+static inline JSON_HOT int json_value_scan(const char * string, const size_t length, const size_t startIndex, size_t * endIndex, int * jsonType) {
+    int type;
+    int result;
+    switch (json_util_charAt(string, length, startIndex)) {
+        // 1. String
+        case '\"':
+            type = JSON_TYPE_STRING;
+            result = json_string_scan(string, length, startIndex, endIndex);
+            break;
 
-        // 4. move to the index behind the value
-        i = endIndex + 1;
+        // 2. Number
+        case '-':
+        case '0': case '1': case '2': case '3': case '4':
+        case '5': case '6': case '7': case '8': case '9':
+            type = JSON_TYPE_NUMBER;
+            result = json_number_scan(string, length, startIndex, endIndex);
+            break;
 
-        // filter the blank, util find the next character
-        if (json_util_getNextCharacter(input_string, &i) != 0) {
-            goto invalid_character;
-        }
+        // 3. Boolean
+        case 't':
+        case 'f':
+            type = JSON_TYPE_BOOLEAN;
+            result = json_boolean_scan(string, length, startIndex, endIndex);
+            break;
 
-        // 5. check the character after the VALUE
-        switch (input_string[i]) {
-            // 2-1. check right square bracket
-            case ']':
-                // it's the end of the array
-                return 0;
+        // 4. Null
+        case 'n':
+            type = JSON_TYPE_NULL;
+            result = json_null_scan(string, length, startIndex, endIndex);
+            break;
 
-            // 2-2. find comma behind the value
-            case ',':
-                i++;
-                break;
+        // 5. Shallow Object: only find the left and right curly bracket
+        case '{':
+            type = JSON_TYPE_OBJECT;
+            result = json_simd_skipContainer(string, length, startIndex, '{', '}', endIndex);
+            break;
 
-            // 2-3. is not right square bracket or comma
-            default:
-                goto invalid_character;
-        }
+        // 6. Shallow Array: only find the left and right square bracket
+        case '[':
+            type = JSON_TYPE_ARRAY;
+            result = json_simd_skipContainer(string, length, startIndex, '[', ']', endIndex);
+            break;
 
-        // filter the blank, util find the next character
-        if (json_util_getNextCharacter(input_string, &i) != 0) {
-            goto invalid_character;
-        }
+        default:
+            result = -1;
+            break;
     }
 
-invalid_character:
-    if (DEBUG) {
-        printf("%s: invalid character at %d (%c 0x%02x)\n", __func__, i, input_string[i], input_string[i]);
+    if (result == 0) {
+        *jsonType = type;
+        return 0;
     }
+
+    // get value failure
+    *jsonType = -1;
+    *endIndex = JSON_INDEX_NONE;
     return -1;
 }
 
-// 2-3. Get Key Value Pair
-int json_getKeyValuePair(const char * input_string, const int input_string_startIndex, int * output_key_startIndex, int * output_key_endIndex, int * output_value_startIndex, int * output_value_endIndex, int * output_value_jsonType) {
-    // check arguments
-    if (input_string == NULL) {
-        printf("%s: input_string should not be NULL\n", __func__);
+// 14-3. get the number with end index, the arguments are not checked
+static inline JSON_HOT int json_number_scan(const char * string, const size_t length, const size_t startIndex, size_t * endIndex) {
+    const char * s = string;
+    size_t i = startIndex;
+
+    // 1. minus sign
+    if (json_util_charAt(s, length, i) == '-') {
+        i++;
+    }
+
+    // 2. integer part, the leading zero is the whole integer part
+    if (json_util_charAt(s, length, i) == '0') {
+        i++;
+    } else if (JSON_NUMBER_IS_DIGIT(json_util_charAt(s, length, i))) {
+        do {
+            i++;
+        } while (JSON_NUMBER_IS_DIGIT(json_util_charAt(s, length, i)));
+    } else {
         return -1;
     }
 
-    if (input_string_startIndex < 0) {
-        printf("%s: input_string_startIndex (%d) should not be negative\n", __func__, input_string_startIndex);
+    // 3. fractional part, the '.' without digit behind it is not a part of the number
+    if (json_util_charAt(s, length, i) == '.' && JSON_NUMBER_IS_DIGIT(json_util_charAt(s, length, i + 1))) {
+        i += 2;
+        while (JSON_NUMBER_IS_DIGIT(json_util_charAt(s, length, i))) {
+            i++;
+        }
+    }
+
+    // 4. exponent part, the 'e' without digit behind it is not a part of the number
+    char c = json_util_charAt(s, length, i);
+    if (c == 'e' || c == 'E') {
+        size_t j = i + 1;
+
+        c = json_util_charAt(s, length, j);
+        if (c == '+' || c == '-') {
+            j++;
+        }
+
+        if (JSON_NUMBER_IS_DIGIT(json_util_charAt(s, length, j))) {
+            do {
+                j++;
+            } while (JSON_NUMBER_IS_DIGIT(json_util_charAt(s, length, j)));
+            i = j;
+        }
+    }
+
+    *endIndex = i - 1;
+    return 0;
+}
+
+// 14-4. get the string with end index, the arguments are not checked
+static inline JSON_HOT int json_string_scan(const char * string, const size_t length, const size_t startIndex, size_t * endIndex) {
+    const char * s = string;
+    size_t i = startIndex;
+
+    if (json_util_charAt(s, length, i) != '\"') {
         return -1;
     }
+    i++;
+
+    for (;;) {
+        // 1. skip the plain characters by blocks, the UTF-8 sequences are validated on the way
+        if (json_string_skipCharacters(s, length, i, &i) != 0) {
+            return -1;
+        }
+
+        // 2. quotation mark
+        if (json_util_charAt(s, length, i) == '\"') {
+            *endIndex = i;
+            return 0;
+        }
+
+        // 3. control character or the end of string
+        if (json_util_charAt(s, length, i) != '\\') {
+            return -1;
+        }
+
+        // 4. the characters behind the reverse solidus
+        i++;
+        switch (json_util_charAt(s, length, i)) {
+            case '\"':  // quotation mark
+            case '\\':  // reverse solidus
+            case '/':   // solidus
+            case 'b':   // backspace
+            case 'f':   // form feed
+            case 'n':   // line feed
+            case 'r':   // carriage return
+            case 't':   // character tabulation
+                break;
+
+            // Unicode, 4 hexadecimal digits behind \u
+            case 'u': {
+                uint32_t code;
+                if (json_string_parseHex(s, length, i + 1, &code) != 0) {
+                    return -1;
+                }
+                i += 4;
+                break;
+            }
+
+            default:
+                return -1;
+        }
+        i++;
+    }
+}
+
+// 14-5. get the boolean with end index, the arguments are not checked
+static inline JSON_HOT int json_boolean_scan(const char * string, const size_t length, const size_t startIndex, size_t * endIndex) {
+    // check the first character, then compare the other characters as a word
+    switch (json_util_charAt(string, length, startIndex)) {
+        case 't':
+            if (json_util_matchWord(string, length, startIndex, "true")) {
+                *endIndex = startIndex + 3;
+                return 0;
+            }
+            return -1;
+
+        case 'f':
+            if (json_util_matchWord(string, length, startIndex + 1, "alse")) {
+                *endIndex = startIndex + 4;
+                return 0;
+            }
+            return -1;
+
+        default:
+            return -1;
+    }
+}
 
-    if (output_key_startIndex == NULL) {
-        printf("%s: output_key_startIndex should not be NULL\n", __func__);
+// 14-6. get the null with end index, the arguments are not checked
+static inline JSON_HOT int json_null_scan(const char * string, const size_t length, const size_t startIndex, size_t * endIndex) {
+    if (!json_util_matchWord(string, length, startIndex, "null")) {
         return -1;
     }
 
-    if (output_key_endIndex == NULL) {
-        printf("%s: output_key_endIndex should not be NULL\n", __func__);
-        return -1;
-    }
+    *endIndex = startIndex + 3;
+    return 0;
+}
 
-    if (output_value_startIndex == NULL) {
-        printf("%s: output_value_startIndex should not be NULL\n", __func__);
-        return -1;
-    }
+// 14-7. get the key value pair, the whitespace before the key and around the colon is skipped, the arguments are not checked
+// the index is moved behind the value, or to the invalid character on failure
+static inline JSON_HOT int json_keyValuePair_scan(const char * string, const size_t length, size_t * index, size_t * key_startIndex, size_t * key_endIndex, size_t * value_startIndex, size_t * value_endIndex, int * value_jsonType) {
+    size_t i = *index;
 
-    if (output_value_endIndex == NULL) {
-        printf("%s: output_value_endIndex should not be NULL\n", __func__);
-        return -1;
+    // 1. key
+    json_util_skipWhitespace(string, length, &i);
+    if (json_string_scan(string, length, i, key_endIndex) != 0) {
+        goto failure;
     }
+    *key_startIndex = i;
+    i = *key_endIndex + 1;
 
-    if (output_value_jsonType == NULL) {
-        printf("%s: output_value_jsonType should not be NULL\n", __func__);
-        return -1;
+    // 2. colon
+    if (json_util_skipWhitespace(string, length, &i) != ':') {
+        goto failure;
     }
+    i++;
 
-    // set output parameters to default -1
-    *output_key_startIndex   = -1;
-    *output_key_endIndex     = -1;
-    *output_value_startIndex = -1;
-    *output_value_endIndex   = -1;
-    *output_value_jsonType   = -1;
+    // 3. value
+    json_util_skipWhitespace(string, length, &i);
+    if (json_value_scan(string, length, i, value_endIndex, value_jsonType) != 0) {
+        goto failure;
+    }
+    *value_startIndex = i;
 
-    int i = input_string_startIndex;
+    *index = *value_endIndex + 1;
+    return 0;
 
-    // filter the blank, util find the next character
-    if (json_util_getNextCharacter(input_string, &i) != 0) {
-        return -1;
-    }
+failure:
+    *key_startIndex   = JSON_INDEX_NONE;
+    *key_endIndex     = JSON_INDEX_NONE;
+    *value_startIndex = JSON_INDEX_NONE;
+    *value_endIndex   = JSON_INDEX_NONE;
+    *value_jsonType   = -1;
 
-    // 1. get key success
-    int key_startIndex = i;
-    int key_endIndex;
-    if (json_getString(input_string, key_startIndex, &key_endIndex) != 0) {
-        return -1;
-    }
+    *index = i;
+    return -1;
+}
 
-    // move to the index behind the key
-    i = key_endIndex + 1;
 
-    // filter the blank, util find the next character
-    if (json_util_getNextCharacter(input_string, &i) != 0) {
-        return -1;
+// 15-1. grow the buffer to hold the size and a NUL terminator
+int json_feed_reserve(char ** buffer, size_t * capacity, const size_t size) {
+    if (size < *capacity) {
+        return 0;
     }
 
-    // 2. find the colon
-    if (input_string[i] != ':') {
-        printf("%s: the character at %d (%c 0x%02x) should be colon (:)\n", __func__, i, input_string[i], input_string[i]);
-        return -1;
+    size_t new_capacity = *capacity == 0 ? 64 : *capacity;
+    while (new_capacity <= size) {
+        new_capacity *= 2;
     }
-    i++;
 
-    // filter the blank, util find the next character
-    if (json_util_getNextCharacter(input_string, &i) != 0) {
-        return -1;
+    char * new_buffer = realloc(*buffer, new_capacity);
+    if (new_buffer == NULL) {
+        JSON_LOG("%s: out of memory\n", __func__);
+        return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
     }
 
-    // 3. get value
-    int value_startIndex = i;
-    int value_endIndex;
-    int value_jsonType;
-    if (json_getValue(input_string, value_startIndex, &value_endIndex, &value_jsonType) != 0) {
+    *buffer = new_buffer;
+    *capacity = new_capacity;
+    return 0;
+}
+
+// 15-2. append the characters to the path
+int json_feed_appendPath(JSON_Feed * feed, const char * string, const size_t length) {
+    if (json_feed_reserve(&feed->path, &feed->path_capacity, feed->path_size + length) != 0) {
         return -1;
     }
 
-    *output_key_startIndex   = key_startIndex;
-    *output_key_endIndex     = key_endIndex;
-    *output_value_startIndex = value_startIndex;
-    *output_value_endIndex   = value_endIndex;
-    *output_value_jsonType   = value_jsonType;
+    memcpy(feed->path + feed->path_size, string, length);
+    feed->path_size += length;
+    feed->path[feed->path_size] = '\0';
     return 0;
 }
 
-// 2-4. Get Key
-int json_getKey(const char * input_string, const int input_string_startIndex, int * output_key_startIndex, int * output_key_endIndex, int * output_key_jsonType) {
-    const char DEBUG = 0;
-
-    // check arguments
-    if (input_string == NULL) {
-        printf("%s: input_string should not be NULL\n", __func__);
-        return -1;
+// 15-3. append the position of the array element to the path, the key of the object value is appended with the key
+int json_feed_beginValue(JSON_Feed * feed) {
+    if (feed->depth == 0 || feed->frames[feed->depth - 1].jsonType != JSON_TYPE_ARRAY) {
+        return 0;
     }
 
-    if (input_string_startIndex < 0) {
-        printf("%s: input_string_startIndex (%d) should not be negative\n", __func__, input_string_startIndex);
-        return -1;
-    }
+    char position[32];
+    const int size = snprintf(position, sizeof(position), "[%zu]", feed->frames[feed->depth - 1].position);
+    return json_feed_appendPath(feed, position, (size_t) size);
+}
 
-    if (output_key_startIndex == NULL) {
-        printf("%s: output_key_startIndex should not be NULL\n", __func__);
-        return -1;
+// 15-4. restore the path of the innermost object or array behind the value
+int json_feed_endValue(JSON_Feed * feed) {
+    if (feed->depth == 0) {
+        feed->path_size = 0;
+        feed->path[0] = '\0';
+        feed->state = JSON_FEED_STATE_DONE;
+        return 0;
     }
 
-    if (output_key_endIndex == NULL) {
-        printf("%s: output_key_endIndex should not be NULL\n", __func__);
-        return -1;
+    JSON_Feed_Frame * frame = &feed->frames[feed->depth - 1];
+    if (frame->jsonType == JSON_TYPE_ARRAY) {
+        frame->position++;
     }
 
-    *output_key_startIndex = -1;
-    *output_key_endIndex   = -1;
-    *output_key_jsonType   = -1;
+    feed->path_size = frame->path_size;
+    feed->path[feed->path_size] = '\0';
+    feed->state = JSON_FEED_STATE_SEPARATOR;
+    return 0;
+}
 
-    int endIndex;
-    if (json_getArrayInShallow(input_string, input_string_startIndex, &endIndex) != 0) {
+// 15-5. open the object or array at the left bracket, return 1 if the callback stops the parsing
+int json_feed_openFrame(JSON_Feed * feed, const int jsonType, const char * bracket) {
+    if (json_feed_beginValue(feed) != 0) {
+        feed->state = JSON_FEED_STATE_ERROR;
         return -1;
     }
 
-    int key_startIndex = input_string_startIndex + 1;
-    int key_endIndex   = endIndex - 1;
-
-    // check the key length
-    if (key_endIndex < key_startIndex) {
-        if (DEBUG) {
-            printf("%s: the key is empty\n", __func__);
+    if (feed->depth == feed->frames_capacity) {
+        size_t capacity = feed->frames_capacity == 0 ? 16 : feed->frames_capacity * 2;
+        JSON_Feed_Frame * frames = realloc(feed->frames, capacity * sizeof(JSON_Feed_Frame));
+        if (frames == NULL) {
+            JSON_LOG("%s: out of memory\n", __func__);
+            feed->state = JSON_FEED_STATE_ERROR;
+            return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
         }
-        return -1;
+        feed->frames = frames;
+        feed->frames_capacity = capacity;
     }
 
-    // 1. string key
-    if (json_getString(input_string, input_string_startIndex + 1, &endIndex) == 0 && key_endIndex == endIndex) {
-        *output_key_startIndex = key_startIndex;
-        *output_key_endIndex   = key_endIndex;
-        *output_key_jsonType   = JSON_TYPE_STRING;
+    JSON_Feed_Frame * frame = &feed->frames[feed->depth++];
+    frame->jsonType  = jsonType;
+    frame->path_size = feed->path_size;
+    frame->position  = 0;
 
-        if (DEBUG) {
-            printf("%s: ", __func__);
-            json_util_printSubstring(input_string, *output_key_startIndex, *output_key_endIndex);
-            printf(" (%s)\n", json_type_toString(*output_key_jsonType));
-        }
-        return 0;
-    }
+    feed->state = jsonType == JSON_TYPE_OBJECT ? JSON_FEED_STATE_FIRST_KEY : JSON_FEED_STATE_FIRST_VALUE;
 
-    // 2. number key
-    int i;
-    for (i = key_startIndex; i <= key_endIndex; i++) {
-        if (!isdigit(input_string[i])) {
-            return -1;
-        }
+    if (feed->callback != NULL && feed->callback(feed->user_data, JSON_FEED_EVENT_START, jsonType, feed->path, feed->path_size, bracket, 1) != 0) {
+        feed->state = JSON_FEED_STATE_STOPPED;
+        return 1;
     }
+    return 0;
+}
 
-    *output_key_startIndex = key_startIndex;
-    *output_key_endIndex   = key_endIndex;
-    *output_key_jsonType   = JSON_TYPE_NUMBER;
+// 15-6. close the innermost object or array at the right bracket, return 1 if the callback stops the parsing
+int json_feed_closeFrame(JSON_Feed * feed, const char * bracket) {
+    const int jsonType = feed->frames[--feed->depth].jsonType;
 
-    if (DEBUG) {
-        printf("%s: ", __func__);
-        json_util_printSubstring(input_string, *output_key_startIndex, *output_key_endIndex);
-        printf(" (%s)\n", json_type_toString(*output_key_jsonType));
+    if (feed->callback != NULL && feed->callback(feed->user_data, JSON_FEED_EVENT_END, jsonType, feed->path, feed->path_size, bracket, 1) != 0) {
+        feed->state = JSON_FEED_STATE_STOPPED;
+        return 1;
     }
-    return 0;
+
+    return json_feed_endValue(feed);
 }
 
+// 15-7. validate the complete token and report it, the head of the token is in the buffer if it's split by the chunk boundary
+int json_feed_finishToken(JSON_Feed * feed, const char * chunk, const size_t startIndex, const size_t endIndex) {
+    // the chunk is NULL when the stream is ended
+    const char * token = chunk != NULL ? chunk + startIndex : NULL;
+    size_t length = endIndex - startIndex;
 
-// 3. Get Value with start & end index and JSON type
-int json_getValue(const char * input_string, const int input_string_startIndex, int * output_endIndex, int * output_jsonType) {
-    // check input arguments
-    if (input_string == NULL) {
-        printf("%s: input_string should not be NULL\n", __func__);
-        return -1;
-    }
+    if (feed->buffer_size > 0) {
+        if (json_feed_reserve(&feed->buffer, &feed->buffer_capacity, feed->buffer_size + length) != 0) {
+            feed->state = JSON_FEED_STATE_ERROR;
+            return -1;
+        }
+        if (length > 0) {
+            memcpy(feed->buffer + feed->buffer_size, token, length);
+        }
+        token = feed->buffer;
+        length += feed->buffer_size;
+    }
+
+    // 1. the scanned token should be exactly one value
+    int jsonType;
+    size_t tokenEndIndex = JSON_INDEX_NONE;
+    switch (feed->token) {
+        case JSON_FEED_TOKEN_STRING:
+        case JSON_FEED_TOKEN_KEY:
+            jsonType = JSON_TYPE_STRING;
+            if (json_string_scan(token, length, 0, &tokenEndIndex) != 0) {
+                tokenEndIndex = JSON_INDEX_NONE;
+            }
+            break;
 
-    if (input_string_startIndex < 0) {
-        printf("%s: input_string_startIndex (%d) should not be negative\n", __func__, input_string_startIndex);
-        return -1;
-    }
+        case JSON_FEED_TOKEN_NUMBER:
+            jsonType = JSON_TYPE_NUMBER;
+            if (json_number_scan(token, length, 0, &tokenEndIndex) != 0) {
+                tokenEndIndex = JSON_INDEX_NONE;
+            }
+            break;
 
-    if (output_endIndex == NULL) {
-        printf("%s: output_endIndex should not be NULL\n", __func__);
-        return -1;
+        default:
+            jsonType = token[0] == 'n' ? JSON_TYPE_NULL : JSON_TYPE_BOOLEAN;
+            if ((length == 4 && (memcmp(token, "true", 4) == 0 || memcmp(token, "null", 4) == 0)) || (length == 5 && memcmp(token, "false", 5) == 0)) {
+                tokenEndIndex = length - 1;
+            }
+            break;
     }
 
-    if (output_jsonType == NULL) {
-        printf("%s: output_jsonType should not be NULL\n", __func__);
-        return -1;
+    if (tokenEndIndex != length - 1) {
+        JSON_LOG("%s: invalid %s at %zu\n", __func__, json_type_toString(jsonType), feed->token_offset);
+        feed->state = JSON_FEED_STATE_ERROR;
+        return json_error_set(JSON_ERROR_SYNTAX, feed->token_offset);
     }
 
+    const int tokenType = feed->token;
+    feed->token = JSON_FEED_TOKEN_NONE;
+    feed->buffer_size = 0;
 
-    // 1. String
-    if (json_getString(input_string, input_string_startIndex, output_endIndex) == 0) {
-        *output_jsonType = JSON_TYPE_STRING;
+    // 2. the key is a part of the path of the value behind it
+    if (tokenType == JSON_FEED_TOKEN_KEY) {
+        if (json_feed_appendPath(feed, "[", 1) != 0 || json_feed_appendPath(feed, token, length) != 0 || json_feed_appendPath(feed, "]", 1) != 0) {
+            feed->state = JSON_FEED_STATE_ERROR;
+            return -1;
+        }
+        feed->state = JSON_FEED_STATE_COLON;
         return 0;
     }
 
-    // 2. Number
-    if (json_getNumber(input_string, input_string_startIndex, output_endIndex) == 0) {
-        *output_jsonType = JSON_TYPE_NUMBER;
-        return 0;
+    // 3. report the value
+    if (feed->callback != NULL && feed->callback(feed->user_data, JSON_FEED_EVENT_VALUE, jsonType, feed->path, feed->path_size, token, length) != 0) {
+        feed->state = JSON_FEED_STATE_STOPPED;
+        return 1;
     }
 
-    // 3. Boolean
-    if (json_getBoolean(input_string, input_string_startIndex, output_endIndex) == 0) {
-        *output_jsonType = JSON_TYPE_BOOLEAN;
-        return 0;
-    }
+    return json_feed_endValue(feed);
+}
 
-    // 4. Null
-    if (json_getNull(input_string, input_string_startIndex, output_endIndex) == 0) {
-        *output_jsonType = JSON_TYPE_NULL;
-        return 0;
-    }
+// 15-8. scan the token in the chunk, return the index behind the token or JSON_INDEX_NONE if the token continues in the next chunk
+//       the token is only delimited here, it's validated by json_feed_finishToken
+static inline size_t json_feed_scanToken(JSON_Feed * feed, const char * chunk, const size_t length, size_t index) {
+    const char * s = chunk;
+    size_t i = index;
+
+    switch (feed->token) {
+        // 1. the string is ended by the quotation mark which is not escaped
+        case JSON_FEED_TOKEN_STRING:
+        case JSON_FEED_TOKEN_KEY:
+            if (feed->escape) {
+                feed->escape = 0;
+                i++;
+            }
 
-    // 5. Shallow Object: only find the left and right curly bracket
-    if (json_getObjectInShallow(input_string, input_string_startIndex, output_endIndex) == 0) {
-        *output_jsonType = JSON_TYPE_OBJECT;
-        return 0;
+            while (i < length) {
+                i = json_string_skipPlain(s, length, i);
+                if (i >= length) {
+                    break;
+                }
+
+                if (s[i] == '\"') {
+                    return i + 1;
+                }
+
+                if (s[i] == '\\') {
+                    if (i + 1 == length) {
+                        feed->escape = 1;
+                        break;
+                    }
+                    i += 2;
+                } else {
+                    // the control character or non-ASCII character is checked by json_string_scan
+                    i++;
+                }
+            }
+            return JSON_INDEX_NONE;
+
+        // 2. the number is ended by the character which can't be a part of any number
+        case JSON_FEED_TOKEN_NUMBER:
+            while (i < length && (JSON_NUMBER_IS_DIGIT(s[i]) || s[i] == '-' || s[i] == '+' || s[i] == '.' || s[i] == 'e' || s[i] == 'E')) {
+                i++;
+            }
+            return i < length ? i : JSON_INDEX_NONE;
+
+        // 3. the literal is ended by the character which is not a lowercase letter
+        default:
+            while (i < length && s[i] >= 'a' && s[i] <= 'z') {
+                i++;
+            }
+            return i < length ? i : JSON_INDEX_NONE;
     }
+}
 
-    // 6. Shallow Array: only find the left and right square bracket
-    if (json_getArrayInShallow(input_string, input_string_startIndex, output_endIndex) == 0) {
-        *output_jsonType = JSON_TYPE_ARRAY;
-        return 0;
+
+// 16-1. take the batches until the end of the string, the batch is the whole lines behind the cursor
+void * json_lines_work(void * worker) {
+    JSON_Lines_Worker * w = worker;
+    JSON_Lines_Reader * reader = w->reader;
+    const char * s = reader->string;
+    const size_t length = reader->length;
+
+    for (;;) {
+        // 1. take the next batch, the line index of the batch is counted while the batch is taken
+        json_lines_lock(reader);
+        if (reader->result != 0 || reader->cursor >= length) {
+            json_lines_unlock(reader);
+            break;
+        }
+
+        const size_t startIndex = reader->cursor;
+        size_t endIndex = length;
+        if (length - startIndex > JSON_LINES_BATCH_SIZE) {
+            endIndex = json_lines_findNewline(s, length, startIndex + JSON_LINES_BATCH_SIZE - 1);
+            endIndex = endIndex < length ? endIndex + 1 : length;
+        }
+
+        const size_t line  = reader->line;
+        const size_t batch = reader->batches++;
+        reader->line  += json_lines_countNewlines(s, startIndex, endIndex);
+        reader->cursor = endIndex;
+        json_lines_unlock(reader);
+
+        // 2. parse the records, the results are delivered at once in the unordered mode
+        w->size = 0;
+        const int result = json_lines_processBatch(w, startIndex, endIndex, line);
+
+        json_lines_lock(reader);
+
+        // 3. wait for the turn of the batch in the ordered mode, the batch is counted even if it's stopped
+        //    the records before the stop are delivered
+        if (reader->ordered) {
+#if JSON_THREADS
+            while (reader->delivered != batch) {
+                pthread_cond_wait(&reader->turn, &reader->mutex);
+            }
+#else
+            (void) batch;
+#endif
+            size_t k;
+            for (k = 0; k < w->size && reader->result == 0; k++) {
+                reader->result = json_lines_deliverRecord(reader, &w->records[k]);
+            }
+
+            reader->delivered++;
+#if JSON_THREADS
+            pthread_cond_broadcast(&reader->turn);
+#endif
+        }
+
+        if (result != 0 && reader->result == 0) {
+            reader->result = result;
+        }
+        json_lines_unlock(reader);
+
+        json_arena_reset(w->scratch);
     }
 
-    // get value failure
-    *output_jsonType = -1;
-    *output_endIndex = -1;
-    return -1;
+    return NULL;
 }
 
-// 3-1. Get Object in Shallow
-int json_getObjectInShallow(const char * input_string, const int input_string_startIndex, int * output_endIndex) {
-    // check input arguments
-    if (input_string == NULL) {
-        printf("%s: input_string should not be NULL\n", __func__);
-        return -1;
-    }
+// 16-2. parse the records of the batch to the tape and call the record callback
+//       return 0 to go on, 1 if it's stopped by the callback, -1 on failure
+int json_lines_processBatch(JSON_Lines_Worker * worker, const size_t startIndex, const size_t endIndex, size_t line) {
+    JSON_Lines_Reader * reader = worker->reader;
+    const char * s = reader->string;
+    size_t i = startIndex;
 
-    if (input_string_startIndex < 0) {
-        printf("%s: input_string_startIndex (%d) should not be negative\n", __func__, input_string_startIndex);
-        return -1;
-    }
+    for (; i < endIndex; line++) {
+        size_t lineEndIndex = json_lines_findNewline(s, endIndex, i);
+        const size_t nextIndex = lineEndIndex + 1;
 
-    if (output_endIndex == NULL) {
-        printf("%s: output_endIndex should not be NULL\n", __func__);
-        return -1;
-    }
+        // 1. the carriage return of CRLF is not a part of the record
+        if (lineEndIndex > i && s[lineEndIndex - 1] == '\r') {
+            lineEndIndex--;
+        }
 
-    if (input_string[input_string_startIndex] == '{') {
+        // 2. skip the blank line
+        size_t j = i;
+        json_util_skipWhitespace(s, lineEndIndex, &j);
+        if (j >= lineEndIndex) {
+            i = nextIndex;
+            continue;
+        }
 
-        int i, stack = 1;
-        for (i = input_string_startIndex + 1; input_string[i] != '\0'; i++) {
+        JSON_Lines_Record record;
+        record.index  = line;
+        record.result = NULL;
+        record.error.code   = JSON_ERROR_NONE;
+        record.error.offset = JSON_INDEX_NONE;
 
-            // left curly bracket
-            if (input_string[i] == '{') {
-                stack++;
-                continue;
-            }
+        // 3. parse the record to the reused tape, the malformed record is reported and skipped
+        worker->tape.string = s + i;
+        worker->tape.length = lineEndIndex - i;
+        worker->tape.size   = 0;
 
-            // right curly bracket
-            if (input_string[i] == '}') {
-                stack--;
+        if (json_tape_parse(&worker->tape) != 0) {
+            if (json_error_last.code == JSON_ERROR_OUT_OF_MEMORY) {
+                return -1;
+            }
+            record.error = json_error_last;
+            if (record.error.offset != JSON_INDEX_NONE) {
+                record.error.offset += i;
+            }
+        } else if (reader->process != NULL && reader->process(reader->user_data, line, &worker->tape, worker->scratch, &record.result) != 0) {
+            return 1;
+        }
 
-                if (stack == 0) {
-                    *output_endIndex = i;
-                    return 0;
+        // 4. deliver the result now, or keep it until the turn of the batch
+        if (reader->ordered) {
+            if (worker->size == worker->capacity) {
+                size_t capacity = worker->capacity == 0 ? 256 : worker->capacity * 2;
+                JSON_Lines_Record * records = realloc(worker->records, capacity * sizeof(JSON_Lines_Record));
+                if (records == NULL) {
+                    JSON_LOG("%s: out of memory\n", __func__);
+                    return -1;
                 }
+                worker->records = records;
+                worker->capacity = capacity;
+            }
+            worker->records[worker->size++] = record;
+        } else {
+            json_lines_lock(reader);
+            int result = reader->result;
+            if (result == 0) {
+                result = reader->result = json_lines_deliverRecord(reader, &record);
+            }
+            json_lines_unlock(reader);
+
+            if (result != 0) {
+                return 0;
             }
         }
+
+        i = nextIndex;
     }
 
-    *output_endIndex = -1;
-    return -1;
+    return 0;
 }
 
-// 3-2. Get Array in Shallow
-int json_getArrayInShallow(const char * input_string, const int input_string_startIndex, int * output_endIndex) {
-    // check input arguments
-    if (input_string == NULL) {
-        printf("%s: input_string should not be NULL\n", __func__);
-        return -1;
-    }
-
-    if (input_string_startIndex < 0) {
-        printf("%s: input_string_startIndex (%d) should not be negative\n", __func__, input_string_startIndex);
-        return -1;
+// 16-3. call the result callback, the lock is held by the caller
+int json_lines_deliverRecord(JSON_Lines_Reader * reader, const JSON_Lines_Record * record) {
+    if (reader->deliver == NULL) {
+        return 0;
     }
 
-    if (output_endIndex == NULL) {
-        printf("%s: output_endIndex should not be NULL\n", __func__);
-        return -1;
-    }
+    const JSON_Error * error = record->error.code == JSON_ERROR_NONE ? NULL : &record->error;
+    return reader->deliver(reader->user_data, record->index, error, record->result) != 0;
+}
 
-    if (input_string[input_string_startIndex] == '[') {
+// 16-4. lock the reader if the workers are threads
+static inline void json_lines_lock(JSON_Lines_Reader * reader) {
+#if JSON_THREADS
+    pthread_mutex_lock(&reader->mutex);
+#else
+    (void) reader;
+#endif
+}
 
-        int i, stack = 1;
-        for (i = input_string_startIndex + 1; input_string[i] != '\0'; i++) {
+// 16-5. unlock the reader
+static inline void json_lines_unlock(JSON_Lines_Reader * reader) {
+#if JSON_THREADS
+    pthread_mutex_unlock(&reader->mutex);
+#else
+    (void) reader;
+#endif
+}
 
-            // left square bracket
-            if (input_string[i] == '[') {
-                stack++;
-                continue;
+// 16-6. find the line feed from the index, return the length if there is no line feed, 32 or 16 characters are checked at a time
+static inline size_t json_lines_findNewline(const char * string, const size_t length, size_t index) {
+#if defined(__AVX2__)
+    {
+        const __m256i newline = _mm256_set1_epi8('\n');
+        while (index <= length && length - index >= 32) {
+            const __m256i v = _mm256_loadu_si256((const __m256i *) (string + index));
+            const uint32_t mask = (uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, newline));
+            if (mask != 0) {
+                return index + __builtin_ctz(mask);
             }
+            index += 32;
+        }
+    }
+#endif
 
-            // right square bracket
-            if (input_string[i] == ']') {
-                stack--;
-
-                if (stack == 0) {
-                    *output_endIndex = i;
-                    return 0;
-                }
+#if defined(__SSE2__)
+    {
+        const __m128i newline = _mm_set1_epi8('\n');
+        while (index <= length && length - index >= 16) {
+            const __m128i v = _mm_loadu_si128((const __m128i *) (string + index));
+            const int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(v, newline));
+            if (mask != 0) {
+                return index + __builtin_ctz(mask);
             }
+            index += 16;
         }
     }
+#endif
 
-    *output_endIndex = -1;
-    return -1;
+    for (; index < length; index++) {
+        if (string[index] == '\n') {
+            return index;
+        }
+    }
+    return length;
 }
 
+// 16-7. count the line feeds in [index, endIndex), 32 or 16 characters are counted at a time
+static inline size_t json_lines_countNewlines(const char * string, size_t index, const size_t endIndex) {
+    size_t count = 0;
 
-// 3-3. Get the number with end index
-int json_getNumber(const char * input_string, const int input_string_startIndex, int * output_endIndex) {
-    const char DEBUG = 0;
+#if defined(__AVX2__)
+    {
+        const __m256i newline = _mm256_set1_epi8('\n');
+        for (; endIndex - index >= 32; index += 32) {
+            const __m256i v = _mm256_loadu_si256((const __m256i *) (string + index));
+            count += __builtin_popcount((uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, newline)));
+        }
+    }
+#endif
 
-    // check input arguments
-    if (input_string == NULL) {
-        printf("%s: input_string should not be NULL\n", __func__);
+#if defined(__SSE2__)
+    {
+        const __m128i newline = _mm_set1_epi8('\n');
+        for (; endIndex - index >= 16; index += 16) {
+            const __m128i v = _mm_loadu_si128((const __m128i *) (string + index));
+            count += __builtin_popcount((unsigned int) _mm_movemask_epi8(_mm_cmpeq_epi8(v, newline)));
+        }
+    }
+#endif
+
+    for (; index < endIndex; index++) {
+        count += string[index] == '\n';
+    }
+    return count;
+}
+
+
+// 17-1. map the file behind a zero page region, the rest of the last file page is zero-filled by the kernel
+int json_document_map(JSON_Document * document, const int fd, const size_t length) {
+    const long page = sysconf(_SC_PAGESIZE);
+    if (page <= 0 || length > SIZE_MAX - JSON_DOCUMENT_PADDING - (size_t) page) {
         return -1;
     }
 
-    if (input_string_startIndex < 0) {
-        printf("%s: input_string_startIndex (%d) should not be negative\n", __func__, input_string_startIndex);
+    // 1. reserve the whole region as anonymous zero pages, then map the file over the head of it
+    const size_t mapping_size = (length + JSON_DOCUMENT_PADDING + (size_t) page - 1) / (size_t) page * (size_t) page;
+    char * region = mmap(NULL, mapping_size, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (region == MAP_FAILED) {
         return -1;
     }
 
-    if (output_endIndex == NULL) {
-        printf("%s: output_endIndex should not be NULL\n", __func__);
+    if (mmap(region, length, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED) {
+        munmap(region, mapping_size);
         return -1;
     }
 
-    int i = input_string_startIndex;
-    *output_endIndex = -1; // set default to -1
+    // 2. the document is usually scanned from the start to the end, the hints are only hints
+#ifdef MADV_SEQUENTIAL
+    madvise(region, length, MADV_SEQUENTIAL);
+#endif
+#ifdef MADV_HUGEPAGE
+    madvise(region, length, MADV_HUGEPAGE);
+#endif
 
-    // check minus sign
-    if (input_string[i] == '-') {
-        i++;
+    document->string       = region;
+    document->length       = length;
+    document->mapping      = region;
+    document->mapping_size = mapping_size;
+    return 0;
+}
+
+// 17-2. read the file into the aligned buffer, the length is the expected size or 0 if it's unknown
+int json_document_read(JSON_Document * document, const int fd, const size_t length) {
+    // one more byte for the known size, so the end of the file is read without growing the buffer
+    size_t capacity = length > 0 ? length + 1 : JSON_DOCUMENT_READ_SIZE;
+    size_t size = 0;
+    char * buffer = NULL;
+
+    for (;;) {
+        // 1. grow the buffer with the padding, the aligned buffer can't be reallocated
+        if (buffer == NULL || size == capacity) {
+            if (buffer != NULL) {
+                if (capacity > (SIZE_MAX - JSON_DOCUMENT_PADDING) / 2) {
+                    free(buffer);
+                    JSON_LOG("%s: out of memory\n", __func__);
+                    return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+                }
+                capacity *= 2;
+            }
+
+            void * p;
+            if (posix_memalign(&p, JSON_DOCUMENT_ALIGNMENT, capacity + JSON_DOCUMENT_PADDING) != 0) {
+                free(buffer);
+                JSON_LOG("%s: out of memory\n", __func__);
+                return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+            }
+
+            if (buffer != NULL) {
+                memcpy(p, buffer, size);
+                free(buffer);
+            }
+            buffer = p;
+        }
+
+        // 2. the file of the known size is usually read by one call
+        const ssize_t count = read(fd, buffer + size, capacity - size);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            JSON_LOG("%s: %s\n", __func__, strerror(errno));
+            free(buffer);
+            return json_error_set(JSON_ERROR_IO, JSON_INDEX_NONE);
+        }
+
+        if (count == 0) {
+            break;
+        }
+        size += (size_t) count;
     }
 
-integer_part:
-    // check integer part first digit
-    if (input_string[i] == '0') {
-        i++;
-        goto fractional_part;
+    memset(buffer + size, 0, JSON_DOCUMENT_PADDING);
+
+    document->string       = buffer;
+    document->length       = size;
+    document->mapping      = NULL;
+    document->mapping_size = 0;
+    return 0;
+}
+
+
+// 18-1. run the task on each chunk, the first chunk is run in the calling thread
+//       the chunk is run in the calling thread too if its thread can't be created
+void json_parallel_run(void * (* task)(void *), JSON_Parallel_Chunk * chunks, const size_t count) {
+    size_t k;
+#if JSON_THREADS
+    pthread_t * ids = malloc(count * sizeof(pthread_t));
+    char * started = calloc(count, sizeof(char));
+
+    for (k = 1; k < count && ids != NULL && started != NULL; k++) {
+        started[k] = pthread_create(&ids[k], NULL, task, &chunks[k]) == 0;
     }
 
-    if (!isdigit(input_string[i])) {
-        if (DEBUG) {
-            printf("%s: the character at %d (%c 0x%02x) should be a digit\n", __func__, i, input_string[i], input_string[i]);
+    for (k = 0; k < count; k++) {
+        if (started == NULL || !started[k]) {
+            task(&chunks[k]);
         }
-        return -1;
     }
 
-    // check the other characters behind the first one
-    while (isdigit(input_string[++i]));
-
-fractional_part:
-    // check '.'
-    if (input_string[i] != '.') {
-        goto exponent_part;
+    for (k = 1; k < count && started != NULL; k++) {
+        if (started[k]) {
+            pthread_join(ids[k], NULL);
+        }
     }
 
-    // check the first character behind the '.'
-    if (!isdigit(input_string[i + 1])) {
-        goto exponent_part;
+    free(started);
+    free(ids);
+#else
+    for (k = 0; k < count; k++) {
+        task(&chunks[k]);
     }
+#endif
+}
 
-    while (isdigit(input_string[++i]));
+// 18-2. get the depth change and the string state at the end of the chunk for both string states at the start
+//       the quotes are the same for both states, the characters behind the odd quotes are inside a string only if it starts outside
+void * json_parallel_scanChunk(void * chunk) {
+    JSON_Parallel_Chunk * c = chunk;
+    uint64_t escaped_carry = 0;
+    uint64_t odd_carry = 0;
+    int64_t delta_outside = 0;
+    int64_t delta_inside = 0;
+
+    char padding[64];
+    size_t i;
+    for (i = c->startIndex; i < c->endIndex; i += 64) {
+        size_t blockSize;
+        const char * block = json_simd_loadBlock(c->string, c->endIndex, i, padding, &blockSize);
+
+        JSON_Block_Vectors vectors;
+        json_simd_loadVectors(block, &vectors);
+
+        // 1. the characters behind the odd count of quotes from the start of the chunk
+        const uint64_t escaped = json_simd_escapedMask(json_simd_matchMask(&vectors, '\\'), &escaped_carry);
+        const uint64_t quote = json_simd_matchMask(&vectors, '\"') & ~escaped;
+        const uint64_t odd = json_simd_prefixXor(quote) ^ odd_carry;
+        odd_carry = (uint64_t) ((int64_t) odd >> 63);
+
+        // 2. count the brackets for both states
+        const uint64_t opens  = json_simd_matchMask(&vectors, '[') | json_simd_matchMask(&vectors, '{');
+        const uint64_t closes = json_simd_matchMask(&vectors, ']') | json_simd_matchMask(&vectors, '}');
+
+        delta_outside += __builtin_popcountll(opens & ~odd) - __builtin_popcountll(closes & ~odd);
+        delta_inside  += __builtin_popcountll(opens & odd)  - __builtin_popcountll(closes & odd);
+    }
+
+    c->depth_delta[0]  = delta_outside;
+    c->depth_delta[1]  = delta_inside;
+    c->inString_end[0] = odd_carry != 0;
+    c->inString_end[1] = odd_carry == 0;
+    return NULL;
+}
 
-exponent_part:
-    // 1. check e / E
-    if (input_string[i] != 'e' && input_string[i] != 'E') {
-        *output_endIndex = i - 1;
-        return 0;
+// 18-3. find the first comma of the array in the chunk by the resolved state, JSON_INDEX_NONE if the array ends first
+size_t json_parallel_findFirst(const JSON_Parallel_Chunk * chunk) {
+    const JSON_Parallel_Chunk * c = chunk;
+    if (c->depth <= 0) {
+        return JSON_INDEX_NONE;
+    }
+
+    uint64_t escaped_carry  = 0;
+    uint64_t inString_carry = c->inString ? ~(uint64_t) 0 : 0;
+    int64_t depth = c->depth;
+
+    char padding[64];
+    size_t i;
+    for (i = c->startIndex; i < c->endIndex; i += 64) {
+        size_t blockSize;
+        const char * block = json_simd_loadBlock(c->string, c->endIndex, i, padding, &blockSize);
+
+        JSON_Block_Vectors vectors;
+        json_simd_loadVectors(block, &vectors);
+
+        const uint64_t escaped = json_simd_escapedMask(json_simd_matchMask(&vectors, '\\'), &escaped_carry);
+        const uint64_t quote = json_simd_matchMask(&vectors, '\"') & ~escaped;
+        const uint64_t inString = json_simd_prefixXor(quote) ^ inString_carry;
+        inString_carry = (uint64_t) ((int64_t) inString >> 63);
+
+        const uint64_t opens  = (json_simd_matchMask(&vectors, '[') | json_simd_matchMask(&vectors, '{')) & ~inString;
+        const uint64_t closes = (json_simd_matchMask(&vectors, ']') | json_simd_matchMask(&vectors, '}')) & ~inString;
+        const uint64_t commas = json_simd_matchMask(&vectors, ',') & ~inString;
+
+        // walk the structural characters in order
+        uint64_t structurals = opens | closes | commas;
+        while (structurals != 0) {
+            const uint64_t bit = structurals & (~structurals + 1);
+            if (opens & bit) {
+                depth++;
+            } else if (closes & bit) {
+                if (--depth == 0) {
+                    return JSON_INDEX_NONE;
+                }
+            } else if (depth == 1) {
+                return i + __builtin_ctzll(bit);
+            }
+            structurals ^= bit;
+        }
     }
 
-    // 2. check + / -
-    if (input_string[i + 1] == '+' || input_string[i + 1] == '-') {
-        i++;
-    }
+    return JSON_INDEX_NONE;
+}
 
-    // 3. check the first character behind the e, E, +, -
-    if (!isdigit(input_string[i + 1])) {
+// 18-4. get the pairs of the elements behind the commas in the chunk, the last element could end in the chunks behind it
+void * json_parallel_sliceChunk(void * chunk) {
+    JSON_Parallel_Chunk * c = chunk;
+    const char * s = c->string;
+    const size_t length = c->length;
 
-        if (input_string[i] == 'e' || input_string[i] == 'E') {
-            *output_endIndex = i - 1;
-            return 0;
+    if (c->first == JSON_INDEX_NONE) {
+        c->first = json_parallel_findFirst(c);
+        if (c->first == JSON_INDEX_NONE) {
+            return NULL;
         }
+    }
 
-        if (input_string[i] == '+' || input_string[i] == '-') {
-            *output_endIndex = i - 2;
-            return 0;
-        }
+    size_t i = c->first + 1;
+    if (json_util_getNextCharacter_n(s, length, &i) != 0) {
+        goto failure;
+    }
 
-        printf("[BUG] %s: please report the log to project owner, thanks.\n", __func__);
-        puts("================================================================================");
-        printf("input_string = %s\n", input_string);
-        printf("input_string_startIndex = %d\n", input_string_startIndex);
-        puts("================================================================================\n");
-        return -1;
+    // the empty array
+    if (s[c->first] == '[' && s[i] == ']') {
+        return NULL;
     }
 
-    while (isdigit(input_string[++i]));
+    for (;;) {
+        // 1. check the value
+        size_t endIndex;
+        int jsonType;
+        if (json_value_scan(s, length, i, &endIndex, &jsonType) != 0) {
+            goto failure;
+        }
 
-    // success
-    *output_endIndex = i - 1;
-    return 0;
-}
+        // 2. create JSON_Key_Value_Pair, the key is assigned when the position is known
+        JSON_Key_Value_Pair * pair;
+        if (json_arena_allocZero(NULL, sizeof(JSON_Key_Value_Pair), (void **) &pair) != 0) {
+            goto failure;
+        }
 
+        if (c->tail == NULL) {
+            c->head = pair;
+        } else {
+            c->tail->next = pair;
+        }
+        c->tail = pair;
+        c->size++;
 
-// 3-4. Get the string with end index
-int json_getString(const char * input_string, const int input_string_startIndex, int * output_endIndex) {
-    const char DEBUG = 0;
+        pair->key_type   = JSON_TYPE_NUMBER;
+        pair->value_type = jsonType;
+        if (json_arena_allocSubstring(NULL, s, i, endIndex, &(pair->value)) != 0) {
+            goto failure;
+        }
 
-    // check input arguments
-    if (input_string == NULL) {
-        printf("%s: input_string should not be NULL\n", __func__);
-        return -1;
-    }
+        // 3. check the character after the value, the comma behind the chunk belongs to the next slice
+        i = endIndex + 1;
+        if (json_util_getNextCharacter_n(s, length, &i) != 0) {
+            goto failure;
+        }
 
-    if (input_string_startIndex < 0) {
-        printf("%s: input_string_startIndex (%d) should not be negative\n", __func__, input_string_startIndex);
-        return -1;
-    }
+        if (s[i] == ']') {
+            return NULL;
+        }
 
-    if (output_endIndex == NULL) {
-        printf("%s: output_endIndex should not be NULL\n", __func__);
-        return -1;
-    }
+        if (s[i] != ',') {
+            goto failure;
+        }
 
-    int i = input_string_startIndex;
-    *output_endIndex = -1; // set default to -1
+        if (i >= c->endIndex) {
+            c->next = i;
+            return NULL;
+        }
+        i++;
 
-    // check first character
-    if (input_string[i] != '\"') {
-        if (DEBUG) {
-            printf("%s: the first character (%c 0x%02x) should be quotation mark (\")\n", __func__, input_string[i], input_string[i]);
+        if (json_util_getNextCharacter_n(s, length, &i) != 0) {
+            goto failure;
         }
-        return -1;
     }
-    i++;
 
-get_string_loop:
+failure:
+    c->failed = 1;
+    return NULL;
+}
 
-    // 1. check quotation mark
-    if (input_string[i] == '\"') {
-        *output_endIndex = i;
-        return 0;
-    }
+// 18-5. allocate the keys of the slice from its position in the array
+void * json_parallel_assignKeys(void * chunk) {
+    JSON_Parallel_Chunk * c = chunk;
+    JSON_Key_Value_Pair * pair = c->head;
 
-    // 2. check control character
-    if (iscntrl(input_string[i])) {
-        if (input_string[i] == '\0') {
-            if (DEBUG) {
-                printf("%s: is the end of string at %d\n", __func__, i);
-            }
-        } else {
-            if (DEBUG) {
-                printf("%s: invalid control character at %d (0x%02x)\n", __func__, i, input_string[i]);
-            }
+    size_t k;
+    for (k = 0; k < c->size; k++) {
+        if (json_arena_allocStringBySize(NULL, c->base + k, &(pair->key)) != 0) {
+            c->failed = 1;
+            return NULL;
         }
-        return -1;
+        pair = pair->next;
     }
+    return NULL;
+}
 
-    // 3. check reverse solidus
-    if (input_string[i] == '\\') {
-        i++;
 
-        // check the characters behind the reverse solidus
-        switch (input_string[i]) {
-            case '\"':  // quotation mark
-            case '\\':  // reverse solidus
-            case '/':   // solidus
-            case 'b':   // backspace
-            case 'f':   // form feed
-            case 'n':   // line feed
-            case 'r':   // carriage return
-            case 't':   // character tabulation
-                break;
+#if JSON_THREADS
+// 19-1. take the documents from the own queue, then steal from the other queues until all queues are empty
+void * json_batch_work(void * worker) {
+    JSON_Batch_Worker * w = worker;
+    JSON_Batch_Queue * queue = &w->queue;
 
-            // Unicode
-            case 'u': {
-                // check 4 hexadecimal digits behind \u
-                int j;
-                for (j = 0; j < 4; j++) {
-                    if (!isxdigit(input_string[++i])) {
-                        if (DEBUG) {
-                            printf("%s: non-hexadecimal digit character behind \\u at %d (%c 0x%02x)\n", __func__, i, input_string[i], input_string[i]);
-                        }
-                        return -1;
-                    }
-                }
-                break;
+    for (;;) {
+        // 1. take a few documents from the top of the own queue
+        pthread_mutex_lock(&queue->mutex);
+        const size_t top = queue->top;
+        const size_t bottom = queue->bottom - queue->top > JSON_BATCH_GRAIN ? queue->top + JSON_BATCH_GRAIN : queue->bottom;
+        queue->top = bottom;
+        pthread_mutex_unlock(&queue->mutex);
+
+        if (top < bottom) {
+            size_t k;
+            for (k = top; k < bottom; k++) {
+                json_batch_eval(w->batch, k, w->scratch);
             }
+            continue;
+        }
 
-            default:
-                if (DEBUG) {
-                    printf("%s: invalid character behind the reverse solidus at %d (%c, 0x%02x)\n", __func__, i, input_string[i], input_string[i]);
-                }
-                return -1;
+        // 2. the own queue is empty, the documents are never added, so it's done if there is nothing to steal
+        if (json_batch_steal(w) != 0) {
+            break;
         }
     }
 
-    // 4. other character
-    i++;
-
-    goto get_string_loop;
+    return NULL;
 }
 
-// 3-5. Get the boolean with end index.
-int json_getBoolean(const char * input_string, const int input_string_startIndex, int * output_endIndex) {
-    // check input arguments
-    if (input_string == NULL) {
-        printf("%s: input_string should not be NULL\n", __func__);
-        return -1;
-    }
-
-    if (input_string_startIndex < 0) {
-        printf("%s: input_string_startIndex (%d) should not be negative\n", __func__, input_string_startIndex);
-        return -1;
-    }
-
-    if (output_endIndex == NULL) {
-        printf("%s: output_endIndex should not be NULL\n", __func__);
-        return -1;
+// 19-2. steal the upper half of the next non-empty queue into the own queue, return -1 if all queues are empty
+//       only one lock is held at a time
+int json_batch_steal(JSON_Batch_Worker * worker) {
+    JSON_Batch * batch = worker->batch;
+
+    size_t k;
+    for (k = 1; k < batch->size; k++) {
+        JSON_Batch_Queue * victim = &batch->workers[(worker->id + k) % batch->size].queue;
+
+        pthread_mutex_lock(&victim->mutex);
+        const size_t bottom = victim->bottom;
+        const size_t count = bottom - victim->top;
+        victim->bottom -= (count + 1) / 2;
+        const size_t top = victim->bottom;
+        pthread_mutex_unlock(&victim->mutex);
+
+        if (top < bottom) {
+            pthread_mutex_lock(&worker->queue.mutex);
+            worker->queue.top    = top;
+            worker->queue.bottom = bottom;
+            pthread_mutex_unlock(&worker->queue.mutex);
+            return 0;
+        }
     }
 
-    *output_endIndex = -1; // set default to -1
+    return -1;
+}
+#endif
 
-    // check the first character
-    const char * booleanValue = input_string[input_string_startIndex] == 't' ? "true" : (input_string[input_string_startIndex] == 'f' ? "false" : NULL);
-    if (booleanValue == NULL) {
-        return -1;
-    }
+// 19-3. evaluate the path set on the document into its row of the matrix
+static inline void json_batch_eval(const JSON_Batch * batch, const size_t document, unsigned char * scratch) {
+    const char * s = batch->strings[document];
+    JSON_Value_Range * values = batch->values + document * batch->set->size;
 
-    // string compare
-    int i;
-    for (i = 0; booleanValue[i] != '\0'; i++) {
-        if (booleanValue[i] != input_string[input_string_startIndex + i]) {
-            return -1;
+    if (s == NULL) {
+        size_t k;
+        for (k = 0; k < batch->set->size; k++) {
+            values[k].startIndex = JSON_INDEX_NONE;
+            values[k].endIndex   = JSON_INDEX_NONE;
+            values[k].jsonType   = -1;
         }
+        return;
     }
 
-    // success
-    *output_endIndex = input_string_startIndex + i - 1;
-    return 0;
+    const size_t length = batch->lengths != NULL ? batch->lengths[document] : JSON_LENGTH_UNBOUNDED;
+    size_t i = 0;
+    json_util_skipWhitespace(s, length, &i);
+    json_pathSet_eval(batch->set, s, length, i, scratch, values);
 }
 
-// 3-6. Get the null with end index.
-int json_getNull(const char * input_string, const int input_string_startIndex, int * output_endIndex) {
-    // check input arguments
-    if (input_string == NULL) {
-        printf("%s: input_string should not be NULL\n", __func__);
-        return -1;
-    }
 
-    if (input_string_startIndex < 0) {
-        printf("%s: input_string_startIndex (%d) should not be negative\n", __func__, input_string_startIndex);
-        return -1;
-    }
+// 20-1. split the keys into the steps, the canonical prefix of each step is kept in the cache
+// the canonical form is the keys without the leading zeros of the positions
+int json_cache_parseKeys(JSON_Cache * cache, const char * keys, const size_t keys_length, size_t * output_size) {
+    size_t size = 0;
+    size_t prefix_length = 0;
+    uint64_t prefix_hash = 0;
 
-    if (output_endIndex == NULL) {
-        printf("%s: output_endIndex should not be NULL\n", __func__);
-        return -1;
-    }
+    size_t key_i = 0;
+    size_t key_startIndex, key_endIndex;
+    int key_jsonType;
 
-    *output_endIndex = -1; // set default to -1
+    do {
+        // 1. get key
+        if (json_getKey_n(keys, keys_length, key_i, &key_startIndex, &key_endIndex, &key_jsonType) != 0) {
+            return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+        }
 
-    // check the first character
-    const char * nullValue = "null";
+        // 2. grow the steps and the canonical form, the key is at most 2 characters longer in the canonical form
+        if (size == cache->steps_capacity) {
+            size_t capacity = cache->steps_capacity == 0 ? 8 : cache->steps_capacity * 2;
+            JSON_Cache_Step * steps = realloc(cache->steps, capacity * sizeof(JSON_Cache_Step));
+            if (steps == NULL) {
+                JSON_LOG("%s: out of memory\n", __func__);
+                return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+            }
+            cache->steps = steps;
+            cache->steps_capacity = capacity;
+        }
 
-    // string compare
-    int i;
-    for (i = 0; nullValue[i] != '\0'; i++) {
-        if (nullValue[i] != input_string[input_string_startIndex + i]) {
-            return -1;
+        if (prefix_length + key_endIndex - key_startIndex + 3 > cache->prefix_capacity) {
+            size_t capacity = cache->prefix_capacity == 0 ? 64 : cache->prefix_capacity;
+            while (prefix_length + key_endIndex - key_startIndex + 3 > capacity) {
+                capacity *= 2;
+            }
+            char * prefix = realloc(cache->prefix, capacity);
+            if (prefix == NULL) {
+                JSON_LOG("%s: out of memory\n", __func__);
+                return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
+            }
+            cache->prefix = prefix;
+            cache->prefix_capacity = capacity;
         }
-    }
 
-    // success
-    *output_endIndex = input_string_startIndex + i - 1;
-    return 0;
-}
+        JSON_Cache_Step * step = &cache->steps[size++];
+        step->type = key_jsonType;
+        step->key_startIndex = key_startIndex;
+        step->key_endIndex   = key_endIndex;
+        step->position = 0;
+
+        // 3-1. the quoted key is kept as it is
+        size_t j = key_startIndex;
+
+        // 3-2. convert the position to integer, and skip the leading zeros
+        if (key_jsonType == JSON_TYPE_NUMBER) {
+            for (; j <= key_endIndex; j++) {
+                if (step->position > (SIZE_MAX - 9) / 10) {
+                    JSON_LOG("%s: the position at %zu is too large\n", __func__, key_startIndex);
+                    return json_error_set(JSON_ERROR_INVALID_ARGUMENT, JSON_INDEX_NONE);
+                }
+                step->position = step->position * 10 + (keys[j] - '0');
+            }
 
+            j = key_startIndex;
+            while (j < key_endIndex && keys[j] == '0') {
+                j++;
+            }
+        }
 
-// 4-1. get next character without blank
-int json_util_getNextCharacter(const char * string, int * index) {
-    // check arguments
-    if (string == NULL) {
-        printf("%s: string should not be NULL\n", __func__);
-        return -1;
-    }
+        // 4. append the key to the canonical form, and chain the hash of the prefix
+        char * component = cache->prefix + prefix_length;
+        const size_t component_length = key_endIndex - j + 3;
+        component[0] = '[';
+        memcpy(component + 1, keys + j, key_endIndex - j + 1);
+        component[component_length - 1] = ']';
 
-    if (index == NULL) {
-        printf("%s: index should not be NULL\n", __func__);
-        return -1;
-    }
+        prefix_length += component_length;
+        prefix_hash = prefix_hash * 0x100000001B3ULL ^ json_util_hash(component, component_length);
 
-    if (*index < 0) {
-        printf("%s: *index (%d) should not be negative\n", __func__, *index);
-        return -1;
-    }
+        step->prefix_length = prefix_length;
+        step->prefix_hash   = prefix_hash;
 
-    while (!isprint(string[*index]) || isspace(string[*index])) {
-        if (string[*index] == '\0') {
-            // it's the end of the string
-            return -1;
-        }
-        (*index)++;
-    }
+        // 5. move to next key
+        key_i = key_endIndex + 2;
+
+    } while (json_util_charAt(keys, keys_length, key_i) != '\0');
 
+    *output_size = size;
     return 0;
 }
 
-// 4-2. print substring
-int json_util_printSubstring(const char * string, const int startIndex, const int endIndex) {
-    if (string == NULL) {
-        printf("%s: string should not be NULL\n", __func__);
-        return -1;
-    }
-
-    if (startIndex < 0) {
-        printf("%s: startIndex (%d) should not be negative\n", __func__, startIndex);
-        return -1;
-    }
+// 20-2. find the entry of the prefix ending at the step, JSON_INDEX_NONE if it's not cached
+size_t json_cache_find(const JSON_Cache * cache, const JSON_Cache_Step * step) {
+    size_t entry = cache->buckets[step->prefix_hash & cache->buckets_mask];
 
-    if (startIndex > endIndex) {
-        printf("%s: endIndex (%d) should greater than startIndex (%d)\n", __func__, endIndex, startIndex);
-        return -1;
+    while (entry != JSON_INDEX_NONE) {
+        const JSON_Cache_Entry * e = &cache->entries[entry];
+        if (e->hash == step->prefix_hash && e->prefix_length == step->prefix_length &&
+            memcmp(e->prefix, cache->prefix, step->prefix_length) == 0) {
+            return entry;
+        }
+        entry = e->chain;
     }
 
-    int i;
-    for (i = startIndex; i <= endIndex; i++) {
-        printf("%c", string[i]);
-    }
-    return 0;
+    return JSON_INDEX_NONE;
 }
 
-// 4-3. allocate substring
-int json_util_allocSubstring(const char * string, const int startIndex, const int endIndex, char ** substring) {
-    if (string == NULL) {
-        printf("%s: string should not be NULL\n", __func__);
-        return -1;
+// 20-3. cache the value of the prefix ending at the step, evict the least recently used entry if the cache is full
+// the prefix isn't cached if it's out of memory, the lookup itself doesn't fail
+void json_cache_insert(JSON_Cache * cache, const JSON_Cache_Step * step, const size_t value_startIndex, const size_t value_endIndex, const int value_jsonType) {
+    // 1. take the unused entry, or the least recently used one
+    const size_t entry = cache->size < cache->capacity ? cache->size : cache->oldest;
+    JSON_Cache_Entry * e = &cache->entries[entry];
+
+    // 2. grow the prefix of the entry before it's evicted, the evicted entry is kept on failure
+    if (step->prefix_length > e->prefix_capacity) {
+        char * prefix = realloc(e->prefix, step->prefix_length);
+        if (prefix == NULL) {
+            JSON_LOG("%s: out of memory\n", __func__);
+            return;
+        }
+        e->prefix = prefix;
+        e->prefix_capacity = step->prefix_length;
     }
 
-    if (startIndex < 0) {
-        printf("%s: startIndex (%d) should not be negative\n", __func__, startIndex);
-        return -1;
-    }
+    // 3. evict the entry from its hash chain and the LRU list
+    if (entry < cache->size) {
+        size_t * link = &cache->buckets[e->hash & cache->buckets_mask];
+        while (*link != entry) {
+            link = &cache->entries[*link].chain;
+        }
+        *link = e->chain;
 
-    if (startIndex > endIndex) {
-        printf("%s: endIndex (%d) should greater than startIndex (%d)\n", __func__, endIndex, startIndex);
-        return -1;
+        json_cache_unlink(cache, entry);
     }
-
-    if (substring == NULL) {
-        printf("%s: substring should not be NULL\n", __func__);
-        return -1;
+    else {
+        cache->size++;
     }
 
-    // set default to NULL
-    *substring = NULL;
+    // 4. fill the entry, it's the most recently used one
+    e->hash = step->prefix_hash;
+    memcpy(e->prefix, cache->prefix, step->prefix_length);
+    e->prefix_length = step->prefix_length;
 
-    char * s = (char *) calloc(endIndex - startIndex + 2, sizeof(char));
-    if (s == NULL) {
-        printf("%s: out of memory\n", __func__);
-        return -1;
-    }
+    e->value_startIndex = value_startIndex;
+    e->value_endIndex   = value_endIndex;
+    e->value_jsonType   = value_jsonType;
 
-    int i;
-    for (i = 0; i <= endIndex - startIndex; i++) {
-        s[i] = string[startIndex + i];
-    }
+    size_t * bucket = &cache->buckets[e->hash & cache->buckets_mask];
+    e->chain = *bucket;
+    *bucket = entry;
 
-    *substring = s;
-    return 0;
+    json_cache_pushNewest(cache, entry);
 }
 
-// 4-4. string compare
-int json_util_stringCompare(const char * s1, const int s1_startIndex, const int s1_endIndex, const char * s2, const int s2_startIndex, const int s2_endIndex) {
-    const char DEBUG = 0;
+// 20-4. remove the entry from the LRU list
+static inline void json_cache_unlink(JSON_Cache * cache, const size_t entry) {
+    const JSON_Cache_Entry * e = &cache->entries[entry];
 
-    // check arguments
-    if (s1 == NULL) {
-        printf("%s: s1 should not be NULL\n", __func__);
-        return -1;
+    if (e->newer != JSON_INDEX_NONE) {
+        cache->entries[e->newer].older = e->older;
     }
-
-    if (s1_startIndex < 0) {
-        printf("%s: s1_startIndex (%d) should not be negative\n", __func__, s1_startIndex);
-        return -1;
+    else {
+        cache->newest = e->older;
     }
 
-    if (s1_endIndex < s1_startIndex) {
-        printf("%s: s1_endIndex (%d) should greater than s1_startIndex (%d)\n", __func__, s1_endIndex, s1_startIndex);
-        return -1;
+    if (e->older != JSON_INDEX_NONE) {
+        cache->entries[e->older].newer = e->newer;
     }
-
-    if (s2 == NULL) {
-        printf("%s: s2 should not be NULL\n", __func__);
-        return -1;
+    else {
+        cache->oldest = e->newer;
     }
+}
 
-    if (s2_startIndex < 0) {
-        printf("%s: s2_startIndex (%d) should not be negative\n", __func__, s2_startIndex);
-        return -1;
-    }
+// 20-5. put the entry at the head of the LRU list
+static inline void json_cache_pushNewest(JSON_Cache * cache, const size_t entry) {
+    JSON_Cache_Entry * e = &cache->entries[entry];
+    e->newer = JSON_INDEX_NONE;
+    e->older = cache->newest;
 
-    if (s2_endIndex < s2_startIndex) {
-        printf("%s: s2_endIndex (%d) should greater than s2_startIndex (%d)\n", __func__, s2_endIndex, s2_startIndex);
-        return -1;
+    if (cache->newest != JSON_INDEX_NONE) {
+        cache->entries[cache->newest].newer = entry;
     }
+    else {
+        cache->oldest = entry;
+    }
+    cache->newest = entry;
+}
 
-    // check string length
-    int s1_length = s1_endIndex - s1_startIndex + 1;
-    int s2_length = s2_endIndex - s2_startIndex + 1;
-    if (s1_length != s2_length) {
-        if (DEBUG) {
-            printf("%s: string length is not match, s1_length = %d, s2_length = %d\n\n", __func__, s1_length, s2_length);
+
+// 21-1. find the interned copy of the string, or intern the copy
+int json_intern_find(JSON_Intern * intern, const char * string, const size_t length, char ** output_string) {
+    // 1. grow the slots when they are half full
+    if ((intern->size + 1) * 2 > intern->capacity) {
+        size_t capacity = intern->capacity == 0 ? 64 : intern->capacity * 2;
+        JSON_Intern_Slot * slots = calloc(capacity, sizeof(JSON_Intern_Slot));
+        if (slots == NULL) {
+            JSON_LOG("%s: out of memory\n", __func__);
+            return json_error_set(JSON_ERROR_OUT_OF_MEMORY, JSON_INDEX_NONE);
         }
-        return -1;
-    }
 
-    int i;
-    for (i = 0; i < s1_length; i++) {
-        if (s1[s1_startIndex + i] != s2[s2_startIndex + i]) {
-            if (DEBUG) {
-                printf("%s: string is not match, s1[%d] = %c, s2[%d] = %c\n\n", __func__, s1_startIndex + i, s1[s1_startIndex + i], s2_startIndex + i, s2[s2_startIndex + i]);
+        // rehash the strings
+        size_t i;
+        for (i = 0; i < intern->capacity; i++) {
+            if (intern->slots[i].string == NULL) {
+                continue;
             }
-            return -1;
+
+            size_t j = intern->slots[i].hash & (capacity - 1);
+            while (slots[j].string != NULL) {
+                j = (j + 1) & (capacity - 1);
+            }
+            slots[j] = intern->slots[i];
         }
+
+        free(intern->slots);
+        intern->slots = slots;
+        intern->capacity = capacity;
     }
 
-    if (DEBUG) {
-        printf("%s: string is match\n", __func__);
-        printf("   s1[%d..%d] = ", s1_startIndex, s1_endIndex);
-        json_util_printSubstring(s1, s1_startIndex, s1_endIndex);
+    // 2. linear probing
+    const uint64_t hash = json_util_hash(string, length);
+    const size_t mask = intern->capacity - 1;
+    size_t i = hash & mask;
+    while (intern->slots[i].string != NULL) {
+        const JSON_Intern_Slot * slot = &intern->slots[i];
+        if (slot->hash == hash && slot->length == length && memcmp(slot->string, string, length) == 0) {
+            *output_string = (char *) slot->string;
+            return 0;
+        }
+        i = (i + 1) & mask;
+    }
 
-        printf("\n   s2[%d..%d] = ", s2_startIndex, s2_endIndex);
-        json_util_printSubstring(s2, s2_startIndex, s2_endIndex);
-        puts("\n");
+    // 3. keep the NUL-terminated copy in the arena of the table
+    char * copy;
+    if (json_arena_alloc(intern->strings, length + 1, (void **) &copy) != 0) {
+        return -1;
     }
+    memcpy(copy, string, length);
+    copy[length] = '\0';
+
+    intern->slots[i].hash   = hash;
+    intern->slots[i].string = copy;
+    intern->slots[i].length = length;
+    intern->size++;
+
+    *output_string = copy;
     return 0;
 }
 
-// 4-5. allocate string by integer
-int json_util_allocStringByInteger(const int number, char ** string) {
-
-    if (number < 0) {
-        printf("%s: number (%d) should not be negative\n", __func__, number);
-        return -1;
+// 21-2. intern the substring, or allocate it in the arena (or heap) if the intern table is NULL
+int json_intern_allocSubstring(JSON_Arena * arena, JSON_Intern * intern, const char * string, const size_t startIndex, const size_t endIndex, char ** substring) {
+    if (intern == NULL) {
+        return json_arena_allocSubstring(arena, string, startIndex, endIndex, substring);
     }
 
-    int digit = 1;
-    int n = number;
-    while (n / 10 != 0) {
-        n /= 10;
-        digit++;
-    }
+    *substring = NULL;
+    return json_intern_find(intern, string + startIndex, endIndex - startIndex + 1, substring);
+}
 
-    *string = (char *) calloc(digit + 1, sizeof(char));
-    if (*string == NULL) {
-        printf("%s: out of memory\n", __func__);
-        return -1;
+// 21-3. intern the string of the number, or allocate it in the arena (or heap) if the intern table is NULL
+int json_intern_allocStringBySize(JSON_Arena * arena, JSON_Intern * intern, const size_t number, char ** string) {
+    if (intern == NULL) {
+        return json_arena_allocStringBySize(arena, number, string);
     }
 
-    sprintf(*string, "%d", number);
+    *string = NULL;
 
-    return 0;
+    char buffer[24];
+    const int length = sprintf(buffer, "%zu", number);
+    return json_intern_find(intern, buffer, length, string);
+}
+
+// 21-4. the intern table of the value, NULL if the value is an object, an array or too long to be interned
+static inline JSON_Intern * json_intern_forValue(JSON_Intern * intern, const int jsonType, const size_t length) {
+    if (intern == NULL || jsonType == JSON_TYPE_OBJECT || jsonType == JSON_TYPE_ARRAY || length > intern->value_length) {
+        return NULL;
+    }
+    return intern;
 }
@@ -1,6 +1,12 @@
 #ifndef __JSON2C_H
 #define __JSON2C_H
 
+#include <stddef.h>
+#include <stdint.h>
+
+// Invalid index of the length-bounded API
+#define JSON_INDEX_NONE ((size_t) -1)
+
 // JSON Type
 enum {
     JSON_TYPE_OBJECT,
@@ -11,6 +17,31 @@ enum {
     JSON_TYPE_NULL
 };
 
+// JSON Error
+enum {
+    JSON_ERROR_NONE,
+    JSON_ERROR_INVALID_ARGUMENT,   // the argument is NULL or out of range
+    JSON_ERROR_OUT_OF_MEMORY,
+    JSON_ERROR_SYNTAX,             // the JSON string is invalid at the offset
+    JSON_ERROR_NOT_FOUND,          // the key or position is not found, the offset is the end of the object or array
+    JSON_ERROR_IO                  // the file can't be opened or read, errno is kept
+};
+
+// JSON Number Error
+enum {
+    JSON_NUMBER_ERROR_NONE,
+    JSON_NUMBER_ERROR_NOT_NUMBER,    // it's not a number
+    JSON_NUMBER_ERROR_NOT_INTEGER,   // the number has fraction or exponent, it could be converted by json_number_toDouble_n
+    JSON_NUMBER_ERROR_OVERFLOW       // the integer is out of range
+};
+
+// JSON Error with offset
+typedef struct json_error_t {
+    int    code;     // JSON_ERROR_XXX
+    size_t offset;   // the byte offset in the JSON string, JSON_INDEX_NONE if it's not about the JSON string
+
+} JSON_Error;
+
 // JSON Key Value Pair
 typedef struct json_key_value_pair_t {
     char * key;
@@ -23,6 +54,238 @@ typedef struct json_key_value_pair_t {
 
 } JSON_Key_Value_Pair;
 
+// JSON Key Value View
+typedef struct json_key_value_view_t {
+    size_t key_startIndex;      // the quoted key in the string, JSON_INDEX_NONE for the array element
+    size_t key_length;
+    int    key_type;
+    int    key_escaped;         // 1 if the key contains the escape characters
+
+    size_t value_startIndex;
+    size_t value_length;
+    int    value_type;
+
+} JSON_Key_Value_View;
+
+// JSON Structural Index
+typedef struct json_index_t {
+    const char * string;    // the indexed string, it is not owned by the index
+    size_t       length;
+
+    size_t * positions;     // the structural positions in ascending order
+    size_t   size;
+    size_t   capacity;
+
+} JSON_Index;
+
+// JSON Tape
+typedef struct json_tape_t {
+    const char * string;    // the parsed string, it is not owned by the tape
+    size_t       length;
+
+    uint64_t * entries;     // the tagged 64-bit entries, the root value is at tape index 0
+    size_t     size;
+    size_t     capacity;
+
+} JSON_Tape;
+
+// JSON Lookup Context
+typedef struct json_lookup_object_t JSON_Lookup_Object;
+
+typedef struct json_lookup_t {
+    const char * string;    // the looked up string, it is not owned by the context
+    size_t       length;
+    size_t       threshold; // the lookup count on the same object before its hash table is built
+
+    JSON_Lookup_Object * objects;   // the object records, open addressing by the object start index
+    size_t               size;
+    size_t               capacity;
+
+} JSON_Lookup;
+
+// JSON Compiled Path
+typedef struct json_path_step_t {
+    int      type;              // JSON_TYPE_STRING for the key, JSON_TYPE_NUMBER for the array position
+    size_t   key_startIndex;    // the quoted key in the keys of the path
+    size_t   key_endIndex;
+    uint64_t key_hash;          // the hash of the key characters without the quotes
+    size_t   position;
+
+} JSON_Path_Step;
+
+typedef struct json_path_t {
+    char * keys;            // the copy of the compiled keys
+    size_t keys_length;
+
+    JSON_Path_Step * steps;
+    size_t           size;
+
+} JSON_Path;
+
+// JSON Compiled Path Set
+typedef struct json_path_node_t {
+    const JSON_Path_Step * step;    // the step of the node, NULL for the root
+    const char *           keys;    // the keys of the step
+
+    size_t child;           // the first child node, JSON_INDEX_NONE if there is no child
+    size_t sibling;         // the next sibling node, JSON_INDEX_NONE if it's the last one
+    size_t output;          // the first path ending at the node, JSON_INDEX_NONE if there is no path
+
+} JSON_Path_Node;
+
+typedef struct json_path_set_t {
+    JSON_Path ** paths;
+    size_t *     outputs_next;  // the next path ending at the same node
+    size_t       size;
+
+    JSON_Path_Node * nodes;     // the prefix trie, the root is at index 0
+    size_t           nodes_size;
+    size_t           nodes_capacity;
+
+} JSON_Path_Set;
+
+// JSON Value Range
+typedef struct json_value_range_t {
+    size_t startIndex;
+    size_t endIndex;
+    int    jsonType;
+
+} JSON_Value_Range;
+
+// JSON Arena
+typedef struct json_arena_chunk_t {
+    struct json_arena_chunk_t * next;
+    size_t capacity;        // the size of the data behind the header
+    size_t used;
+
+} JSON_Arena_Chunk;
+
+typedef struct json_arena_t {
+    JSON_Arena_Chunk * chunks;      // the chunks in allocation order
+    JSON_Arena_Chunk * current;     // the chunk being bumped, the chunks behind it are free
+    size_t             chunk_size;
+
+} JSON_Arena;
+
+// JSON Iterator
+typedef struct json_iter_t {
+    const char * string;    // the iterated string, it is not owned by the iterator
+    size_t       length;
+    size_t       index;     // the index of the next value, or the index behind the last value
+    size_t       position;  // the count of the values or pairs got
+    int          state;
+
+} JSON_Iter;
+
+// JSON Array Position Index
+typedef struct json_array_index_t {
+    JSON_Iter frontier;     // the iterator behind the deepest scanned value
+    size_t    interval;     // the count of the values between the checkpoints
+    size_t    count;        // the count of the values, JSON_INDEX_NONE until the end of the array is scanned
+
+    size_t * checkpoints;   // checkpoints[k] is the start index of the (k * interval)-th value
+    size_t   size;
+    size_t   capacity;
+
+} JSON_Array_Index;
+
+// JSON Document
+#define JSON_DOCUMENT_PADDING 64    // the zero bytes behind the document, the vector loads could read them safely
+
+typedef struct json_document_t {
+    const char * string;    // the content followed by JSON_DOCUMENT_PADDING zero bytes, so it's also NUL-terminated
+    size_t       length;
+
+    void *       mapping;   // the mapped region, NULL if the content is read into the aligned buffer
+    size_t       mapping_size;
+
+} JSON_Document;
+
+// JSON Push Parser
+enum {
+    JSON_FEED_EVENT_VALUE,   // the number, string, boolean or null is complete
+    JSON_FEED_EVENT_START,   // the object or array is opened
+    JSON_FEED_EVENT_END      // the object or array is closed
+};
+
+// the path is the JS keys of the value, e.g. ["list"][0]["id"], the value is the JSON text of the value or the bracket
+// return non-zero to stop the parsing
+typedef int (*JSON_Feed_Callback)(void * user_data, const int event, const int jsonType, const char * path, const size_t path_length, const char * value, const size_t value_length);
+
+typedef struct json_feed_frame_t JSON_Feed_Frame;
+
+typedef struct json_feed_t {
+    JSON_Feed_Callback callback;
+    void *             user_data;
+
+    int    state;           // the expected token between the tokens
+    int    token;           // the token split by the chunk boundary
+    int    escape;          // the reverse solidus is the last character of the previous chunk
+    size_t offset;          // the stream offset of the next chunk
+    size_t token_offset;    // the stream offset of the token
+
+    char * buffer;          // the head of the token split by the chunk boundary
+    size_t buffer_size;
+    size_t buffer_capacity;
+
+    char * path;            // the path of the current value, NUL-terminated
+    size_t path_size;
+    size_t path_capacity;
+
+    JSON_Feed_Frame * frames;   // the open objects and arrays, the innermost one is the last
+    size_t            depth;
+    size_t            frames_capacity;
+
+} JSON_Feed;
+
+// JSON Lines Reader
+// the record callback is called in the worker threads at the same time, the tape and scratch arena belong to the worker
+// the tape string is the record, the scratch arena is reset after the result of the record is delivered
+// return non-zero to stop the reading
+typedef int (*JSON_Record_Callback)(void * user_data, const size_t record_index, const JSON_Tape * tape, JSON_Arena * scratch, void ** output_result);
+
+// the result callback is called one at a time, the error is NULL unless the record is malformed and skipped
+// return non-zero to stop the reading
+typedef int (*JSON_Result_Callback)(void * user_data, const size_t record_index, const JSON_Error * error, void * result);
+
+// JSON Path Cache
+typedef struct json_cache_entry_t JSON_Cache_Entry;
+typedef struct json_cache_step_t  JSON_Cache_Step;
+
+typedef struct json_cache_t {
+    const char * string;    // the looked up string, it is not owned by the cache
+    size_t       length;
+    size_t       startIndex;    // the start index of the root value of the paths
+
+    JSON_Cache_Entry * entries;     // the resolved prefixes
+    size_t             size;
+    size_t             capacity;    // the maximum count of the entries, the least recently used one is evicted
+    size_t             newest;      // the most recently used entry, JSON_INDEX_NONE if the cache is empty
+    size_t             oldest;      // the least recently used entry, JSON_INDEX_NONE if the cache is empty
+
+    size_t * buckets;       // the first entry of each hash chain, JSON_INDEX_NONE if the chain is empty
+    size_t   buckets_mask;
+
+    JSON_Cache_Step * steps;        // the steps of the keys being looked up
+    size_t            steps_capacity;
+    char *            prefix;       // the canonical form of the keys being looked up
+    size_t            prefix_capacity;
+
+} JSON_Cache;
+
+// JSON Intern Table
+typedef struct json_intern_slot_t JSON_Intern_Slot;
+
+typedef struct json_intern_t {
+    JSON_Arena * strings;       // the interned strings, they are kept until the table is freed
+    size_t       value_length;  // the maximum length of the interned values, the longer values are copied
+
+    JSON_Intern_Slot * slots;   // open addressing by the hash of the string
+    size_t             size;
+    size_t             capacity;
+
+} JSON_Intern;
+
 /*
  * 1. json_type_toString
  *
@@ -159,4 +422,1243 @@ int json_getKeyValuePairList(const char * input_string, const int input_string_s
  */
 int json_keyValuePair_free(JSON_Key_Value_Pair * keyValuePair);
 
+/*
+ * 9. json_number_toDouble_n
+ *
+ * Convert JSON number to double, the input string is bounded by length instead of '\0'.
+ *
+ * Parameters:
+ *  input_string             - the character pointer.
+ *  input_string_length      - the length of the string.
+ *  input_string_startIndex  - the start index of the string.
+ *  output_double            - the double pointer.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_number_toDouble_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, double * output_double);
+
+/*
+ * 10. json_string_toString_n
+ *
+ * Convert JSON string to character array, the input string is bounded by length instead of '\0'.
+ *
+ * Parameters:
+ *  input_string             - the character pointer.
+ *  input_string_length      - the length of the string.
+ *  input_string_startIndex  - the start index of the string.
+ *  output_string            - the character double pointer, the \u escapes are decoded to UTF-8.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_string_toString_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, char ** output_string);
+
+/*
+ * 11. json_getValueByJS_n
+ *
+ * Get value by Javascript Syntax with value start & end index and JSON type,
+ * the input string and keys are bounded by length instead of '\0'.
+ *
+ * Parameters:
+ *  input_string             - the character pointer.
+ *  input_string_length      - the length of the string.
+ *  input_string_startIndex  - the start index of the string.
+ *  input_keys               - the key of the value.
+ *  input_keys_length        - the length of the keys.
+ *  input_keys_startIndex    - the start index of key.
+ *  output_value_startIndex  - the size_t pointer, JSON_INDEX_NONE on failure.
+ *  output_value_endIndex    - the size_t pointer, JSON_INDEX_NONE on failure.
+ *  output_value_jsonType    - the integer pointer.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_getValueByJS_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, const char * input_keys, const size_t input_keys_length, const size_t input_keys_startIndex, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType);
+
+/*
+ * 12. json_object_getValueByKey_n
+ *
+ * Get value by key with value start & end index and JSON type,
+ * the input string is bounded by length instead of '\0'.
+ *
+ * Parameters:
+ *  input_string             - the character pointer.
+ *  input_string_length      - the length of the string.
+ *  input_string_startIndex  - the start index of the string.
+ *  input_key                - the key of the value.
+ *  input_key_startIndex     - the start index of key.
+ *  input_key_endIndex       - the end index of key.
+ *  output_value_startIndex  - the size_t pointer, JSON_INDEX_NONE on failure.
+ *  output_value_endIndex    - the size_t pointer, JSON_INDEX_NONE on failure.
+ *  output_value_jsonType    - the integer pointer.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_object_getValueByKey_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, const char * input_key, const size_t input_key_startIndex, const size_t input_key_endIndex, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType);
+
+/*
+ * 13. json_array_getValueByPosition_n
+ *
+ * Get array value by position with value start & end index and JSON type,
+ * the input string is bounded by length instead of '\0'.
+ *
+ * Parameters:
+ *  input_string             - the character pointer.
+ *  input_string_length      - the length of the string.
+ *  input_string_startIndex  - the start index of the string.
+ *  input_array_position     - the value position in array.
+ *  output_value_startIndex  - the size_t pointer, JSON_INDEX_NONE on failure.
+ *  output_value_endIndex    - the size_t pointer, JSON_INDEX_NONE on failure.
+ *  output_value_jsonType    - the integer pointer.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_array_getValueByPosition_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, const size_t input_array_position, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType);
+
+/*
+ * 14. json_getKeyValuePairList_n
+ *
+ * object or array get key value pair list, the input string is bounded by length instead of '\0'.
+ *
+ * Parameters:
+ *  input_string                  - the character pointer.
+ *  input_string_length           - the length of the string.
+ *  input_string_startIndex       - the start index of the string.
+ *  output_keyValuePairList       - the JSON_Key_Value_Pair double pointer.
+ *  output_keyValuePairList_size  - the size_t pointer.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_getKeyValuePairList_n(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size);
+
+/*
+ * 15. json_index_build
+ *
+ * Build the structural index of JSON string once, the index records the positions of the brackets,
+ * colons, commas, string quotes and the first character of the other values outside the strings.
+ * The string should be kept alive until the index is freed.
+ *
+ * Parameters:
+ *  input_string             - the character pointer.
+ *  input_string_length      - the length of the string.
+ *  output_index             - the JSON_Index double pointer.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure, the string is unterminated or the brackets are not matched
+ */
+int json_index_build(const char * input_string, const size_t input_string_length, JSON_Index ** output_index);
+
+/*
+ * 16. json_index_free
+ *
+ * Free the structural index.
+ *
+ * Parameters:
+ *  index - JSON_Index pointer.
+ *
+ * Returns:
+ *  always return 0
+ */
+int json_index_free(JSON_Index * index);
+
+/*
+ * 17. json_index_getValueByJS
+ *
+ * Get value by Javascript Syntax with value start & end index and JSON type,
+ * the lookup jumps from structural to structural by the index instead of scanning the string.
+ *
+ * Parameters:
+ *  index                    - the JSON_Index pointer.
+ *  input_string_startIndex  - the start index of the object or array in the string.
+ *  input_keys               - the key of the value.
+ *  input_keys_length        - the length of the keys.
+ *  output_value_startIndex  - the size_t pointer, JSON_INDEX_NONE on failure.
+ *  output_value_endIndex    - the size_t pointer, JSON_INDEX_NONE on failure.
+ *  output_value_jsonType    - the integer pointer.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_index_getValueByJS(const JSON_Index * index, const size_t input_string_startIndex, const char * input_keys, const size_t input_keys_length, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType);
+
+/*
+ * 18. json_index_object_getValueByKey
+ *
+ * Get value by key with value start & end index and JSON type by the structural index.
+ *
+ * Parameters:
+ *  index                    - the JSON_Index pointer.
+ *  input_string_startIndex  - the start index of the object in the string.
+ *  input_key                - the key of the value.
+ *  input_key_startIndex     - the start index of key.
+ *  input_key_endIndex       - the end index of key.
+ *  output_value_startIndex  - the size_t pointer, JSON_INDEX_NONE on failure.
+ *  output_value_endIndex    - the size_t pointer, JSON_INDEX_NONE on failure.
+ *  output_value_jsonType    - the integer pointer.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_index_object_getValueByKey(const JSON_Index * index, const size_t input_string_startIndex, const char * input_key, const size_t input_key_startIndex, const size_t input_key_endIndex, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType);
+
+/*
+ * 19. json_index_array_getValueByPosition
+ *
+ * Get array value by position with value start & end index and JSON type by the structural index.
+ *
+ * Parameters:
+ *  index                    - the JSON_Index pointer.
+ *  input_string_startIndex  - the start index of the array in the string.
+ *  input_array_position     - the value position in array.
+ *  output_value_startIndex  - the size_t pointer, JSON_INDEX_NONE on failure.
+ *  output_value_endIndex    - the size_t pointer, JSON_INDEX_NONE on failure.
+ *  output_value_jsonType    - the integer pointer.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_index_array_getValueByPosition(const JSON_Index * index, const size_t input_string_startIndex, const size_t input_array_position, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType);
+
+/*
+ * 20. json_parse_document
+ *
+ * Parse the JSON string to a flat tape in one pass, the string should be kept until the tape is freed.
+ * The object and array entry stores the tape index of its end entry, so the whole value can be skipped in one step,
+ * and the number is decoded while parsing. The root value is at tape index 0.
+ *
+ * Parameters:
+ *  input_string         - the JSON string.
+ *  input_string_length  - the length of the string.
+ *  output_tape          - the JSON_Tape pointer pointer, NULL on failure. Should be freed by json_tape_free.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_parse_document(const char * input_string, const size_t input_string_length, JSON_Tape ** output_tape);
+
+/*
+ * 21. json_tape_free
+ *
+ * Free the tape built by json_parse_document.
+ *
+ * Parameters:
+ *  tape - the JSON_Tape pointer, it could be NULL.
+ *
+ * Returns:
+ *   0 - success
+ */
+int json_tape_free(JSON_Tape * tape);
+
+/*
+ * 22. json_tape_getValueByJS
+ *
+ * Get the value tape index by Javascript Syntax.
+ *
+ * Parameters:
+ *  tape               - the JSON_Tape pointer.
+ *  input_tapeIndex    - the tape index of the object or array, 0 is the root value.
+ *  input_keys         - the key of the value.
+ *  input_keys_length  - the length of the keys.
+ *  output_tapeIndex   - the size_t pointer, JSON_INDEX_NONE on failure.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_tape_getValueByJS(const JSON_Tape * tape, const size_t input_tapeIndex, const char * input_keys, const size_t input_keys_length, size_t * output_tapeIndex);
+
+/*
+ * 23. json_tape_object_getValueByKey
+ *
+ * Get the value tape index by key.
+ *
+ * Parameters:
+ *  tape                  - the JSON_Tape pointer.
+ *  input_tapeIndex       - the tape index of the object.
+ *  input_key             - the key of the value.
+ *  input_key_startIndex  - the start index of key.
+ *  input_key_endIndex    - the end index of key.
+ *  output_tapeIndex      - the size_t pointer, JSON_INDEX_NONE on failure.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_tape_object_getValueByKey(const JSON_Tape * tape, const size_t input_tapeIndex, const char * input_key, const size_t input_key_startIndex, const size_t input_key_endIndex, size_t * output_tapeIndex);
+
+/*
+ * 24. json_tape_array_getValueByPosition
+ *
+ * Get the array value tape index by position.
+ *
+ * Parameters:
+ *  tape                  - the JSON_Tape pointer.
+ *  input_tapeIndex       - the tape index of the array.
+ *  input_array_position  - the value position in array.
+ *  output_tapeIndex      - the size_t pointer, JSON_INDEX_NONE on failure.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_tape_array_getValueByPosition(const JSON_Tape * tape, const size_t input_tapeIndex, const size_t input_array_position, size_t * output_tapeIndex);
+
+/*
+ * 25. json_tape_getValue
+ *
+ * Get the value start & end index in the string and JSON type of the tape index.
+ *
+ * Parameters:
+ *  tape                     - the JSON_Tape pointer.
+ *  input_tapeIndex          - the tape index of the value.
+ *  output_value_startIndex  - the size_t pointer, JSON_INDEX_NONE on failure.
+ *  output_value_endIndex    - the size_t pointer, JSON_INDEX_NONE on failure.
+ *  output_value_jsonType    - the integer pointer.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_tape_getValue(const JSON_Tape * tape, const size_t input_tapeIndex, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType);
+
+/*
+ * 26. json_tape_number_toDouble
+ *
+ * Get the number decoded by json_parse_document without parsing the string again.
+ *
+ * Parameters:
+ *  tape             - the JSON_Tape pointer.
+ *  input_tapeIndex  - the tape index of the number.
+ *  output_double    - the double pointer.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_tape_number_toDouble(const JSON_Tape * tape, const size_t input_tapeIndex, double * output_double);
+
+/*
+ * 27. json_lookup_create
+ *
+ * Create the lookup context of the string for the repeated lookups, the string should be kept until the context is freed.
+ * The lookups on the same object are counted by the object start index,
+ * the hash table from the key to the value is built when the count exceeds the threshold.
+ *
+ * Parameters:
+ *  input_string         - the JSON string.
+ *  input_string_length  - the length of the string.
+ *  input_threshold      - the count of the linear scan lookups on the same object before its hash table is built, 0 builds it at the first lookup.
+ *  output_lookup        - the JSON_Lookup pointer pointer, NULL on failure. Should be freed by json_lookup_free.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_lookup_create(const char * input_string, const size_t input_string_length, const size_t input_threshold, JSON_Lookup ** output_lookup);
+
+/*
+ * 28. json_lookup_free
+ *
+ * Free the lookup context and the hash tables.
+ *
+ * Parameters:
+ *  lookup - the JSON_Lookup pointer, it could be NULL.
+ *
+ * Returns:
+ *   0 - success
+ */
+int json_lookup_free(JSON_Lookup * lookup);
+
+/*
+ * 29. json_lookup_getValueByJS
+ *
+ * Get value by Javascript Syntax with value start & end index and JSON type, the object lookups go through the lookup context.
+ *
+ * Parameters:
+ *  lookup                   - the JSON_Lookup pointer.
+ *  input_string_startIndex  - the start index of the object or array in the string.
+ *  input_keys               - the key of the value.
+ *  input_keys_length        - the length of the keys.
+ *  output_value_startIndex  - the size_t pointer, JSON_INDEX_NONE on failure.
+ *  output_value_endIndex    - the size_t pointer, JSON_INDEX_NONE on failure.
+ *  output_value_jsonType    - the integer pointer.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_lookup_getValueByJS(JSON_Lookup * lookup, const size_t input_string_startIndex, const char * input_keys, const size_t input_keys_length, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType);
+
+/*
+ * 30. json_lookup_object_getValueByKey
+ *
+ * Get value by key with value start & end index and JSON type,
+ * the same as json_object_getValueByKey_n until the hash table of the object is built.
+ *
+ * Parameters:
+ *  lookup                   - the JSON_Lookup pointer.
+ *  input_string_startIndex  - the start index of the object in the string.
+ *  input_key                - the key of the value.
+ *  input_key_startIndex     - the start index of key.
+ *  input_key_endIndex       - the end index of key.
+ *  output_value_startIndex  - the size_t pointer, JSON_INDEX_NONE on failure.
+ *  output_value_endIndex    - the size_t pointer, JSON_INDEX_NONE on failure.
+ *  output_value_jsonType    - the integer pointer.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_lookup_object_getValueByKey(JSON_Lookup * lookup, const size_t input_string_startIndex, const char * input_key, const size_t input_key_startIndex, const size_t input_key_endIndex, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType);
+
+/*
+ * 31. json_path_compile
+ *
+ * Compile the Javascript Syntax keys to the reusable path, the keys are split, hashed and converted to positions once.
+ * The malformed keys are rejected here instead of on every evaluation.
+ *
+ * Parameters:
+ *  input_keys         - the key of the value, e.g. ["contents"][0]["quantity"].
+ *  input_keys_length  - the length of the keys.
+ *  output_path        - the JSON_Path pointer pointer, NULL on failure. Should be freed by json_path_free.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_path_compile(const char * input_keys, const size_t input_keys_length, JSON_Path ** output_path);
+
+/*
+ * 32. json_path_free
+ *
+ * Free the path compiled by json_path_compile.
+ *
+ * Parameters:
+ *  path - the JSON_Path pointer, it could be NULL.
+ *
+ * Returns:
+ *   0 - success
+ */
+int json_path_free(JSON_Path * path);
+
+/*
+ * 33. json_path_eval
+ *
+ * Get value by the compiled path with value start & end index and JSON type, the same as json_getValueByJS_n.
+ *
+ * Parameters:
+ *  path                     - the JSON_Path pointer.
+ *  input_string             - the JSON string.
+ *  input_string_length      - the length of the string.
+ *  input_string_startIndex  - the start index of the object or array in the string.
+ *  output_value_startIndex  - the size_t pointer, JSON_INDEX_NONE on failure.
+ *  output_value_endIndex    - the size_t pointer, JSON_INDEX_NONE on failure.
+ *  output_value_jsonType    - the integer pointer.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_path_eval(const JSON_Path * path, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType);
+
+/*
+ * 34. json_path_evalTape
+ *
+ * Get the value tape index by the compiled path, the compiled key hashes are compared with the tape directly.
+ *
+ * Parameters:
+ *  path              - the JSON_Path pointer.
+ *  tape              - the JSON_Tape pointer.
+ *  input_tapeIndex   - the tape index of the object or array, 0 is the root value.
+ *  output_tapeIndex  - the size_t pointer, JSON_INDEX_NONE on failure.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_path_evalTape(const JSON_Path * path, const JSON_Tape * tape, const size_t input_tapeIndex, size_t * output_tapeIndex);
+
+/*
+ * 35. json_path_compileSet
+ *
+ * Compile the Javascript Syntax keys list to the path set, the paths are merged into a prefix trie,
+ * so the shared prefix (e.g. ["contents"][0]) is walked once by json_path_evalSet.
+ *
+ * Parameters:
+ *  input_keys_list   - the keys array, each of them is a NULL-terminated string.
+ *  input_keys_count  - the count of the keys.
+ *  output_set        - the JSON_Path_Set pointer pointer, NULL on failure. Should be freed by json_path_freeSet.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure, one of the keys is malformed
+ */
+int json_path_compileSet(const char ** input_keys_list, const size_t input_keys_count, JSON_Path_Set ** output_set);
+
+/*
+ * 36. json_path_freeSet
+ *
+ * Free the path set compiled by json_path_compileSet.
+ *
+ * Parameters:
+ *  set - the JSON_Path_Set pointer, it could be NULL.
+ *
+ * Returns:
+ *   0 - success
+ */
+int json_path_freeSet(JSON_Path_Set * set);
+
+/*
+ * 37. json_path_evalSet
+ *
+ * Get the values of all paths in the set by one pass over the document,
+ * each object or array is scanned once and the scan stops when all requested children of it are found.
+ *
+ * Parameters:
+ *  set                      - the JSON_Path_Set pointer.
+ *  input_string             - the JSON string.
+ *  input_string_length      - the length of the string.
+ *  input_string_startIndex  - the start index of the object or array in the string.
+ *  output_values            - the JSON_Value_Range array with set->size elements, in the order of the keys.
+ *                             The value is JSON_INDEX_NONE and -1 type if the path is not found.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure, e.g. out of memory, all values are not found
+ */
+int json_path_evalSet(const JSON_Path_Set * set, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Value_Range * output_values);
+
+/*
+ * 38. json_arena_create
+ *
+ * Create the bump allocator, the memory is allocated in large chunks and released all at once by json_arena_reset.
+ *
+ * Parameters:
+ *  input_chunk_size  - the size of the chunk, 0 is 64 KiB. The larger allocation gets its own chunk.
+ *  output_arena      - the JSON_Arena pointer pointer, NULL on failure. Should be freed by json_arena_free.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_arena_create(const size_t input_chunk_size, JSON_Arena ** output_arena);
+
+/*
+ * 39. json_arena_alloc
+ *
+ * Allocate the memory in the arena, it's aligned to 16 bytes and shouldn't be freed.
+ *
+ * Parameters:
+ *  arena           - the JSON_Arena pointer.
+ *  input_size      - the size of the memory.
+ *  output_pointer  - the pointer of the memory, NULL on failure.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_arena_alloc(JSON_Arena * arena, const size_t input_size, void ** output_pointer);
+
+/*
+ * 40. json_arena_reset
+ *
+ * Release all allocations in the arena at once, the chunks are kept and reused by the next allocations.
+ *
+ * Parameters:
+ *  arena - the JSON_Arena pointer.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_arena_reset(JSON_Arena * arena);
+
+/*
+ * 41. json_arena_free
+ *
+ * Free the arena and its chunks.
+ *
+ * Parameters:
+ *  arena - the JSON_Arena pointer, it could be NULL.
+ *
+ * Returns:
+ *   0 - success
+ */
+int json_arena_free(JSON_Arena * arena);
+
+/*
+ * 42. json_object_getKeyValuePairList_arena
+ *
+ * Get the key value pair list of the object, the pairs, keys and values are allocated in the arena.
+ * The list should be released by json_arena_reset instead of json_keyValuePair_free.
+ *
+ * Parameters:
+ *  arena                         - the JSON_Arena pointer.
+ *  input_string                  - the JSON string.
+ *  input_string_length           - the length of the string.
+ *  input_string_startIndex       - the start index of the object.
+ *  output_keyValuePairList       - the JSON_Key_Value_Pair pointer pointer, NULL on failure.
+ *  output_keyValuePairList_size  - the size_t pointer, 0 on failure.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_object_getKeyValuePairList_arena(JSON_Arena * arena, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size);
+
+/*
+ * 43. json_array_getKeyValuePairList_arena
+ *
+ * Get the key value pair list of the array, the pairs, keys and values are allocated in the arena.
+ * The list should be released by json_arena_reset instead of json_keyValuePair_free.
+ *
+ * Parameters:
+ *  arena                         - the JSON_Arena pointer.
+ *  input_string                  - the JSON string.
+ *  input_string_length           - the length of the string.
+ *  input_string_startIndex       - the start index of the array.
+ *  output_keyValuePairList       - the JSON_Key_Value_Pair pointer pointer, NULL on failure.
+ *  output_keyValuePairList_size  - the size_t pointer, 0 on failure.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_array_getKeyValuePairList_arena(JSON_Arena * arena, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size);
+
+/*
+ * 44. json_getKeyValuePairList_arena
+ *
+ * Get the key value pair list of the object or array in the arena, the same as json_getKeyValuePairList_n.
+ * The list should be released by json_arena_reset instead of json_keyValuePair_free.
+ *
+ * Parameters:
+ *  arena                         - the JSON_Arena pointer.
+ *  input_string                  - the JSON string.
+ *  input_string_length           - the length of the string.
+ *  input_string_startIndex       - the start index of the object or array.
+ *  output_keyValuePairList       - the JSON_Key_Value_Pair pointer pointer, NULL on failure.
+ *  output_keyValuePairList_size  - the size_t pointer, 0 on failure.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_getKeyValuePairList_arena(JSON_Arena * arena, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size);
+
+/*
+ * 45. json_getKeyValueViewList
+ *
+ * Get the key value view list of the object or array without any allocation,
+ * the views refer to the offsets of the keys and values in the input string instead of copying them.
+ *
+ * Parameters:
+ *  input_string             - the JSON string.
+ *  input_string_length      - the length of the string.
+ *  input_string_startIndex  - the start index of the object or array.
+ *  output_views             - the JSON_Key_Value_View array, it could be NULL if the capacity is 0.
+ *  output_views_capacity    - the element count of the array.
+ *  output_views_size        - the size_t pointer, the count of the pairs, 0 on failure.
+ *                             Only the first capacity views are filled if it's greater than the capacity.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_getKeyValueViewList(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_View * output_views, const size_t output_views_capacity, size_t * output_views_size);
+
+/*
+ * 46. json_array_iter_init
+ *
+ * Initialize the array iterator, the values are got by json_array_iter_next in one forward pass without any allocation.
+ *
+ * Parameters:
+ *  iter                     - the JSON_Iter pointer, the string should be kept while iterating.
+ *  input_string             - the JSON string.
+ *  input_string_length      - the length of the string.
+ *  input_string_startIndex  - the start index of the array.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure, it's not an array
+ */
+int json_array_iter_init(JSON_Iter * iter, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex);
+
+/*
+ * 47. json_array_iter_next
+ *
+ * Get the next value of the array, iter->position is the count of the values got.
+ *
+ * Parameters:
+ *  iter                     - the JSON_Iter pointer initialized by json_array_iter_init.
+ *  output_value_startIndex  - the size_t pointer, JSON_INDEX_NONE if there is no value.
+ *  output_value_endIndex    - the size_t pointer, JSON_INDEX_NONE if there is no value.
+ *  output_value_jsonType    - the integer pointer.
+ *
+ * Returns:
+ *   0 - success
+ *   1 - it's the end of the array
+ *  -1 - failure, the array is invalid
+ */
+int json_array_iter_next(JSON_Iter * iter, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType);
+
+/*
+ * 48. json_object_iter_init
+ *
+ * Initialize the object iterator, the pairs are got by json_object_iter_next in one forward pass without any allocation.
+ *
+ * Parameters:
+ *  iter                     - the JSON_Iter pointer, the string should be kept while iterating.
+ *  input_string             - the JSON string.
+ *  input_string_length      - the length of the string.
+ *  input_string_startIndex  - the start index of the object.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure, it's not an object
+ */
+int json_object_iter_init(JSON_Iter * iter, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex);
+
+/*
+ * 49. json_object_iter_next
+ *
+ * Get the next key value pair of the object, iter->position is the count of the pairs got.
+ *
+ * Parameters:
+ *  iter                     - the JSON_Iter pointer initialized by json_object_iter_init.
+ *  output_key_startIndex    - the size_t pointer, the start index of the quoted key.
+ *  output_key_endIndex      - the size_t pointer, the end index of the quoted key.
+ *  output_value_startIndex  - the size_t pointer, JSON_INDEX_NONE if there is no pair.
+ *  output_value_endIndex    - the size_t pointer, JSON_INDEX_NONE if there is no pair.
+ *  output_value_jsonType    - the integer pointer.
+ *
+ * Returns:
+ *   0 - success
+ *   1 - it's the end of the object
+ *  -1 - failure, the object is invalid
+ */
+int json_object_iter_next(JSON_Iter * iter, size_t * output_key_startIndex, size_t * output_key_endIndex, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType);
+
+/*
+ * 50. json_array_index_create
+ *
+ * Create the position index of the array, it's built lazily and sparsely by json_array_index_getValueByPosition.
+ * The start index of every interval-th value is kept as a checkpoint when the array is scanned,
+ * so the lookup resumes from the closest checkpoint instead of the left square bracket.
+ *
+ * Parameters:
+ *  input_string             - the JSON string, it should be kept until the index is freed.
+ *  input_string_length      - the length of the string.
+ *  input_string_startIndex  - the start index of the array.
+ *  input_interval           - the count of the values between the checkpoints, 0 is 64.
+ *  output_index             - the JSON_Array_Index pointer pointer, NULL on failure. Should be freed by json_array_index_free.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure, it's not an array
+ */
+int json_array_index_create(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, const size_t input_interval, JSON_Array_Index ** output_index);
+
+/*
+ * 51. json_array_index_free
+ *
+ * Free the position index.
+ *
+ * Parameters:
+ *  index - the JSON_Array_Index pointer, it could be NULL.
+ *
+ * Returns:
+ *   0 - success
+ */
+int json_array_index_free(JSON_Array_Index * index);
+
+/*
+ * 52. json_array_index_getValueByPosition
+ *
+ * Get array value by position with value start & end index and JSON type, the same as json_array_getValueByPosition_n.
+ * The index grows when a deeper position than the scanned ones is requested.
+ *
+ * Parameters:
+ *  index                    - the JSON_Array_Index pointer.
+ *  input_array_position     - the value position in array.
+ *  output_value_startIndex  - the size_t pointer, JSON_INDEX_NONE on failure.
+ *  output_value_endIndex    - the size_t pointer, JSON_INDEX_NONE on failure.
+ *  output_value_jsonType    - the integer pointer.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_array_index_getValueByPosition(JSON_Array_Index * index, const size_t input_array_position, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType);
+
+/*
+ * 53. json_number_toInt64
+ *
+ * Convert JSON integer to int64 exactly, the digits are parsed 8 at a time.
+ *
+ * Parameters:
+ *  input_string             - the JSON string.
+ *  input_string_length      - the length of the string.
+ *  input_string_startIndex  - the start index of the number.
+ *  output_int64             - the int64 pointer, 0 on failure.
+ *  output_error             - the integer pointer of JSON_NUMBER_ERROR_XXX, it could be NULL.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure, it's not a number, the number has fraction or exponent, or it's out of range
+ */
+int json_number_toInt64(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, int64_t * output_int64, int * output_error);
+
+/*
+ * 54. json_number_toUInt64
+ *
+ * Convert JSON integer to uint64 exactly, the negative integer except -0 is out of range.
+ *
+ * Parameters:
+ *  input_string             - the JSON string.
+ *  input_string_length      - the length of the string.
+ *  input_string_startIndex  - the start index of the number.
+ *  output_uint64            - the uint64 pointer, 0 on failure.
+ *  output_error             - the integer pointer of JSON_NUMBER_ERROR_XXX, it could be NULL.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure, it's not a number, the number has fraction or exponent, or it's out of range
+ */
+int json_number_toUInt64(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, uint64_t * output_uint64, int * output_error);
+
+/*
+ * 55. json_getInt64ByJS
+ *
+ * Get the integer by JS with json_getValueByJS_n and convert it by json_number_toInt64.
+ *
+ * Parameters:
+ *  input_string             - the JSON string.
+ *  input_string_length      - the length of the string.
+ *  input_string_startIndex  - the start index of the JSON string.
+ *  input_keys               - the key of the value.
+ *  input_keys_length        - the length of the keys.
+ *  output_int64             - the int64 pointer, 0 on failure.
+ *  output_error             - the integer pointer of JSON_NUMBER_ERROR_XXX, it could be NULL.
+ *                             JSON_NUMBER_ERROR_NOT_NUMBER if the value is not found or not a number.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_getInt64ByJS(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, const char * input_keys, const size_t input_keys_length, int64_t * output_int64, int * output_error);
+
+/*
+ * 56. json_string_unescape
+ *
+ * Unescape JSON string into the buffer without allocation, the \u escapes and surrogate pairs are decoded to UTF-8.
+ * The lone surrogate is replaced by U+FFFD.
+ *
+ * Parameters:
+ *  input_string             - the JSON string.
+ *  input_string_length      - the length of the string.
+ *  input_string_startIndex  - the start index of the string (quotation mark).
+ *  output_buffer            - the character buffer, it's terminated by '\0' on success. It could be NULL if the size is 0.
+ *  output_buffer_size       - the size of the buffer.
+ *  output_length            - the size_t pointer, the length of the unescaped string without '\0'.
+ *
+ * Returns:
+ *   0 - success
+ *   1 - the buffer is too small, the needed size is output_length + 1
+ *  -1 - failure, it's not a string
+ */
+int json_string_unescape(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, char * output_buffer, const size_t output_buffer_size, size_t * output_length);
+
+/*
+ * 57. json_string_getSlice
+ *
+ * Get the characters of JSON string in the input string if there is no escape, nothing is copied.
+ *
+ * Parameters:
+ *  input_string             - the JSON string.
+ *  input_string_length      - the length of the string.
+ *  input_string_startIndex  - the start index of the string (quotation mark).
+ *  output_slice             - the character pointer pointer, it points to the first character behind the quotation mark. NULL if it's escaped.
+ *  output_slice_length      - the size_t pointer, the length of the characters. The unescaped length if it's escaped.
+ *
+ * Returns:
+ *   0 - success
+ *   1 - the string is escaped, it should be unescaped by json_string_unescape
+ *  -1 - failure, it's not a string
+ */
+int json_string_getSlice(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, const char ** output_slice, size_t * output_slice_length);
+
+/*
+ * 58. json_getLastError
+ *
+ * Get the last failure of the calling thread, the library doesn't print anything unless it's compiled with -DJSON_DEBUG.
+ * The error is kept until the next failure, so it's valid only if the last call failed.
+ *
+ * Parameters:
+ *  output_error - the JSON_Error pointer.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_getLastError(JSON_Error * output_error);
+
+/*
+ * 59. json_error_toString
+ *
+ * Convert JSON error code to string.
+ *
+ * Parameters:
+ *  code - JSON_ERROR_XXX.
+ *
+ * Returns:
+ *  error description
+ */
+const char * json_error_toString(int code);
+
+/*
+ * 60. json_feed_create
+ *
+ * Create the push parser of one JSON document received in chunks, the chunks are passed to json_feed in order.
+ * The values are reported to the callback with their paths as soon as they are complete,
+ * only the token split by the chunk boundary and the path are kept by the parser.
+ *
+ * Parameters:
+ *  input_callback   - the callback of the values, it could be NULL to validate the document only.
+ *  input_user_data  - the pointer passed to the callback.
+ *  output_feed      - the JSON_Feed pointer pointer, NULL on failure. Should be freed by json_feed_free.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_feed_create(JSON_Feed_Callback input_callback, void * input_user_data, JSON_Feed ** output_feed);
+
+/*
+ * 61. json_feed
+ *
+ * Parse the next chunk of the document, the chunk needs no NUL terminator and could be released after the call.
+ * The path and value passed to the callback are valid during the callback only.
+ *
+ * Parameters:
+ *  feed          - the JSON_Feed pointer.
+ *  input_chunk   - the chunk of the document.
+ *  input_length  - the length of the chunk.
+ *
+ * Returns:
+ *   0 - success
+ *   1 - the parsing is stopped by the callback
+ *  -1 - failure, the error offset is the stream offset
+ */
+int json_feed(JSON_Feed * feed, const char * input_chunk, const size_t input_length);
+
+/*
+ * 62. json_feed_end
+ *
+ * Finish the document, the number at the end of the stream is reported and the document should be complete.
+ *
+ * Parameters:
+ *  feed - the JSON_Feed pointer.
+ *
+ * Returns:
+ *   0 - success
+ *   1 - the parsing is stopped by the callback
+ *  -1 - failure, the document is incomplete
+ */
+int json_feed_end(JSON_Feed * feed);
+
+/*
+ * 63. json_feed_free
+ *
+ * Free the push parser.
+ *
+ * Parameters:
+ *  feed - the JSON_Feed pointer, it could be NULL.
+ *
+ * Returns:
+ *   0 - success
+ */
+int json_feed_free(JSON_Feed * feed);
+
+/*
+ * 64. json_lines_read
+ *
+ * Read the newline-delimited JSON records (NDJSON or JSON Lines) by the worker threads.
+ * The records are handed to the workers in batches, every record is parsed to the worker's reusable tape and passed to the record callback,
+ * then its result is passed to the result callback. The malformed record is reported to the result callback with the error and skipped,
+ * the blank line is skipped silently. The record index is the line index from 0, the error offset is the offset in the input string.
+ * The threads are not used if the library is compiled with -DJSON_THREADS=0.
+ *
+ * Parameters:
+ *  input_string         - the JSON Lines string.
+ *  input_string_length  - the length of the string.
+ *  input_threads        - the count of the threads including the calling thread, 0 is the count of the online processors.
+ *  input_ordered        - 1 to get the results in the record order, 0 to get the results as soon as they are ready.
+ *  input_process        - the record callback, it could be NULL to deliver NULL results.
+ *  input_deliver        - the result callback, it could be NULL.
+ *  input_user_data      - the pointer passed to the callbacks.
+ *
+ * Returns:
+ *   0 - success
+ *   1 - the reading is stopped by the callback
+ *  -1 - failure
+ */
+int json_lines_read(const char * input_string, const size_t input_string_length, const size_t input_threads, const int input_ordered, JSON_Record_Callback input_process, JSON_Result_Callback input_deliver, void * input_user_data);
+
+/*
+ * 65. json_document_open
+ *
+ * Load the JSON file, the regular file is mapped read-only with the sequential access hint,
+ * the pipe or the file which can't be mapped is read into an aligned buffer.
+ * Either way the content is followed by JSON_DOCUMENT_PADDING zero bytes.
+ *
+ * Parameters:
+ *  input_path       - the path of the file.
+ *  output_document  - the JSON_Document pointer pointer, NULL on failure. Should be freed by json_document_close.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_document_open(const char * input_path, JSON_Document ** output_document);
+
+/*
+ * 66. json_document_close
+ *
+ * Unmap or free the content of the document.
+ *
+ * Parameters:
+ *  document - the JSON_Document pointer, it could be NULL.
+ *
+ * Returns:
+ *   0 - success
+ */
+int json_document_close(JSON_Document * document);
+
+/*
+ * 67. json_array_getKeyValuePairList_parallel
+ *
+ * Get the key value pair list of the array by the threads, the same as json_getKeyValuePairList_n for the array.
+ * The array is split into chunks, the element boundaries of each chunk are found speculatively and confirmed by the chunk before it,
+ * then each thread gets the pairs of its chunk and the lists are linked in order.
+ * The array is got in the calling thread if it's small, or the boundaries can't be confirmed, or the library is compiled with -DJSON_THREADS=0.
+ *
+ * Parameters:
+ *  input_string                  - the JSON string.
+ *  input_string_length           - the length of the string.
+ *  input_string_startIndex       - the start index of the array.
+ *  input_threads                 - the count of the threads including the calling thread, 0 is the count of the online processors.
+ *  output_keyValuePairList       - the JSON_Key_Value_Pair pointer pointer, NULL on failure. Should be freed by json_keyValuePair_free.
+ *  output_keyValuePairList_size  - the size_t pointer, 0 on failure.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_array_getKeyValuePairList_parallel(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, const size_t input_threads, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size);
+
+/*
+ * 68. json_path_evalBatch
+ *
+ * Get the values of all paths in the set for each document by the threads, the same as json_path_evalSet on each document.
+ * Each thread takes the documents from its own queue, and steals the upper half of another queue when its queue is empty,
+ * so the threads are kept busy when the document sizes vary widely.
+ * The documents are evaluated in the calling thread if the library is compiled with -DJSON_THREADS=0.
+ *
+ * Parameters:
+ *  set              - the JSON_Path_Set pointer.
+ *  input_strings    - the JSON strings, the leading whitespace of each document is skipped. The NULL document has no value.
+ *  input_lengths    - the lengths of the strings, it could be NULL if the strings are NUL-terminated.
+ *  input_count      - the count of the documents.
+ *  input_threads    - the count of the threads including the calling thread, 0 is the count of the online processors.
+ *  output_values    - the JSON_Value_Range matrix with input_count * set->size elements,
+ *                     the value of path p in document d is output_values[d * set->size + p].
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure, e.g. out of memory, all values of all documents are not found
+ */
+int json_path_evalBatch(const JSON_Path_Set * set, const char * const * input_strings, const size_t * input_lengths, const size_t input_count, const size_t input_threads, JSON_Value_Range * output_values);
+
+/*
+ * 69. json_cache_create
+ *
+ * Create the path cache of the string, the string should be kept until the cache is freed.
+ * The cache keeps the resolved value of each key prefix, e.g. ["contents"] and ["contents"][3] of ["contents"][3]["productID"],
+ * so the lookup of ["contents"][3]["productName"] after it starts from ["contents"][3].
+ *
+ * Parameters:
+ *  input_string             - the JSON string.
+ *  input_string_length      - the length of the string.
+ *  input_string_startIndex  - the start index of the object or array which the paths start from.
+ *  input_capacity           - the maximum count of the cached prefixes, 0 is JSON_CACHE_CAPACITY (256).
+ *  output_cache             - the JSON_Cache pointer pointer, NULL on failure. Should be freed by json_cache_free.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_cache_create(const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, const size_t input_capacity, JSON_Cache ** output_cache);
+
+/*
+ * 70. json_cache_free
+ *
+ * Free the path cache and the cached prefixes.
+ *
+ * Parameters:
+ *  cache - the JSON_Cache pointer, it could be NULL.
+ *
+ * Returns:
+ *   0 - success
+ */
+int json_cache_free(JSON_Cache * cache);
+
+/*
+ * 71. json_cache_getValueByJS
+ *
+ * Get value by Javascript Syntax with value start & end index and JSON type, the same as json_getValueByJS_n from the start index of the cache.
+ * The lookup starts from the longest cached prefix of the keys, and the prefixes resolved after it are cached.
+ * The prefixes are compared by the key sequence, so the keys built at runtime are matched as well, e.g. [03] is the same as [3].
+ *
+ * Parameters:
+ *  cache                    - the JSON_Cache pointer.
+ *  input_keys               - the key of the value, e.g. ["contents"][3]["productName"].
+ *  input_keys_length        - the length of the keys.
+ *  output_value_startIndex  - the size_t pointer, JSON_INDEX_NONE on failure.
+ *  output_value_endIndex    - the size_t pointer, JSON_INDEX_NONE on failure.
+ *  output_value_jsonType    - the integer pointer.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_cache_getValueByJS(JSON_Cache * cache, const char * input_keys, const size_t input_keys_length, size_t * output_value_startIndex, size_t * output_value_endIndex, int * output_value_jsonType);
+
+/*
+ * 72. json_intern_create
+ *
+ * Create the intern table, it could be shared by the calls of json_getKeyValuePairList_intern on the same or different strings.
+ * Each distinct string is stored once, so the interned strings are equal if and only if their pointers are equal.
+ * The table isn't thread-safe.
+ *
+ * Parameters:
+ *  input_value_length  - the maximum length of the interned values (including the quotes of the strings), 0 is JSON_INTERN_VALUE_LENGTH (32).
+ *  output_intern       - the JSON_Intern pointer pointer, NULL on failure. Should be freed by json_intern_free.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_intern_create(const size_t input_value_length, JSON_Intern ** output_intern);
+
+/*
+ * 73. json_intern_free
+ *
+ * Free the intern table and the interned strings, the lists got with the table should not be used after it.
+ *
+ * Parameters:
+ *  intern - the JSON_Intern pointer, it could be NULL.
+ *
+ * Returns:
+ *   0 - success
+ */
+int json_intern_free(JSON_Intern * intern);
+
+/*
+ * 74. json_intern_string
+ *
+ * Get the interned copy of the string, the copy is added if the string isn't interned yet.
+ * The keys of the pairs are interned with the quotes, e.g. "productID" should be interned as "\"productID\"" to compare with them.
+ *
+ * Parameters:
+ *  intern                - the JSON_Intern pointer.
+ *  input_string          - the string.
+ *  input_string_length   - the length of the string.
+ *  output_string         - the const char pointer pointer, the NUL-terminated copy kept by the table, NULL on failure.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_intern_string(JSON_Intern * intern, const char * input_string, const size_t input_string_length, const char ** output_string);
+
+/*
+ * 75. json_object_getKeyValuePairList_intern
+ *
+ * The same as json_object_getKeyValuePairList_arena, but the keys and the values not longer than the value length of the table are interned.
+ * The pairs and the longer values are in the arena, the interned strings are kept by the table and should not be modified.
+ * The list should be released by json_arena_reset instead of json_keyValuePair_free.
+ *
+ * Parameters:
+ *  arena                         - the JSON_Arena pointer.
+ *  intern                        - the JSON_Intern pointer.
+ *  input_string                  - the JSON string.
+ *  input_string_length           - the length of the string.
+ *  input_string_startIndex       - the start index of the object.
+ *  output_keyValuePairList       - the JSON_Key_Value_Pair pointer pointer, NULL on failure.
+ *  output_keyValuePairList_size  - the size_t pointer, 0 on failure.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_object_getKeyValuePairList_intern(JSON_Arena * arena, JSON_Intern * intern, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size);
+
+/*
+ * 76. json_array_getKeyValuePairList_intern
+ *
+ * The same as json_array_getKeyValuePairList_arena, but the position keys and the values not longer than the value length of the table are interned.
+ * The list should be released by json_arena_reset instead of json_keyValuePair_free.
+ *
+ * Parameters:
+ *  arena                         - the JSON_Arena pointer.
+ *  intern                        - the JSON_Intern pointer.
+ *  input_string                  - the JSON string.
+ *  input_string_length           - the length of the string.
+ *  input_string_startIndex       - the start index of the array.
+ *  output_keyValuePairList       - the JSON_Key_Value_Pair pointer pointer, NULL on failure.
+ *  output_keyValuePairList_size  - the size_t pointer, 0 on failure.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_array_getKeyValuePairList_intern(JSON_Arena * arena, JSON_Intern * intern, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size);
+
+/*
+ * 77. json_getKeyValuePairList_intern
+ *
+ * The same as json_getKeyValuePairList_arena, but the keys and the short values are interned.
+ * The list should be released by json_arena_reset instead of json_keyValuePair_free.
+ *
+ * Parameters:
+ *  arena                         - the JSON_Arena pointer.
+ *  intern                        - the JSON_Intern pointer.
+ *  input_string                  - the JSON string.
+ *  input_string_length           - the length of the string.
+ *  input_string_startIndex       - the start index of the object or array.
+ *  output_keyValuePairList       - the JSON_Key_Value_Pair pointer pointer, NULL on failure.
+ *  output_keyValuePairList_size  - the size_t pointer, 0 on failure.
+ *
+ * Returns:
+ *   0 - success
+ *  -1 - failure
+ */
+int json_getKeyValuePairList_intern(JSON_Arena * arena, JSON_Intern * intern, const char * input_string, const size_t input_string_length, const size_t input_string_startIndex, JSON_Key_Value_Pair ** output_keyValuePairList, size_t * output_keyValuePairList_size);
+
 #endif
@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
+#include <inttypes.h>
 #include "../src/JSON2C.h"
 
 #define stringify(s...) #s
@@ -33,6 +34,26 @@ void test_json_util_getNextCharacter();
 void test_json_util_allocSubstring();
 void test_json_util_allocStringByInteger();
 void test_json_getKeyValuePairList();
+void test_json_getValueByJS_n();
+void test_json_index_getValueByJS();
+void test_json_tape_getValueByJS();
+void test_json_lookup_getValueByJS();
+void test_json_path_eval();
+void test_json_path_evalSet();
+void test_json_getKeyValuePairList_arena();
+void test_json_getKeyValueViewList();
+void test_json_iter_next();
+void test_json_array_index_getValueByPosition();
+void test_json_number_toInt64();
+void test_json_string_unescape();
+void test_json_getLastError();
+void test_json_feed();
+void test_json_lines_read();
+void test_json_document_open();
+void test_json_array_getKeyValuePairList_parallel();
+void test_json_path_evalBatch();
+void test_json_cache_getValueByJS();
+void test_json_getKeyValuePairList_intern();
 
 /* Main */
 int main() {
@@ -56,6 +77,26 @@ int main() {
     test_json_getKeyValuePairList();
     test_json_number_toDouble();
     test_json_string_toString();
+    test_json_getValueByJS_n();
+    test_json_index_getValueByJS();
+    test_json_tape_getValueByJS();
+    test_json_lookup_getValueByJS();
+    test_json_path_eval();
+    test_json_path_evalSet();
+    test_json_getKeyValuePairList_arena();
+    test_json_getKeyValueViewList();
+    test_json_iter_next();
+    test_json_array_index_getValueByPosition();
+    test_json_number_toInt64();
+    test_json_string_unescape();
+    test_json_getLastError();
+    test_json_feed();
+    test_json_lines_read();
+    test_json_document_open();
+    test_json_array_getKeyValuePairList_parallel();
+    test_json_path_evalBatch();
+    test_json_cache_getValueByJS();
+    test_json_getKeyValuePairList_intern();
     return EXIT_SUCCESS;
 }
 
@@ -169,7 +210,12 @@ void test_json_getString() {
         "\"abc\\u1a34\"",
         "\"abc\\u1A3456\"",
         "\"abc\\u12s4\"",
-        "\"abc\\u1234\\u1234abc\""
+        "\"abc\\u1234\\u1234abc\"",
+        "\"caf\xc3\xa9 \xe2\x82\xac \xf0\x9f\x98\x80\"",   /*   UTF-8              */
+        "\"abc\xc3\"",                  /*   truncated UTF-8    */
+        "\"abc\xc0\xaf\"",              /*   overlong encoding  */
+        "\"abc\xed\xa0\x80\"",          /*   surrogate          */
+        "\"a long string value which is longer than 32 characters\\n\""
     };
 
     int i, startIndex, endIndex;
@@ -266,7 +312,10 @@ void test_json_getBoolean() {
         "fabc",
         "",
         "t",
-        "f"
+        "f",
+        "tru",
+        "fals",
+        "falsetrue"
     };
 
     int i, startIndex, endIndex;
@@ -299,7 +348,9 @@ void test_json_getNull() {
         "null",
         "n",
         "nullabc",
-        ""
+        "",
+        "nul",
+        "nil"
     };
 
     int i, startIndex, endIndex;
@@ -405,7 +456,11 @@ void test_json_getValue() {
         "[12345[12345[12345",
         "[12345[12345[12345]]]",
         "[12345[12345]]]]",
-        "[12345[[[12345]]]"
+        "[12345[[[12345]]]",
+        "{\"a}b\": \"}\"}",
+        "{\"a\\\"}\": 1}",
+        "{\"a\": \"}",
+        "[\"]\", \"\\\\\", [\"[\"]]"
     };
 
     int i, startIndex, endIndex, jsonType;
@@ -469,7 +524,8 @@ void test_json_util_getNextCharacter() {
         "        a         b",
         "c       d     ",
         "abc",
-        "a    b   bcd   "
+        "a    b   bcd   ",
+        "\t\r\n                                    e"
     };
 
     int i;
@@ -488,6 +544,12 @@ void test_json_util_getNextCharacter() {
         puts("");
     }
 
+    // the non-printable character is not whitespace
+    int j = 0;
+    if (json_util_getNextCharacter("  \x01  a", &j) == 0) {
+        printf("    0x%02x at %d\n\n", "  \x01  a"[j], j);
+    }
+
     puts("================================================================================\n");
 }
 
@@ -991,7 +1053,12 @@ void test_json_number_toDouble() {
         "0ee",
         "",
         "0.0eabc",
-        "0.0e-abc"
+        "0.0e-abc",
+        "9007199254740993",
+        "123456789012345678901234567890",
+        "0.30000000000000004e1",
+        "1e400",
+        "-1e-400"
     };
 
     int i;
@@ -1056,3 +1123,1372 @@ void test_json_string_toString() {
 
     puts("================================================================================\n");
 }
+
+void test_json_getValueByJS_n() {
+    puts("Test json_getValueByJS_n");
+    puts("================================================================================");
+
+    const char * fileName = "sample.json";
+    char * string; // need to be free
+    if (convertFileToString(fileName, &string) != 0) {
+        printf("convert file '%s' to string failure\n", fileName);
+        return;
+    }
+
+    // copy to a buffer without '\0' at the end
+    size_t length = strlen(string);
+    char * buffer = malloc(length);
+    if (buffer == NULL) {
+        free(string);
+        return;
+    }
+    memcpy(buffer, string, length);
+    free(string);
+
+    char * keys[100] = {
+        "[\"contents\"]",
+        "[\"contents\"][1][\"productName\"]",
+        "[\"contents\"][2]",
+        "[\"orderCompleted\"]",
+        "[\"orderID\"]"
+    };
+
+    int i;
+    for (i = 0; keys[i] != NULL; i++) {
+        puts("--------------------------------------------------------------------------------");
+        printf("%2d. KEY (%zu) = %s\n", i + 1, strlen(keys[i]), keys[i]);
+
+        size_t valueStartIndex, valueEndIndex;
+        int valueJsonType;
+        if (json_getValueByJS_n(buffer, length, 0, keys[i], strlen(keys[i]), 0, &valueStartIndex, &valueEndIndex, &valueJsonType) != 0) {
+            printf("%s is not found\n\n", keys[i]);
+            continue;
+        }
+
+        printf("    VALUE (%s) [%zu..%zu] = %.*s\n\n", json_type_toString(valueJsonType), valueStartIndex, valueEndIndex, (int) (valueEndIndex - valueStartIndex + 1), buffer + valueStartIndex);
+    }
+
+    // the document is truncated by length
+    size_t valueStartIndex, valueEndIndex;
+    int valueJsonType;
+    const char * key = "[\"orderCompleted\"]";
+    if (json_getValueByJS_n(buffer, length - 10, 0, key, strlen(key), 0, &valueStartIndex, &valueEndIndex, &valueJsonType) != 0) {
+        printf("%s is not found in the first %zu bytes\n\n", key, length - 10);
+    }
+
+    free(buffer);
+    puts("================================================================================\n");
+}
+
+void test_json_index_getValueByJS() {
+    puts("Test json_index_getValueByJS");
+    puts("================================================================================");
+
+    const char * fileName = "sample.json";
+    char * string; // need to be free
+    if (convertFileToString(fileName, &string) != 0) {
+        printf("convert file '%s' to string failure\n", fileName);
+        return;
+    }
+
+    JSON_Index * index;
+    if (json_index_build(string, strlen(string), &index) != 0) {
+        puts("json_index_build failure");
+        free(string);
+        return;
+    }
+    printf("%s has %zu structurals\n\n", fileName, index->size);
+
+    char * keys[100] = {
+        "[\"contents\"]",
+        "[\"contents\"][0]",
+        "[\"contents\"][2]",
+        "[\"contents\"][0][\"productName\"]",
+        "[]",
+        "[0]",
+        "[\"orderID\"]",
+        "[\"contents\"][1][\"quantity\"]",
+        "[\"orderCompleted\"]"
+    };
+
+    int i;
+    for (i = 0; keys[i] != NULL; i++) {
+        puts("--------------------------------------------------------------------------------");
+        printf("%2d. KEY (%zu) = %s\n", i + 1, strlen(keys[i]), keys[i]);
+
+        size_t valueStartIndex, valueEndIndex;
+        int valueJsonType;
+        if (json_index_getValueByJS(index, 0, keys[i], strlen(keys[i]), &valueStartIndex, &valueEndIndex, &valueJsonType) != 0) {
+            printf("%s is not found\n\n", keys[i]);
+            continue;
+        }
+
+        printf("    VALUE (%s) = %.*s\n\n", json_type_toString(valueJsonType), (int) (valueEndIndex - valueStartIndex + 1), string + valueStartIndex);
+    }
+
+    json_index_free(index);
+    free(string);
+
+    // brackets and escaped quotes inside the strings
+    const char * str[100] = {
+        "{\"a}b\": [1, \"]\"], \"c\\\\\\\"}\": {\"d\": \"{[\\\\\"}, \"e\": null}",
+        "{\"a\": \"unterminated}",
+        "{\"a\": [1, 2}",
+        "[{\"a\": 1}, [\"}\"], \"\\\\\\\\\", 2.5e3, false]"
+    };
+
+    for (i = 0; str[i] != NULL; i++) {
+        puts("--------------------------------------------------------------------------------");
+        printf("%2d. %s\n", i + 1, str[i]);
+
+        if (json_index_build(str[i], strlen(str[i]), &index) != 0) {
+            puts("    json_index_build failure\n");
+            continue;
+        }
+
+        size_t j, valueStartIndex, valueEndIndex;
+        int valueJsonType;
+        for (j = 0; ; j++) {
+            char key[16];
+            sprintf(key, "[%zu]", j);
+            if (json_index_getValueByJS(index, 0, key, strlen(key), &valueStartIndex, &valueEndIndex, &valueJsonType) != 0) {
+                break;
+            }
+            printf("    %s (%s) = %.*s\n", key, json_type_toString(valueJsonType), (int) (valueEndIndex - valueStartIndex + 1), str[i] + valueStartIndex);
+        }
+
+        const char * keys[] = { "[\"a}b\"]", "[\"c\\\\\\\"}\"][\"d\"]", "[\"e\"]", NULL };
+        for (j = 0; keys[j] != NULL; j++) {
+            if (json_index_getValueByJS(index, 0, keys[j], strlen(keys[j]), &valueStartIndex, &valueEndIndex, &valueJsonType) == 0) {
+                printf("    %s (%s) = %.*s\n", keys[j], json_type_toString(valueJsonType), (int) (valueEndIndex - valueStartIndex + 1), str[i] + valueStartIndex);
+            }
+        }
+        puts("");
+        json_index_free(index);
+    }
+
+    puts("================================================================================\n");
+}
+
+void test_json_tape_getValueByJS() {
+    puts("Test json_tape_getValueByJS");
+    puts("================================================================================");
+
+    const char * fileName = "sample.json";
+    char * string; // need to be free
+    if (convertFileToString(fileName, &string) != 0) {
+        printf("convert file '%s' to string failure\n", fileName);
+        return;
+    }
+
+    JSON_Tape * tape;
+    if (json_parse_document(string, strlen(string), &tape) != 0) {
+        puts("json_parse_document failure");
+        free(string);
+        return;
+    }
+    printf("%s has %zu tape entries\n\n", fileName, tape->size);
+
+    char * keys[100] = {
+        "[\"contents\"]",
+        "[\"contents\"][0]",
+        "[\"contents\"][2]",
+        "[\"contents\"][0][\"productName\"]",
+        "[]",
+        "[0]",
+        "[\"orderID\"]",
+        "[\"contents\"][1][\"quantity\"]",
+        "[\"orderCompleted\"]"
+    };
+
+    int i;
+    for (i = 0; keys[i] != NULL; i++) {
+        puts("--------------------------------------------------------------------------------");
+        printf("%2d. KEY (%zu) = %s\n", i + 1, strlen(keys[i]), keys[i]);
+
+        size_t tapeIndex, valueStartIndex, valueEndIndex;
+        int valueJsonType;
+        if (json_tape_getValueByJS(tape, 0, keys[i], strlen(keys[i]), &tapeIndex) != 0 ||
+            json_tape_getValue(tape, tapeIndex, &valueStartIndex, &valueEndIndex, &valueJsonType) != 0) {
+            printf("%s is not found\n\n", keys[i]);
+            continue;
+        }
+
+        printf("    VALUE (%s) = %.*s\n", json_type_toString(valueJsonType), (int) (valueEndIndex - valueStartIndex + 1), string + valueStartIndex);
+
+        double number;
+        if (json_tape_number_toDouble(tape, tapeIndex, &number) == 0) {
+            printf("    NUMBER = %g\n", number);
+        }
+        puts("");
+    }
+
+    json_tape_free(tape);
+    free(string);
+
+    // brackets inside the strings, numbers and invalid documents
+    const char * str[100] = {
+        "{\"a}b\": [1, \"]\"], \"c\\\\\\\"}\": {\"d\": \"{[\\\\\"}, \"e\": null}",
+        "[-0, 9223372036854775807, -9223372036854775808, 18446744073709551616, 2.5e3, true]",
+        "{\"a\": [1, 2}",
+        "{\"a\": 1,}",
+        "[1] 2"
+    };
+
+    for (i = 0; str[i] != NULL; i++) {
+        puts("--------------------------------------------------------------------------------");
+        printf("%2d. %s\n", i + 1, str[i]);
+
+        if (json_parse_document(str[i], strlen(str[i]), &tape) != 0) {
+            puts("    json_parse_document failure\n");
+            continue;
+        }
+
+        size_t j, tapeIndex, valueStartIndex, valueEndIndex;
+        int valueJsonType;
+        for (j = 0; ; j++) {
+            char key[16];
+            sprintf(key, "[%zu]", j);
+            if (json_tape_getValueByJS(tape, 0, key, strlen(key), &tapeIndex) != 0) {
+                break;
+            }
+            json_tape_getValue(tape, tapeIndex, &valueStartIndex, &valueEndIndex, &valueJsonType);
+            printf("    %s (%s) = %.*s", key, json_type_toString(valueJsonType), (int) (valueEndIndex - valueStartIndex + 1), str[i] + valueStartIndex);
+
+            double number;
+            if (json_tape_number_toDouble(tape, tapeIndex, &number) == 0) {
+                printf(" (%g)", number);
+            }
+            puts("");
+        }
+
+        const char * keys[] = { "[\"a}b\"][1]", "[\"c\\\\\\\"}\"][\"d\"]", "[\"e\"]", NULL };
+        for (j = 0; keys[j] != NULL; j++) {
+            if (json_tape_getValueByJS(tape, 0, keys[j], strlen(keys[j]), &tapeIndex) == 0) {
+                json_tape_getValue(tape, tapeIndex, &valueStartIndex, &valueEndIndex, &valueJsonType);
+                printf("    %s (%s) = %.*s\n", keys[j], json_type_toString(valueJsonType), (int) (valueEndIndex - valueStartIndex + 1), str[i] + valueStartIndex);
+            }
+        }
+        puts("");
+        json_tape_free(tape);
+    }
+
+    puts("================================================================================\n");
+}
+
+void test_json_lookup_getValueByJS() {
+    puts("Test json_lookup_getValueByJS");
+    puts("================================================================================");
+
+    const char * fileName = "sample.json";
+    char * string; // need to be free
+    if (convertFileToString(fileName, &string) != 0) {
+        printf("convert file '%s' to string failure\n", fileName);
+        return;
+    }
+
+    // the hash table is built at the second lookup on the same object
+    JSON_Lookup * lookup;
+    if (json_lookup_create(string, strlen(string), 1, &lookup) != 0) {
+        puts("json_lookup_create failure");
+        free(string);
+        return;
+    }
+
+    char * keys[100] = {
+        "[\"contents\"][0][\"productName\"]",
+        "[\"orderID\"]",
+        "[\"contents\"][0][\"quantity\"]",
+        "[\"shopperName\"]",
+        "[\"contents\"][0][\"productID\"]",
+        "[\"unknown\"]",
+        "[\"orderCompleted\"]"
+    };
+
+    int i;
+    for (i = 0; keys[i] != NULL; i++) {
+        puts("--------------------------------------------------------------------------------");
+        printf("%2d. KEY (%zu) = %s\n", i + 1, strlen(keys[i]), keys[i]);
+
+        size_t valueStartIndex, valueEndIndex;
+        int valueJsonType;
+        if (json_lookup_getValueByJS(lookup, 0, keys[i], strlen(keys[i]), &valueStartIndex, &valueEndIndex, &valueJsonType) != 0) {
+            printf("%s is not found\n\n", keys[i]);
+            continue;
+        }
+
+        printf("    VALUE (%s) = %.*s\n\n", json_type_toString(valueJsonType), (int) (valueEndIndex - valueStartIndex + 1), string + valueStartIndex);
+    }
+
+    printf("%zu objects are looked up\n\n", lookup->size);
+
+    json_lookup_free(lookup);
+    free(string);
+
+    // the first one of the duplicate keys is found by both linear scan and hash table
+    const char * str = "{\"a\": 1, \"b\": 2, \"a\": 3}";
+    if (json_lookup_create(str, strlen(str), 1, &lookup) == 0) {
+        puts("--------------------------------------------------------------------------------");
+        printf("%s\n", str);
+
+        for (i = 0; i < 3; i++) {
+            size_t valueStartIndex, valueEndIndex;
+            int valueJsonType;
+            if (json_lookup_getValueByJS(lookup, 0, "[\"a\"]", 5, &valueStartIndex, &valueEndIndex, &valueJsonType) == 0) {
+                printf("    [\"a\"] (%s) = %.*s\n", json_type_toString(valueJsonType), (int) (valueEndIndex - valueStartIndex + 1), str + valueStartIndex);
+            }
+        }
+        puts("");
+        json_lookup_free(lookup);
+    }
+
+    puts("================================================================================\n");
+}
+
+void test_json_path_eval() {
+    puts("Test json_path_eval");
+    puts("================================================================================");
+
+    const char * fileName = "sample.json";
+    char * string; // need to be free
+    if (convertFileToString(fileName, &string) != 0) {
+        printf("convert file '%s' to string failure\n", fileName);
+        return;
+    }
+
+    JSON_Tape * tape;
+    if (json_parse_document(string, strlen(string), &tape) != 0) {
+        puts("json_parse_document failure");
+        free(string);
+        return;
+    }
+
+    char * keys[100] = {
+        "[\"contents\"][0][\"quantity\"]",
+        "[\"contents\"][1][\"productName\"]",
+        "[\"contents\"][2]",
+        "[\"orderID\"]",
+        "[]",
+        "[\"orderID\"",
+        "[\"contents\"][x]",
+        "[\"contents\"][99999999999999999999999]"
+    };
+
+    int i;
+    for (i = 0; keys[i] != NULL; i++) {
+        puts("--------------------------------------------------------------------------------");
+        printf("%2d. KEY (%zu) = %s\n", i + 1, strlen(keys[i]), keys[i]);
+
+        JSON_Path * path;
+        if (json_path_compile(keys[i], strlen(keys[i]), &path) != 0) {
+            puts("    json_path_compile failure\n");
+            continue;
+        }
+        printf("    %zu steps\n", path->size);
+
+        size_t valueStartIndex, valueEndIndex, tapeIndex;
+        int valueJsonType;
+        if (json_path_eval(path, string, strlen(string), 0, &valueStartIndex, &valueEndIndex, &valueJsonType) != 0) {
+            printf("    %s is not found\n", keys[i]);
+        } else {
+            printf("    VALUE (%s) = %.*s\n", json_type_toString(valueJsonType), (int) (valueEndIndex - valueStartIndex + 1), string + valueStartIndex);
+        }
+
+        if (json_path_evalTape(path, tape, 0, &tapeIndex) != 0) {
+            printf("    %s is not found in tape\n\n", keys[i]);
+        } else {
+            json_tape_getValue(tape, tapeIndex, &valueStartIndex, &valueEndIndex, &valueJsonType);
+            printf("    TAPE VALUE (%s) = %.*s\n\n", json_type_toString(valueJsonType), (int) (valueEndIndex - valueStartIndex + 1), string + valueStartIndex);
+        }
+
+        json_path_free(path);
+    }
+
+    json_tape_free(tape);
+    free(string);
+
+    puts("================================================================================\n");
+}
+
+void test_json_path_evalSet() {
+    puts("Test json_path_evalSet");
+    puts("================================================================================");
+
+    const char * fileName = "sample.json";
+    char * string; // need to be free
+    if (convertFileToString(fileName, &string) != 0) {
+        printf("convert file '%s' to string failure\n", fileName);
+        return;
+    }
+
+    const char * keys[] = {
+        "[\"orderID\"]",
+        "[\"contents\"][0][\"productName\"]",
+        "[\"contents\"][0][\"quantity\"]",
+        "[\"contents\"][1][\"productName\"]",
+        "[\"contents\"][2][\"productName\"]",
+        "[\"contents\"]",
+        "[\"orderID\"]",
+        "[\"unknown\"]"
+    };
+    const size_t count = sizeof(keys) / sizeof(keys[0]);
+
+    JSON_Path_Set * set;
+    if (json_path_compileSet(keys, count, &set) != 0) {
+        puts("json_path_compileSet failure");
+        free(string);
+        return;
+    }
+    printf("%zu paths are merged into %zu nodes\n\n", set->size, set->nodes_size);
+
+    JSON_Value_Range values[sizeof(keys) / sizeof(keys[0])];
+    if (json_path_evalSet(set, string, strlen(string), 0, values) != 0) {
+        puts("json_path_evalSet failure");
+    }
+
+    size_t i;
+    for (i = 0; i < count; i++) {
+        puts("--------------------------------------------------------------------------------");
+        printf("%2zu. KEY (%zu) = %s\n", i + 1, strlen(keys[i]), keys[i]);
+
+        if (values[i].jsonType == -1) {
+            printf("%s is not found\n\n", keys[i]);
+            continue;
+        }
+
+        printf("    VALUE (%s) = %.*s\n\n", json_type_toString(values[i].jsonType), (int) (values[i].endIndex - values[i].startIndex + 1), string + values[i].startIndex);
+    }
+
+    json_path_freeSet(set);
+    free(string);
+
+    // the malformed key is rejected
+    const char * invalid_keys[] = { "[\"a\"]", "[\"b\"" };
+    if (json_path_compileSet(invalid_keys, 2, &set) != 0) {
+        puts("json_path_compileSet failure (malformed key)\n");
+    }
+
+    puts("================================================================================\n");
+}
+
+void test_json_getKeyValuePairList_arena() {
+    puts("Test json_getKeyValuePairList_arena");
+    puts("================================================================================");
+
+    const char * str[100] = {
+        stringify([1, 2, 3, 4, 5, 6]),
+        stringify([true, false, null, {"name": "hello"}, [1,2,3,4,5], "hello"]),
+        stringify({"name": "Leon",  "age": 25, "sex": "male"}),
+        stringify({"hello": "world", error: [123]})
+    };
+
+    // the small chunk size makes the lists span several chunks
+    JSON_Arena * arena;
+    if (json_arena_create(256, &arena) != 0) {
+        puts("json_arena_create failure");
+        return;
+    }
+
+    int round;
+    for (round = 1; round <= 2; round++) {
+        int i;
+        for (i = 0; str[i] != NULL; i++) {
+            printf("\nRound_%d Case_%d :\n", round, i + 1);
+            puts("--------------------------------------------------------------------------------");
+            JSON_Key_Value_Pair * root;
+            size_t size;
+            if (json_getKeyValuePairList_arena(arena, str[i], strlen(str[i]), 0, &root, &size) != 0) {
+                puts("json_getKeyValuePairList_arena failure");
+                printf("str[%d] = %s\n", i, str[i]);
+                continue;
+            }
+
+            printf("size = %zu\n", size);
+
+            int j = 0;
+            JSON_Key_Value_Pair * ptr;
+            for (ptr = root; ptr != NULL; ptr = ptr->next) {
+                printf("%2d. key (%s) = %s\n", ++j, json_type_toString(ptr->key_type), ptr->key);
+                printf("    val (%s) = %s\n", json_type_toString(ptr->value_type), ptr->value);
+            }
+        }
+
+        // the chunks are kept by the reset
+        int chunks = 0;
+        JSON_Arena_Chunk * chunk;
+        for (chunk = arena->chunks; chunk != NULL; chunk = chunk->next) {
+            chunks++;
+        }
+        printf("\n%d chunks\n", chunks);
+
+        json_arena_reset(arena);
+    }
+
+    json_arena_free(arena);
+
+    puts("================================================================================\n");
+}
+
+void test_json_getKeyValueViewList() {
+    puts("Test json_getKeyValueViewList");
+    puts("================================================================================");
+
+    const char * str[100] = {
+        stringify([true, false, null, {"name": "hello"}, [1,2,3,4,5], "hello"]),
+        stringify({"name": "Leon",  "age": 25, "sex": "male"}),
+        "{\"a\\\"b\": 1, \"c\": [2, 3]}",
+        stringify({"hello": "world", error: [123]})
+    };
+
+    int i;
+    for (i = 0; str[i] != NULL; i++) {
+        printf("\nCase_%d :\n", i + 1);
+        puts("--------------------------------------------------------------------------------");
+
+        // 1. only count the pairs
+        size_t size;
+        if (json_getKeyValueViewList(str[i], strlen(str[i]), 0, NULL, 0, &size) != 0) {
+            puts("json_getKeyValueViewList failure");
+            printf("str[%d] = %s\n", i, str[i]);
+            continue;
+        }
+
+        printf("size = %zu\n", size);
+
+        // 2. fill the views
+        JSON_Key_Value_View views[16];
+        json_getKeyValueViewList(str[i], strlen(str[i]), 0, views, 16, &size);
+
+        size_t j;
+        for (j = 0; j < size; j++) {
+            if (views[j].key_type == JSON_TYPE_STRING) {
+                printf("%2zu. key (%s%s) = %.*s\n", j + 1, json_type_toString(views[j].key_type), views[j].key_escaped ? ", escaped" : "", (int) views[j].key_length, str[i] + views[j].key_startIndex);
+            } else {
+                printf("%2zu. key (%s) = %zu\n", j + 1, json_type_toString(views[j].key_type), j);
+            }
+            printf("    val (%s) = %.*s\n", json_type_toString(views[j].value_type), (int) views[j].value_length, str[i] + views[j].value_startIndex);
+        }
+    }
+
+    puts("================================================================================\n");
+}
+
+void test_json_iter_next() {
+    puts("Test json_array_iter_next & json_object_iter_next");
+    puts("================================================================================");
+
+    const char * str[100] = {
+        stringify([true, false, null, {"name": "hello"}, [1,2,3,4,5], "hello"]),
+        stringify([]),
+        stringify([1, 2,, 3]),
+        stringify({"name": "Leon",  "age": 25, "sex": "male"}),
+        stringify({}),
+        stringify({"hello": "world", error: [123]})
+    };
+
+    int i;
+    for (i = 0; str[i] != NULL; i++) {
+        printf("\nCase_%d : %s\n", i + 1, str[i]);
+        puts("--------------------------------------------------------------------------------");
+
+        JSON_Iter iter;
+        int result;
+        size_t keyStartIndex, keyEndIndex, valueStartIndex, valueEndIndex;
+        int valueJsonType;
+
+        if (json_array_iter_init(&iter, str[i], strlen(str[i]), 0) == 0) {
+            while ((result = json_array_iter_next(&iter, &valueStartIndex, &valueEndIndex, &valueJsonType)) == 0) {
+                printf("%2zu. val (%s) = %.*s\n", iter.position, json_type_toString(valueJsonType), (int) (valueEndIndex - valueStartIndex + 1), str[i] + valueStartIndex);
+            }
+        } else if (json_object_iter_init(&iter, str[i], strlen(str[i]), 0) == 0) {
+            while ((result = json_object_iter_next(&iter, &keyStartIndex, &keyEndIndex, &valueStartIndex, &valueEndIndex, &valueJsonType)) == 0) {
+                printf("%2zu. key = %.*s\n", iter.position, (int) (keyEndIndex - keyStartIndex + 1), str[i] + keyStartIndex);
+                printf("    val (%s) = %.*s\n", json_type_toString(valueJsonType), (int) (valueEndIndex - valueStartIndex + 1), str[i] + valueStartIndex);
+            }
+        } else {
+            puts("it's not an object or array");
+            continue;
+        }
+
+        printf("%s at %zu\n", result == 1 ? "end" : "failure", iter.index);
+    }
+
+    puts("================================================================================\n");
+}
+
+void test_json_array_index_getValueByPosition() {
+    puts("Test json_array_index_getValueByPosition");
+    puts("================================================================================");
+
+    // [0, 1, 2, ..., 999]
+    char * string = malloc(8 * 1000 + 2);
+    if (string == NULL) {
+        puts("out of memory");
+        return;
+    }
+
+    size_t length = 0;
+    int i;
+    string[length++] = '[';
+    for (i = 0; i < 1000; i++) {
+        length += sprintf(string + length, i == 0 ? "%d" : ", %d", i);
+    }
+    string[length++] = ']';
+    string[length] = '\0';
+
+    JSON_Array_Index * index;
+    if (json_array_index_create(string, length, 0, 64, &index) != 0) {
+        puts("json_array_index_create failure");
+        free(string);
+        return;
+    }
+
+    size_t positions[] = { 700, 5, 130, 999, 1000, 64, 701 };
+    size_t j;
+    for (j = 0; j < sizeof(positions) / sizeof(positions[0]); j++) {
+        size_t valueStartIndex, valueEndIndex;
+        int valueJsonType;
+        if (json_array_index_getValueByPosition(index, positions[j], &valueStartIndex, &valueEndIndex, &valueJsonType) != 0) {
+            printf("[%zu] is not found", positions[j]);
+        } else {
+            printf("[%zu] (%s) = %.*s", positions[j], json_type_toString(valueJsonType), (int) (valueEndIndex - valueStartIndex + 1), string + valueStartIndex);
+        }
+
+        if (index->count == JSON_INDEX_NONE) {
+            printf(", %zu checkpoints\n", index->size);
+        } else {
+            printf(", %zu checkpoints, %zu values\n", index->size, index->count);
+        }
+    }
+
+    json_array_index_free(index);
+    free(string);
+
+    puts("================================================================================\n");
+}
+
+void test_json_number_toInt64() {
+    puts("Test json_number_toInt64");
+    puts("================================================================================");
+
+    const char * error_string[] = { "none", "not number", "not integer", "overflow" };
+
+    char * str[100] = {
+        "0",
+        "-0",
+        "123",
+        "-123abc",
+        "0123",
+        "12345678",
+        "123456789012",
+        "1234567890123456789",
+        "9223372036854775807",
+        "9223372036854775808",
+        "-9223372036854775808",
+        "-9223372036854775809",
+        "18446744073709551615",
+        "18446744073709551616",
+        "123456789012345678901234567890",
+        "1.5",
+        "1.",
+        "2e3",
+        "2e",
+        "-",
+        "abc"
+    };
+
+    int i;
+    for (i = 0; str[i] != NULL; i++) {
+        const size_t length = strlen(str[i]);
+        int64_t int64;
+        uint64_t uint64;
+        int error;
+
+        printf("%d. %s: ", i + 1, str[i]);
+        if (json_number_toInt64(str[i], length, 0, &int64, &error) != 0) {
+            printf("int64 %s, ", error_string[error]);
+        } else {
+            printf("int64 %" PRId64 ", ", int64);
+        }
+
+        if (json_number_toUInt64(str[i], length, 0, &uint64, &error) != 0) {
+            printf("uint64 %s\n", error_string[error]);
+        } else {
+            printf("uint64 %" PRIu64 "\n", uint64);
+        }
+    }
+
+    const char * json = stringify({ "id": 12345678901234, "price": 9.5, "name": "abc" });
+    const char * keys[] = { "[\"id\"]", "[\"price\"]", "[\"name\"]", "[\"none\"]" };
+    for (i = 0; i < 4; i++) {
+        int64_t int64;
+        int error;
+        if (json_getInt64ByJS(json, strlen(json), 0, keys[i], strlen(keys[i]), &int64, &error) != 0) {
+            printf("%s: %s\n", keys[i], error_string[error]);
+        } else {
+            printf("%s = %" PRId64 "\n", keys[i], int64);
+        }
+    }
+
+    puts("================================================================================\n");
+}
+
+void test_json_string_unescape() {
+    puts("Test json_string_unescape");
+    puts("================================================================================");
+
+    char * str[100] = {
+        "\"hello world\"",
+        "\"\"",
+        "\"a long string without any escape character\"",
+        "\"tab\\tnew line\\nquote\\\"slash\\/\"",
+        "\"caf\\u00e9 \\u20AC\"",
+        "\"smile \\ud83d\\ude00\"",
+        "\"lone \\ud83d surrogate\"",
+        "\"bad \\u12G4\"",
+        "\"bad \\x\"",
+        "\"not terminated",
+        "\"control \x01 character\""
+    };
+
+    int i;
+    for (i = 0; str[i] != NULL; i++) {
+        const size_t length = strlen(str[i]);
+        char buffer[64];
+        size_t buffer_length;
+        const char * slice;
+        size_t slice_length;
+
+        printf("%d. ", i + 1);
+
+        int result = json_string_getSlice(str[i], length, 0, &slice, &slice_length);
+        if (result == 0) {
+            printf("slice (%zu) = %.*s\n", slice_length, (int) slice_length, slice);
+            continue;
+        }
+
+        if (result == -1 || json_string_unescape(str[i], length, 0, buffer, sizeof(buffer), &buffer_length) != 0) {
+            printf("%s is not string\n", str[i]);
+            continue;
+        }
+
+        printf("unescape (%zu) =", buffer_length);
+        size_t j;
+        for (j = 0; j < buffer_length; j++) {
+            printf(" %02x", (unsigned char) buffer[j]);
+        }
+        puts("");
+    }
+
+    // the needed size is returned if the buffer is too small
+    char buffer[4];
+    size_t buffer_length;
+    int result = json_string_unescape(str[4], strlen(str[4]), 0, buffer, sizeof(buffer), &buffer_length);
+    printf("small buffer: %d, %zu\n", result, buffer_length);
+
+    puts("================================================================================\n");
+}
+
+void test_json_getLastError() {
+    puts("Test json_getLastError");
+    puts("================================================================================");
+
+    char * str = "{\"a\": [1, 2, 3], \"b\": {\"c\": tru}}";
+    char * keys[100] = {
+        "[\"a\"][1]",
+        "[\"a\"][5]",
+        "[\"x\"]",
+        "[\"b\"][\"c\"]",
+        "[\"a\"][18446744073709551617]",
+        "[\"a\"",
+        NULL
+    };
+
+    const size_t length = strlen(str);
+    int i;
+    for (i = 0; keys[i] != NULL; i++) {
+        size_t startIndex, endIndex;
+        int jsonType;
+        JSON_Error error;
+
+        int result = json_getValueByJS_n(str, length, 0, keys[i], strlen(keys[i]), 0, &startIndex, &endIndex, &jsonType);
+        json_getLastError(&error);
+
+        if (result == 0) {
+            printf("%d. %s = [%zu..%zu]\n", i + 1, keys[i], startIndex, endIndex);
+        } else if (error.offset == JSON_INDEX_NONE) {
+            printf("%d. %s: %s\n", i + 1, keys[i], json_error_toString(error.code));
+        } else {
+            printf("%d. %s: %s at %zu\n", i + 1, keys[i], json_error_toString(error.code), error.offset);
+        }
+    }
+
+    // invalid argument is reported without printing anything
+    JSON_Error error;
+    int result = json_getValueByJS_n(NULL, 0, 0, keys[0], strlen(keys[0]), 0, NULL, NULL, NULL);
+    json_getLastError(&error);
+    printf("null string: %d, %s\n", result, json_error_toString(error.code));
+
+    // the index, tape and lookup (hash table) report the same errors as the string
+    char * valid = "{\"a\": [1, 2, 3], \"b\": {\"c\": true}}";
+    char * valid_keys[100] = {
+        "[\"a\"][5]",
+        "[\"x\"]",
+        "[\"b\"][\"c\"][\"d\"]",
+        "[\"a\"][\"b\"]",
+        NULL
+    };
+
+    const size_t valid_length = strlen(valid);
+    JSON_Index * index = NULL;
+    JSON_Tape * tape = NULL;
+    JSON_Lookup * lookup = NULL;
+    if (json_index_build(valid, valid_length, &index) != 0 || json_parse_document(valid, valid_length, &tape) != 0 || json_lookup_create(valid, valid_length, 0, &lookup) != 0) {
+        puts("create failure");
+    } else {
+        for (i = 0; valid_keys[i] != NULL; i++) {
+            size_t startIndex, endIndex, tapeIndex;
+            int jsonType;
+            const size_t keys_length = strlen(valid_keys[i]);
+
+            printf("%s:", valid_keys[i]);
+
+            json_getValueByJS_n(valid, valid_length, 0, valid_keys[i], keys_length, 0, &startIndex, &endIndex, &jsonType);
+            json_getLastError(&error);
+            printf(" string %s at %zu,", json_error_toString(error.code), error.offset);
+
+            json_index_getValueByJS(index, 0, valid_keys[i], keys_length, &startIndex, &endIndex, &jsonType);
+            json_getLastError(&error);
+            printf(" index %s at %zu,", json_error_toString(error.code), error.offset);
+
+            json_tape_getValueByJS(tape, 0, valid_keys[i], keys_length, &tapeIndex);
+            json_getLastError(&error);
+            printf(" tape %s at %zu,", json_error_toString(error.code), error.offset);
+
+            json_lookup_getValueByJS(lookup, 0, valid_keys[i], keys_length, &startIndex, &endIndex, &jsonType);
+            json_getLastError(&error);
+            printf(" lookup %s at %zu\n", json_error_toString(error.code), error.offset);
+        }
+    }
+
+    json_index_free(index);
+    json_tape_free(tape);
+    json_lookup_free(lookup);
+
+    puts("================================================================================\n");
+}
+
+int test_json_feed_callback(void * user_data, const int event, const int jsonType, const char * path, const size_t path_length, const char * value, const size_t value_length) {
+    const char * events[] = { "value", "start", "end" };
+    printf("  %-5s %-7s %.*s = %.*s\n", events[event], json_type_toString(jsonType), (int) path_length, path, (int) value_length, value);
+
+    // stop at the value if it's asked
+    const char * stop = user_data;
+    return stop != NULL && strlen(stop) == path_length && strncmp(stop, path, path_length) == 0;
+}
+
+void test_json_feed() {
+    puts("Test json_feed");
+    puts("================================================================================");
+
+    char * str[100] = {
+        "{\"name\": \"caf\\u00e9\", \"list\": [1, -2.5e3, true, null, [], {}], \"nested\": {\"ok\": false}}",
+        "  [\"a\", 12345678901234567890, \"b\\\"c\"]  ",
+        "-0.5",
+        "{\"a\": [1, 2,]}",
+        "{\"a\": tru}",
+        "[1, 2",
+        NULL
+    };
+
+    // the chunk boundaries split the tokens
+    int i;
+    for (i = 0; str[i] != NULL; i++) {
+        JSON_Feed * feed;
+        if (json_feed_create(test_json_feed_callback, NULL, &feed) != 0) {
+            continue;
+        }
+
+        printf("%d. %s\n", i + 1, str[i]);
+
+        const size_t length = strlen(str[i]);
+        int result = 0;
+        size_t j;
+        for (j = 0; j < length && result == 0; j += 3) {
+            result = json_feed(feed, str[i] + j, length - j < 3 ? length - j : 3);
+        }
+        if (result == 0) {
+            result = json_feed_end(feed);
+        }
+
+        JSON_Error error;
+        json_getLastError(&error);
+        if (result == 0) {
+            puts("  complete");
+        } else {
+            printf("  %s at %zu\n", json_error_toString(error.code), error.offset);
+        }
+
+        json_feed_free(feed);
+    }
+
+    // the callback stops the parsing
+    JSON_Feed * feed;
+    if (json_feed_create(test_json_feed_callback, "[\"list\"][1]", &feed) == 0) {
+        int result = json_feed(feed, str[0], strlen(str[0]));
+        printf("stop: %d\n", result);
+        json_feed_free(feed);
+    }
+
+    puts("================================================================================\n");
+}
+
+int test_json_lines_read_process(void * user_data, const size_t record_index, const JSON_Tape * tape, JSON_Arena * scratch, void ** output_result) {
+    (void) user_data;
+    (void) record_index;
+
+    // the result is the name of the record in the scratch arena
+    size_t tapeIndex, startIndex, endIndex;
+    int jsonType;
+    if (json_tape_getValueByJS(tape, 0, "[\"name\"]", 8, &tapeIndex) != 0 || json_tape_getValue(tape, tapeIndex, &startIndex, &endIndex, &jsonType) != 0) {
+        *output_result = NULL;
+        return 0;
+    }
+
+    char * name;
+    if (json_arena_alloc(scratch, endIndex - startIndex + 2, (void **) &name) != 0) {
+        return -1;
+    }
+    memcpy(name, tape->string + startIndex, endIndex - startIndex + 1);
+    name[endIndex - startIndex + 1] = '\0';
+
+    *output_result = name;
+    return 0;
+}
+
+int test_json_lines_read_deliver(void * user_data, const size_t record_index, const JSON_Error * error, void * result) {
+    (void) user_data;
+
+    if (error != NULL) {
+        printf("  line %zu: %s at %zu\n", record_index, json_error_toString(error->code), error->offset);
+    } else {
+        printf("  line %zu: %s\n", record_index, result != NULL ? (char *) result : "(no name)");
+    }
+    return 0;
+}
+
+typedef struct test_json_lines_count_t {
+    size_t records;
+    size_t malformed;
+    size_t wrong_names;
+    size_t out_of_order;
+    size_t next;            // the record index expected next in the ordered mode
+} Test_Json_Lines_Count;
+
+int test_json_lines_read_count(void * user_data, const size_t record_index, const JSON_Error * error, void * result) {
+    Test_Json_Lines_Count * counter = user_data;
+    counter->records++;
+    counter->out_of_order += record_index != counter->next;
+    counter->next = record_index + 1;
+
+    // the name of the record is "r" and the record index
+    char name[32];
+    sprintf(name, "\"r%zu\"", record_index);
+    if (error != NULL) {
+        counter->malformed++;
+    } else if (result == NULL || strcmp(result, name) != 0) {
+        counter->wrong_names++;
+    }
+    return 0;
+}
+
+void test_json_lines_read() {
+    puts("Test json_lines_read");
+    puts("================================================================================");
+
+    char * str = "{\"name\": \"alice\", \"age\": 30}\n"
+                 "{\"name\": \"bob\", \"age\": }\n"
+                 "\n"
+                 "{\"name\": \"carol\"}\r\n"
+                 "[1, 2, 3]\n"
+                 "{\"name\": \"dave\"}";
+
+    // the input is smaller than a batch, it's read in the calling thread
+    int result = json_lines_read(str, strlen(str), 4, 1, test_json_lines_read_process, test_json_lines_read_deliver, NULL);
+    printf("result: %d\n", result);
+
+    // the 40000 records are split into several batches, every 1000th record is malformed, every 3rd line ends with CRLF
+    const size_t count = 40000;
+    char * lines = malloc(count * 48 + 1);
+    if (lines == NULL) {
+        return;
+    }
+
+    size_t length = 0;
+    size_t i;
+    for (i = 0; i < count; i++) {
+        if (i % 1000 == 999) {
+            length += sprintf(lines + length, "{\"name\": \"r%zu\", \"value\": }", i);
+        } else {
+            length += sprintf(lines + length, "{\"name\": \"r%zu\", \"value\": [%zu]}", i, i % 7);
+        }
+        length += sprintf(lines + length, i % 3 == 0 ? "\r\n" : "\n");
+    }
+
+    // the results are delivered in the record order in the ordered mode, and in any order otherwise
+    int ordered;
+    for (ordered = 1; ordered >= 0; ordered--) {
+        Test_Json_Lines_Count counter = { 0 };
+        result = json_lines_read(lines, length, 4, ordered, test_json_lines_read_process, test_json_lines_read_count, &counter);
+        printf("ordered %d, %zu batches: result %d, records %zu, malformed %zu, wrong names %zu",
+               ordered, length / (64 * 1024) + 1, result, counter.records, counter.malformed, counter.wrong_names);
+        if (ordered) {
+            printf(", out of order %zu", counter.out_of_order);
+        }
+        puts("");
+    }
+
+    free(lines);
+
+    puts("================================================================================\n");
+}
+
+void test_json_document_open() {
+    puts("Test json_document_open");
+    puts("================================================================================");
+
+    const char * fileName = "sample.json";
+
+    char * string; // need to be free
+    if (convertFileToString(fileName, &string) != 0) {
+        printf("convert file '%s' to string failure\n", fileName);
+        return;
+    }
+
+    // the mapped document is the same as the file content, and it's followed by the zero padding
+    JSON_Document * document;
+    if (json_document_open(fileName, &document) != 0) {
+        printf("open file '%s' failure\n", fileName);
+        free(string);
+        return;
+    }
+
+    int padding = 1;
+    size_t i;
+    for (i = 0; i < JSON_DOCUMENT_PADDING; i++) {
+        padding = padding && document->string[document->length + i] == '\0';
+    }
+
+    printf("%s (%zu): same content %d, zero padding %d\n", fileName, document->length, document->length == strlen(string) && memcmp(document->string, string, document->length) == 0, padding);
+
+    size_t startIndex, endIndex;
+    int jsonType;
+    if (json_getValueByJS_n(document->string, document->length, 0, "[\"shopperName\"]", 15, 0, &startIndex, &endIndex, &jsonType) == 0) {
+        printf("[\"shopperName\"] = %.*s\n", (int) (endIndex - startIndex + 1), document->string + startIndex);
+    }
+
+    json_document_close(document);
+    free(string);
+
+    // the missing file
+    JSON_Error error;
+    int result = json_document_open("missing.json", &document);
+    json_getLastError(&error);
+    printf("missing.json: %d, %s\n", result, json_error_toString(error.code));
+
+    puts("================================================================================\n");
+}
+
+void test_json_array_getKeyValuePairList_parallel() {
+    puts("Test json_array_getKeyValuePairList_parallel");
+    puts("================================================================================");
+
+    // the array of 100000 records is split into several chunks, the strings contain the brackets and escaped quotes
+    const size_t count = 100000;
+    char * str = malloc(count * 64 + 2);
+    if (str == NULL) {
+        return;
+    }
+
+    size_t length = 0;
+    str[length++] = '[';
+    size_t i;
+    for (i = 0; i < count; i++) {
+        length += sprintf(str + length, "%s{\"id\": %zu, \"tag\": \"a\\\"],[{%zu\"}", i == 0 ? "" : ",\n", i, i % 7);
+    }
+    str[length++] = ']';
+    str[length] = '\0';
+
+    JSON_Key_Value_Pair * list;
+    JSON_Key_Value_Pair * expected;
+    size_t size, expected_size;
+    int result = json_array_getKeyValuePairList_parallel(str, length, 0, 4, &list, &size);
+    int expected_result = json_getKeyValuePairList_n(str, length, 0, &expected, &expected_size);
+
+    // the pairs are in the array order
+    int same = result == expected_result && size == expected_size;
+    JSON_Key_Value_Pair * a = list;
+    JSON_Key_Value_Pair * b = expected;
+    while (same && a != NULL && b != NULL) {
+        same = strcmp(a->key, b->key) == 0 && strcmp(a->value, b->value) == 0 && a->value_type == b->value_type;
+        a = a->next;
+        b = b->next;
+    }
+
+    printf("result: %d, size: %zu, same as json_getKeyValuePairList_n: %d\n", result, size, same && a == NULL && b == NULL);
+
+    JSON_Key_Value_Pair * last = list;
+    while (last != NULL && last->next != NULL) {
+        last = last->next;
+    }
+    if (last != NULL) {
+        printf("[%s] = %s\n", last->key, last->value);
+    }
+
+    json_keyValuePair_free(list);
+    json_keyValuePair_free(expected);
+
+    // the invalid array is reported as the one pass does, the comma in the middle is removed
+    *strstr(str + length / 2, ",\n") = ' ';
+    result = json_array_getKeyValuePairList_parallel(str, length, 0, 4, &list, &size);
+    printf("invalid: %d, size: %zu\n", result, size);
+    json_keyValuePair_free(list);
+
+    free(str);
+
+    puts("================================================================================\n");
+}
+
+void test_json_path_evalBatch() {
+    puts("Test json_path_evalBatch");
+    puts("================================================================================");
+
+    const char * keys[] = {
+        "[\"id\"]",
+        "[\"user\"][\"name\"]",
+        "[\"tags\"][0]"
+    };
+
+    const char * documents[] = {
+        "{\"id\": 1, \"user\": {\"name\": \"alice\"}, \"tags\": [\"a\", \"b\"]}",
+        "  {\"id\": 2, \"tags\": []}",
+        "[1, 2, 3]",
+        NULL,
+        "{\"user\": {\"name\": \"bob\", \"age\": 20}, \"id\": 5}"
+    };
+
+    JSON_Path_Set * set;
+    if (json_path_compileSet(keys, 3, &set) != 0) {
+        puts("compile path set failure");
+        return;
+    }
+
+    // the matrix of 5 documents and 3 paths
+    JSON_Value_Range values[5 * 3];
+    int result = json_path_evalBatch(set, documents, NULL, 5, 3, values);
+    printf("result: %d\n", result);
+
+    size_t d, p;
+    for (d = 0; d < 5; d++) {
+        printf("%zu.", d + 1);
+        for (p = 0; p < 3; p++) {
+            const JSON_Value_Range * value = &values[d * 3 + p];
+            if (value->startIndex == JSON_INDEX_NONE) {
+                printf(" %s = (none)", keys[p]);
+            } else {
+                printf(" %s = %.*s", keys[p], (int) (value->endIndex - value->startIndex + 1), documents[d] + value->startIndex);
+            }
+        }
+        puts("");
+    }
+
+    json_path_freeSet(set);
+
+    // the wide set, 150 keys at the root and 150 keys in the nested object, more nodes than the flags on the stack
+    char wide_keys_buffer[300][32];
+    const char * wide_keys[300];
+    size_t k;
+    for (k = 0; k < 150; k++) {
+        sprintf(wide_keys_buffer[k], "[\"k%zu\"]", k);
+        sprintf(wide_keys_buffer[150 + k], "[\"o\"][\"k%zu\"]", k);
+    }
+    for (k = 0; k < 300; k++) {
+        wide_keys[k] = wide_keys_buffer[k];
+    }
+
+    if (json_path_compileSet(wide_keys, 300, &set) != 0) {
+        puts("compile path set failure");
+        return;
+    }
+
+    // the documents list the keys in reverse order, the value is document * 1000 + key
+    char * wide_documents[40];
+    for (d = 0; d < 40; d++) {
+        char * document = malloc(8192);
+        size_t length = sprintf(document, "{\"o\": {");
+        for (k = 150; k-- > 0;) {
+            length += sprintf(document + length, "\"k%zu\": %zu%s", k, d * 1000 + 500 + k, k > 0 ? ", " : "}");
+        }
+        for (k = 150; k-- > 0;) {
+            length += sprintf(document + length, ", \"k%zu\": %zu", k, d * 1000 + k);
+        }
+        sprintf(document + length, "}");
+        wide_documents[d] = document;
+    }
+
+    JSON_Value_Range * wide_values = malloc(40 * 300 * sizeof(JSON_Value_Range));
+    result = json_path_evalBatch(set, (const char * const *) wide_documents, NULL, 40, 4, wide_values);
+
+    size_t found = 0, wrong = 0;
+    for (d = 0; d < 40; d++) {
+        for (p = 0; p < 300; p++) {
+            const JSON_Value_Range * value = &wide_values[d * 300 + p];
+            if (value->startIndex == JSON_INDEX_NONE) {
+                continue;
+            }
+            found++;
+            wrong += strtoul(wide_documents[d] + value->startIndex, NULL, 10) != d * 1000 + (p < 150 ? p : 500 + p - 150);
+        }
+    }
+    printf("wide: %zu nodes, result: %d, found: %zu, wrong: %zu\n", set->nodes_size, result, found, wrong);
+
+    // the same values by one document
+    JSON_Value_Range one_values[300];
+    result = json_path_evalSet(set, wide_documents[7], strlen(wide_documents[7]), 0, one_values);
+
+    size_t same = 0;
+    for (p = 0; p < 300; p++) {
+        const JSON_Value_Range * value = &wide_values[7 * 300 + p];
+        same += one_values[p].startIndex == value->startIndex && one_values[p].endIndex == value->endIndex && one_values[p].jsonType == value->jsonType;
+    }
+    printf("wide document 8: result: %d, the same as the batch: %zu\n", result, same);
+
+    for (d = 0; d < 40; d++) {
+        free(wide_documents[d]);
+    }
+    free(wide_values);
+    json_path_freeSet(set);
+
+    puts("================================================================================\n");
+}
+
+void test_json_cache_getValueByJS() {
+    puts("Test json_cache_getValueByJS");
+    puts("================================================================================");
+
+    const char * fileName = "sample.json";
+    char * string; // need to be free
+    if (convertFileToString(fileName, &string) != 0) {
+        printf("convert file '%s' to string failure\n", fileName);
+        return;
+    }
+
+    // 4 prefixes are cached at most, the least recently used one is evicted
+    JSON_Cache * cache;
+    if (json_cache_create(string, strlen(string), 0, 4, &cache) != 0) {
+        puts("json_cache_create failure");
+        free(string);
+        return;
+    }
+
+    char * keys[100] = {
+        "[\"contents\"][1][\"productID\"]",
+        "[\"contents\"][1][\"productName\"]",
+        "[\"contents\"][01][\"quantity\"]",
+        "[\"contents\"][1][\"unknown\"]",
+        "[\"orderID\"]",
+        "[\"shopperName\"]",
+        "[\"contents\"][0][\"productName\"]",
+        "[\"contents\"][1][\"productName\"]",
+        "[\"contents\"]1]",
+        "[\"orderCompleted\"]"
+    };
+
+    int i;
+    for (i = 0; keys[i] != NULL; i++) {
+        puts("--------------------------------------------------------------------------------");
+        printf("%2d. KEY (%zu) = %s\n", i + 1, strlen(keys[i]), keys[i]);
+
+        size_t valueStartIndex, valueEndIndex;
+        int valueJsonType;
+        if (json_cache_getValueByJS(cache, keys[i], strlen(keys[i]), &valueStartIndex, &valueEndIndex, &valueJsonType) != 0) {
+            printf("%s is not found\n\n", keys[i]);
+            continue;
+        }
+
+        printf("    VALUE (%s) = %.*s\n", json_type_toString(valueJsonType), (int) (valueEndIndex - valueStartIndex + 1), string + valueStartIndex);
+        printf("    CACHED = %zu\n\n", cache->size);
+    }
+
+    json_cache_free(cache);
+    free(string);
+
+    puts("================================================================================\n");
+}
+
+void test_json_getKeyValuePairList_intern() {
+    puts("Test json_getKeyValuePairList_intern");
+    puts("================================================================================");
+
+    const char * str[100] = {
+        stringify([{"id": 1, "name": "hello", "tag": "a"}, {"id": 2, "name": "world", "tag": "a"}, {"id": 3, "tag": "b", "name": "hello"}]),
+        stringify({"id": 1, "name": "hello", "note": "the value longer than 16 characters is copied"}),
+        stringify({"hello": "world", error: [123]})
+    };
+
+    JSON_Arena * arena;
+    if (json_arena_create(0, &arena) != 0) {
+        puts("json_arena_create failure");
+        return;
+    }
+
+    // the table is shared by the calls, the values longer than 16 characters are copied into the arena
+    JSON_Intern * intern;
+    if (json_intern_create(16, &intern) != 0) {
+        puts("json_intern_create failure");
+        json_arena_free(arena);
+        return;
+    }
+
+    const char * name;
+    json_intern_string(intern, "\"name\"", 6, &name);
+
+    int i;
+    for (i = 0; str[i] != NULL; i++) {
+        printf("\nCase_%d :\n", i + 1);
+        puts("--------------------------------------------------------------------------------");
+        JSON_Key_Value_Pair * root;
+        size_t size;
+        if (json_getKeyValuePairList_intern(arena, intern, str[i], strlen(str[i]), 0, &root, &size) != 0) {
+            puts("json_getKeyValuePairList_intern failure");
+            printf("str[%d] = %s\n", i, str[i]);
+            continue;
+        }
+
+        // the keys and values of the objects in the array are materialized with the same table
+        JSON_Key_Value_Pair * ptr;
+        for (ptr = root; ptr != NULL; ptr = ptr->next) {
+            if (ptr->value_type != JSON_TYPE_OBJECT) {
+                printf("%s = %s%s\n", ptr->key, ptr->value, ptr->key == name ? " (interned name)" : "");
+                continue;
+            }
+
+            printf("%s =\n", ptr->key);
+
+            JSON_Key_Value_Pair * list;
+            if (json_object_getKeyValuePairList_intern(arena, intern, ptr->value, strlen(ptr->value), 0, &list, &size) == 0) {
+                JSON_Key_Value_Pair * pair;
+                for (pair = list; pair != NULL; pair = pair->next) {
+                    printf("    %s = %s%s\n", pair->key, pair->value, pair->key == name ? " (interned name)" : "");
+                }
+            }
+        }
+    }
+
+    printf("%zu strings are interned\n", intern->size);
+
+    json_intern_free(intern);
+    json_arena_free(arena);
+
+    puts("================================================================================\n");
+}